@@ -23,13 +23,39 @@
 #if defined(USE_PETSC)
 #include <petsc.h>
 #include <mpi.h>
+
+#ifdef OGS_USE_OPENMP_ASSEMBLY
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
+#include <omp.h>
+#include <logog/include/logog.hpp>
+#endif
+
 namespace ApplicationsLib
 {
 struct LinearSolverLibrarySetup final
 {
     LinearSolverLibrarySetup(int argc, char* argv[])
     {
+#ifdef OGS_USE_OPENMP_ASSEMBLY
+        // Hybrid mode: each rank assembles with several threads. The global
+        // matrices and vectors are only accessed from the ordered sections of
+        // the assembly, i.e., by one thread at a time, which need not be the
+        // main thread.
+        int provided;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
+        if (provided < MPI_THREAD_SERIALIZED)
+        {
+            WARN(
+                "The MPI library does not support calls from several threads. "
+                "Threaded assembly with PETSc might fail.");
+        }
+        setDefaultNumberOfThreads();
+#else
         MPI_Init(&argc, &argv);
+#endif
         char help[] = "ogs6 with PETSc \n";
         PetscInitialize(&argc, &argv, nullptr, help);
     }
@@ -40,6 +66,32 @@ struct LinearSolverLibrarySetup final
         PetscFinalize();
         MPI_Finalize();
     }
+
+private:
+#ifdef OGS_USE_OPENMP_ASSEMBLY
+    /// Unless \c OMP_NUM_THREADS is set, the cores of a node are shared among
+    /// the ranks running on that node instead of each rank starting one thread
+    /// per core. This also applies to threaded kernels of the libraries used
+    /// by PETSc.
+    static void setDefaultNumberOfThreads()
+    {
+        MPI_Comm node_comm;
+        MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+                            MPI_INFO_NULL, &node_comm);
+        int ranks_on_node;
+        MPI_Comm_size(node_comm, &ranks_on_node);
+        MPI_Comm_free(&node_comm);
+
+        if (std::getenv("OMP_NUM_THREADS") == nullptr)
+        {
+            int const cores =
+                static_cast<int>(std::thread::hardware_concurrency());
+            omp_set_num_threads(std::max(1, cores / ranks_on_node));
+        }
+        INFO("%d MPI ranks on this node, each using %d threads.",
+             ranks_on_node, omp_get_max_threads());
+    }
+#endif
 };
 }    // ApplicationsLib
 #elif defined(USE_LIS)
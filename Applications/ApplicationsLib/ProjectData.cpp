@@ -32,6 +32,7 @@
 #include "MeshGeoToolsLib/SearchLength.h"
 #include "MeshLib/Mesh.h"
 
+#include "NumLib/NumericsConfig.h"
 #include "NumLib/ODESolver/ConvergenceCriterion.h"
 #include "ProcessLib/CreateJacobianAssembler.h"
 
@@ -211,6 +212,27 @@ ProjectData::ProjectData(BaseLib::ConfigTree const& project_config,
 #endif  // OGS_USE_PYTHON
     }
 
+    if (auto const number_of_threads =
+            //! \ogs_file_param{prj__number_of_assembly_threads}
+        project_config.getConfigParameterOptional<int>(
+            "number_of_assembly_threads"))
+    {
+#ifdef OGS_USE_OPENMP_ASSEMBLY
+        if (*number_of_threads < 1)
+        {
+            OGS_FATAL(
+                "The number of assembly threads must be positive, got %d.",
+                *number_of_threads);
+        }
+        GlobalExecutor::setNumberOfThreads(*number_of_threads);
+        INFO("Assembling with %d threads.", *number_of_threads);
+#else
+        WARN(
+            "OpenGeoSys has not been built with parallel assembly. The "
+            "number_of_assembly_threads setting is ignored.");
+#endif  // OGS_USE_OPENMP_ASSEMBLY
+    }
+
     //! \ogs_file_param{prj__curves}
     parseCurves(project_config.getConfigSubtreeOptional("curves"));
 
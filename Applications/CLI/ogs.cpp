@@ -31,6 +31,7 @@
 #include "BaseLib/ConfigTreeUtil.h"
 #include "BaseLib/DateTools.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/Profiler.h"
 #include "BaseLib/RunTime.h"
 #include "BaseLib/TemplateLogogFormatterSuppressedGCC.h"
 
@@ -89,6 +90,22 @@ int main(int argc, char* argv[])
                                                "log level");
     cmd.add(log_level_arg);
 
+    TCLAP::ValueArg<std::string> profile_arg(
+        "", "profile",
+        "time the phases of the simulation and write a summary to "
+        "<prefix>.json and <prefix>.csv and a Chrome trace to "
+        "<prefix>_trace.json",
+        false, "", "prefix");
+    cmd.add(profile_arg);
+
+    TCLAP::ValueArg<std::string> restart_arg(
+        "", "restart",
+        "continue the simulation from the given checkpoint file written by a "
+        "previous run of the same project file; with MPI the rank is inserted "
+        "before the extension",
+        false, "", "checkpoint file");
+    cmd.add(restart_arg);
+
     TCLAP::SwitchArg nonfatal_arg("",
                                   "config-warnings-nonfatal",
                                   "warnings from parsing the configuration "
@@ -201,8 +218,25 @@ int main(int argc, char* argv[])
 
             INFO("Solve processes.");
 
+            if (profile_arg.isSet())
+            {
+                BaseLib::Profiler::instance().enable();
+            }
+
             auto& time_loop = project.getTimeLoop();
-            solver_succeeded = time_loop.loop();
+            if (restart_arg.isSet())
+            {
+                time_loop.setRestartFile(restart_arg.getValue());
+            }
+            {
+                BaseLib::ProfilingScope const profiling_scope("time_loop");
+                solver_succeeded = time_loop.loop();
+            }
+
+            if (profile_arg.isSet())
+            {
+                BaseLib::Profiler::instance().write(profile_arg.getValue());
+            }
 
 #ifdef USE_INSITU
             if (isInsituConfigured)
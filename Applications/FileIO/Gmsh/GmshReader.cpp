@@ -23,220 +23,222 @@
 
 #include "MeshLib/MeshEditing/ElementValueModification.h"
 
+#include "BaseLib/Error.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/MemoryMappedFile.h"
+#include "BaseLib/TextParsing.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <map>
+#include <memory>
+#include <utility>
 #include <vector>
 
-namespace FileIO
+namespace
 {
-namespace GMSH
+/// Maximum number of nodes of the supported (linear) element types.
+const std::size_t max_element_nodes = 8;
+
+/// Number of nodes of the Gmsh element types, indexed by the type number, or
+/// zero for unknown types.
+std::size_t getNumberOfElementNodes(int const type)
 {
+    static const std::size_t number_of_nodes[] = {
+        0, 2, 3, 4, 4, 8, 6, 5, 3, 6, 9, 10, 27, 18, 14, 1, 8, 20, 15, 13};
+    if (type < 0 || type >= static_cast<int>(sizeof(number_of_nodes) /
+                                            sizeof(number_of_nodes[0])))
+    {
+        return 0;
+    }
+    return number_of_nodes[type];
+}
 
-bool isGMSHMeshFile(const std::string& fname)
+/// Element types which are converted into MeshLib elements: line, triangle,
+/// quadrilateral, tetrahedron, hexahedron, prism and pyramid.
+bool isSupportedElementType(int const type)
 {
-    std::ifstream input(fname.c_str());
+    return type >= 1 && type <= 7;
+}
 
-    if (!input) {
-        ERR("isGMSHMeshFile(): Could not open file %s.", fname.c_str());
-        return false;
+/// The node and element data of a Gmsh file independent of the file format
+/// version. The node tags of the elements are stored with a fixed stride of
+/// max_element_nodes.
+struct GmshMeshData
+{
+    std::vector<std::size_t> node_tags;
+    std::vector<double> coordinates;
+    std::vector<int> element_types;
+    std::vector<int> material_ids;
+    std::vector<std::size_t> element_node_tags;
+
+    void resizeNodes(std::size_t const n_nodes)
+    {
+        node_tags.resize(n_nodes);
+        coordinates.resize(3 * n_nodes);
     }
 
-    std::string header_first_line;
-    input >> header_first_line;
-    if (header_first_line.find("$MeshFormat") != std::string::npos) {
-        // read version
-        std::string version;
-        getline(input, version);
-        getline(input, version);
-        INFO("isGMSHMeshFile(): Found GMSH mesh file version: %s.",
-             version.c_str());
-        input.close();
-        return true;
+    void resizeElements(std::size_t const n_elements)
+    {
+        element_types.resize(n_elements);
+        material_ids.resize(n_elements);
+        element_node_tags.resize(max_element_nodes * n_elements);
     }
+};
 
-    return false;
-}
+const std::size_t invalid_node_index =
+    std::numeric_limits<std::size_t>::max();
 
-void readNodeIDs(std::ifstream& in, unsigned n_nodes,
-                 std::vector<unsigned>& node_ids,
-                 std::map<unsigned, unsigned> const& id_map)
+/// Maps node tags of the Gmsh file to indices into the node vector. Dense
+/// numberings, which Gmsh writes by default, are looked up in a vector.
+class NodeTagMap
 {
-    unsigned idx;
-    for (unsigned i = 0; i < n_nodes; i++)
+public:
+    explicit NodeTagMap(std::vector<std::size_t> const& tags)
     {
-        in >> idx;
-        node_ids.push_back(id_map.at(idx));
+        auto const max_tag =
+            tags.empty() ? 0 : *std::max_element(tags.begin(), tags.end());
+        if (max_tag <= 2 * tags.size() + 16)
+        {
+            _dense.assign(max_tag + 1, invalid_node_index);
+            for (std::size_t i = 0; i < tags.size(); ++i)
+            {
+                _dense[tags[i]] = i;
+            }
+            return;
+        }
+        _sparse.reserve(tags.size());
+        for (std::size_t i = 0; i < tags.size(); ++i)
+        {
+            _sparse.emplace_back(tags[i], i);
+        }
+        std::sort(_sparse.begin(), _sparse.end());
     }
-}
 
-std::pair<MeshLib::Element*, int> readElement(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
-    std::map<unsigned, unsigned> const& id_map)
-{
-    unsigned idx, type, n_tags, dummy;
-    int mat_id;
-    std::vector<unsigned> node_ids;
-    std::vector<MeshLib::Node*> elem_nodes;
-    in >> idx >> type >> n_tags >> mat_id >> dummy;
+    std::size_t operator()(std::size_t const tag) const
+    {
+        if (!_dense.empty())
+        {
+            return tag < _dense.size() ? _dense[tag] : invalid_node_index;
+        }
+        auto const it = std::lower_bound(_sparse.begin(), _sparse.end(),
+                                         std::make_pair(tag, std::size_t{0}));
+        return (it != _sparse.end() && it->first == tag) ? it->second
+                                                         : invalid_node_index;
+    }
 
-    // skip tags
-    for (std::size_t j = 2; j < n_tags; j++)
-        in >> dummy;
+private:
+    std::vector<std::size_t> _dense;
+    std::vector<std::pair<std::size_t, std::size_t>> _sparse;
+};
 
+MeshLib::Element* createElement(int const type, MeshLib::Node** const nodes)
+{
     switch (type)
     {
-    case 1: {
-        readNodeIDs(in, 2, node_ids, id_map);
-        // edge_nodes array will be deleted from Line object
-        auto edge_nodes = new MeshLib::Node*[2];
-        edge_nodes[0] = nodes[node_ids[0]];
-        edge_nodes[1] = nodes[node_ids[1]];
-        return std::make_pair(new MeshLib::Line(edge_nodes), mat_id);
-    }
-    case 2: {
-        readNodeIDs(in, 3, node_ids, id_map);
-        auto tri_nodes = new MeshLib::Node*[3];
-        tri_nodes[0] = nodes[node_ids[2]];
-        tri_nodes[1] = nodes[node_ids[1]];
-        tri_nodes[2] = nodes[node_ids[0]];
-        return std::make_pair(new MeshLib::Tri(tri_nodes), mat_id);
-    }
-    case 3: {
-        readNodeIDs(in, 4, node_ids, id_map);
-        auto quad_nodes = new MeshLib::Node*[4];
-        for (unsigned k(0); k < 4; k++)
-            quad_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Quad(quad_nodes), mat_id);
-    }
-    case 4: {
-        readNodeIDs(in, 4, node_ids, id_map);
-        auto tet_nodes = new MeshLib::Node*[5];
-        for (unsigned k(0); k < 4; k++)
-            tet_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Tet(tet_nodes), mat_id);
-    }
-    case 5: {
-        readNodeIDs(in, 8, node_ids, id_map);
-        auto hex_nodes = new MeshLib::Node*[8];
-        for (unsigned k(0); k < 8; k++)
-            hex_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Hex(hex_nodes), mat_id);
-    }
-    case 6: {
-        readNodeIDs(in, 6, node_ids, id_map);
-        auto prism_nodes = new MeshLib::Node*[6];
-        for (unsigned k(0); k < 6; k++)
-            prism_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Prism(prism_nodes), mat_id);
-    }
-    case 7: {
-        readNodeIDs(in, 5, node_ids, id_map);
-        auto pyramid_nodes = new MeshLib::Node*[5];
-        for (unsigned k(0); k < 5; k++)
-            pyramid_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Pyramid(pyramid_nodes), mat_id);
-    }
-    case 15:
-        in >> dummy; // skip rest of line
-        break;
-    default:
-        WARN("readGMSHMesh(): Unknown element type %d.", type);
-        break;
-    }
-    return std::make_pair(nullptr, -1);
+        case 1:
+            return new MeshLib::Line(nodes);
+        case 2:
+            // Gmsh orders the triangle nodes the other way round.
+            std::swap(nodes[0], nodes[2]);
+            return new MeshLib::Tri(nodes);
+        case 3:
+            return new MeshLib::Quad(nodes);
+        case 4:
+            return new MeshLib::Tet(nodes);
+        case 5:
+            return new MeshLib::Hex(nodes);
+        case 6:
+            return new MeshLib::Prism(nodes);
+        case 7:
+            return new MeshLib::Pyramid(nodes);
+        default:
+            return nullptr;
+    }
 }
 
-MeshLib::Mesh* readGMSHMesh(std::string const& fname)
+/// Creates the mesh from the data read from a file of any version. Returns
+/// nullptr if there are no elements or if an element refers to an unknown
+/// node.
+MeshLib::Mesh* createMesh(GmshMeshData const& data, std::string const& fname)
 {
-    std::string line;
-    std::ifstream in(fname.c_str(), std::ios::in);
-    if (!in.is_open())
+    std::size_t const n_nodes = data.node_tags.size();
+    std::vector<MeshLib::Node*> nodes(n_nodes);
+    auto const n_nodes_signed = static_cast<long>(n_nodes);
+#pragma omp parallel for
+    for (long i = 0; i < n_nodes_signed; ++i)
     {
-        WARN ("readGMSHMesh() - Could not open file %s.", fname.c_str());
-        return nullptr;
+        nodes[i] = new MeshLib::Node(&data.coordinates[3 * i],
+                                     data.node_tags[i]);
     }
 
-    getline(in, line); // $MeshFormat keyword
-    if (line.find("$MeshFormat") == std::string::npos)
+    std::vector<std::size_t> element_indices;
+    element_indices.reserve(data.element_types.size());
+    std::map<int, std::size_t> skipped_element_types;
+    for (std::size_t i = 0; i < data.element_types.size(); ++i)
     {
-        in.close();
-        WARN ("No GMSH file format recognized.");
-        return nullptr;
+        int const type = data.element_types[i];
+        if (isSupportedElementType(type))
+        {
+            element_indices.push_back(i);
+        }
+        else if (type != 15)  // points are skipped silently.
+        {
+            ++skipped_element_types[type];
+        }
     }
-
-    getline(in, line); // version-number file-type data-size
-    if (line.substr(0, 3) != "2.2")
+    for (auto const& skipped : skipped_element_types)
     {
-        WARN("Wrong gmsh file format version.");
-        return nullptr;
+        WARN("readGMSHMesh(): Skipped %zu elements of unknown type %d.",
+             skipped.second, skipped.first);
     }
 
-    if (line[4] != '0')
+    NodeTagMap const node_tag_map(data.node_tags);
+    std::vector<MeshLib::Element*> elements(element_indices.size());
+    std::vector<int> materials(element_indices.size());
+    std::atomic<bool> valid_node_tags{true};
+    auto const n_elements_signed = static_cast<long>(element_indices.size());
+#pragma omp parallel for
+    for (long e = 0; e < n_elements_signed; ++e)
     {
-        WARN("Currently reading gmsh binary file type is not supported.");
-        return nullptr;
-    }
-    getline(in, line); //$EndMeshFormat
-
-    std::vector<MeshLib::Node*> nodes;
-    std::vector<MeshLib::Element*> elements;
-    std::vector<int> materials;
-    std::map<unsigned, unsigned> id_map;
-    while (line.find("$EndElements") == std::string::npos)
-    {
-        // Node data
-        getline(in, line); //$Nodes Keywords
-        if (line.find("$Nodes") != std::string::npos)
-        {
-            std::size_t n_nodes(0);
-            long id;
-            double x, y, z;
-            in >> n_nodes >> std::ws;
-            nodes.resize(n_nodes);
-            for (std::size_t i = 0; i < n_nodes; i++) {
-                in >> id >> x >> y >> z >> std::ws;
-                id_map.insert(std::map<unsigned, unsigned>::value_type(id, i));
-                nodes[i] = new MeshLib::Node(x,y,z,id);
-            }
-            getline(in, line); // End Node keyword $EndNodes
-        }
+        std::size_t const i = element_indices[e];
+        int const type = data.element_types[i];
+        std::size_t const n_element_nodes = getNumberOfElementNodes(type);
+        auto const* const tags = &data.element_node_tags[max_element_nodes * i];
 
-        // Element data
-        if (line.find("$Elements") != std::string::npos)
+        // The node array will be deleted by the element.
+        auto element_nodes = new MeshLib::Node*[n_element_nodes];
+        for (std::size_t k = 0; k < n_element_nodes; ++k)
         {
-            std::size_t n_elements(0);
-            if (! (in >> n_elements >> std::ws)) { // number-of-elements
-                ERR("Read GMSH mesh does not contain any elements");
-            }
-            elements.reserve(n_elements);
-            materials.reserve(n_elements);
-            for (std::size_t i = 0; i < n_elements; i++)
+            std::size_t const node_index = node_tag_map(tags[k]);
+            if (node_index == invalid_node_index)
             {
-                MeshLib::Element* elem(nullptr);
-                int mat_id(0);
-                std::tie(elem, mat_id) = readElement(in, nodes, id_map);
-
-                if (elem) {
-                    elements.push_back(elem);
-                    materials.push_back(mat_id);
-                }
+                valid_node_tags = false;
+                element_nodes[k] = nullptr;
+                continue;
             }
-            getline(in, line); // END keyword
+            element_nodes[k] = nodes[node_index];
         }
+        elements[e] = createElement(type, element_nodes);
+        materials[e] = data.material_ids[i];
+    }
 
-        if (line.find("PhysicalNames") != std::string::npos)
+    if (!valid_node_tags || elements.empty())
+    {
+        if (!valid_node_tags)
         {
-            std::size_t n_lines(0);
-            in >> n_lines >> std::ws; // number-of-lines
-            for (std::size_t i = 0; i < n_lines; i++)
-                getline(in, line);
-            getline(in, line); // END keyword
+            ERR("readGMSHMesh(): An element refers to an unknown node in the "
+                "file '%s'.",
+                fname.c_str());
+        }
+        for (auto& element : elements)
+        {
+            delete element;
         }
-    }
-    in.close();
-    if (elements.empty()) {
         for (auto& node : nodes)
         {
             delete node;
@@ -269,5 +271,534 @@ MeshLib::Mesh* readGMSHMesh(std::string const& fname)
     return mesh;
 }
 
+/// Returns the range of the section starting at \c first, which points
+/// behind the line with the section keyword, up to the beginning of the line
+/// containing \c end_keyword.
+std::pair<char const*, char const*> findSection(char const* const first,
+                                                char const* const last,
+                                                std::string const& end_keyword)
+{
+    return {first, BaseLib::findKeyword(first, last, end_keyword)};
+}
+
+/// Reads the count in the first line of a section of a version 2.2 file and
+/// advances \c first to the next line.
+bool readCount(char const*& first, char const* const last, std::size_t& count)
+{
+    if (!BaseLib::parseInteger(first, last, count))
+    {
+        return false;
+    }
+    first = BaseLib::nextLine(first, last);
+    return true;
+}
+
+bool readNodesV2(char const* first, char const* const last,
+                 GmshMeshData& data)
+{
+    std::size_t n_nodes;
+    if (!readCount(first, last, n_nodes))
+    {
+        return false;
+    }
+    data.resizeNodes(n_nodes);
+    return BaseLib::parseLinesInParallel(
+        first, last, n_nodes,
+        [&data](char const* p, char const* const line_end,
+                std::size_t const i) {
+            return BaseLib::parseInteger(p, line_end, data.node_tags[i]) &&
+                   BaseLib::parseDouble(p, line_end, data.coordinates[3 * i]) &&
+                   BaseLib::parseDouble(p, line_end,
+                                        data.coordinates[3 * i + 1]) &&
+                   BaseLib::parseDouble(p, line_end,
+                                        data.coordinates[3 * i + 2]);
+        });
+}
+
+bool readElementsV2(char const* first, char const* const last,
+                    GmshMeshData& data)
+{
+    std::size_t n_elements;
+    if (!readCount(first, last, n_elements))
+    {
+        ERR("Read GMSH mesh does not contain any elements");
+        return false;
+    }
+    data.resizeElements(n_elements);
+    return BaseLib::parseLinesInParallel(
+        first, last, n_elements,
+        [&data](char const* p, char const* const line_end,
+                std::size_t const i) {
+            std::size_t id;
+            int type;
+            std::size_t n_tags;
+            if (!BaseLib::parseInteger(p, line_end, id) ||
+                !BaseLib::parseInteger(p, line_end, type) ||
+                !BaseLib::parseInteger(p, line_end, n_tags))
+            {
+                return false;
+            }
+            data.element_types[i] = type;
+
+            // The first tag is the physical entity, which is used as material
+            // id; the other tags are skipped.
+            data.material_ids[i] = 0;
+            for (std::size_t t = 0; t < n_tags; ++t)
+            {
+                int tag;
+                if (!BaseLib::parseInteger(p, line_end, tag))
+                {
+                    return false;
+                }
+                if (t == 0)
+                {
+                    data.material_ids[i] = tag;
+                }
+            }
+
+            if (!isSupportedElementType(type))
+            {
+                return true;
+            }
+            auto* const tags = &data.element_node_tags[max_element_nodes * i];
+            for (std::size_t k = 0; k < getNumberOfElementNodes(type); ++k)
+            {
+                if (!BaseLib::parseInteger(p, line_end, tags[k]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        });
+}
+
+MeshLib::Mesh* readGMSHMeshV2(char const* first, char const* const last,
+                              std::string const& fname)
+{
+    GmshMeshData data;
+    while (first != last)
+    {
+        char const* const line_end = BaseLib::nextLine(first, last);
+        std::string keyword;
+        BaseLib::parseWord(first, line_end, keyword);
+        first = line_end;
+        if (keyword.empty() || keyword[0] != '$' ||
+            keyword.compare(0, 4, "$End") == 0)
+        {
+            continue;
+        }
+
+        auto const section =
+            findSection(first, last, "$End" + keyword.substr(1));
+        if (section.second == last)
+        {
+            ERR("readGMSHMesh(): The section %s is not terminated.",
+                keyword.c_str());
+            return nullptr;
+        }
+        if (keyword == "$Nodes" &&
+            !readNodesV2(section.first, section.second, data))
+        {
+            ERR("readGMSHMesh(): Could not read the nodes of file '%s'.",
+                fname.c_str());
+            return nullptr;
+        }
+        if (keyword == "$Elements" &&
+            !readElementsV2(section.first, section.second, data))
+        {
+            ERR("readGMSHMesh(): Could not read the elements of file '%s'.",
+                fname.c_str());
+            return nullptr;
+        }
+        first = section.second;
+    }
+
+    return createMesh(data, fname);
+}
+
+/// Reads the entries of a version 4.1 file, which are either stored as text
+/// or in binary form. In binary files integers are 4 bytes and sizes are 8
+/// bytes long.
+class GmshV4Reader
+{
+public:
+    GmshV4Reader(char const* const first, char const* const last,
+                 bool const binary, std::string const& fname)
+        : _first(first),
+          _position(first),
+          _last(last),
+          _binary(binary),
+          _fname(fname)
+    {
+    }
+
+    int readInt() { return read<std::int32_t>(); }
+    std::size_t readSize()
+    {
+        return static_cast<std::size_t>(read<std::uint64_t>());
+    }
+    double readDouble() { return read<double>(); }
+
+    char const* position() const { return _position; }
+    void setPosition(char const* const position) { _position = position; }
+
+private:
+    template <typename T>
+    T read()
+    {
+        T value;
+        if (_binary)
+        {
+            if (static_cast<std::size_t>(_last - _position) < sizeof(T))
+            {
+                OGS_FATAL("readGMSHMesh(): The file '%s' is truncated.",
+                          _fname.c_str());
+            }
+            std::memcpy(&value, _position, sizeof(T));
+            _position += sizeof(T);
+            return value;
+        }
+
+        while (_position != _last &&
+               (BaseLib::isBlank(*_position) || *_position == '\n'))
+        {
+            ++_position;
+        }
+        if (!parse(value))
+        {
+            OGS_FATAL(
+                "readGMSHMesh(): Could not read a number at byte %zu of the "
+                "file '%s'.",
+                static_cast<std::size_t>(_position - _first), _fname.c_str());
+        }
+        return value;
+    }
+
+    bool parse(double& value)
+    {
+        return BaseLib::parseDouble(_position, _last, value);
+    }
+    template <typename Integer>
+    bool parse(Integer& value)
+    {
+        return BaseLib::parseInteger(_position, _last, value);
+    }
+
+    char const* const _first;
+    char const* _position;
+    char const* const _last;
+    bool const _binary;
+    std::string const& _fname;
+};
+
+/// Reads the physical tags of the entities. The first physical tag of an
+/// entity is used as material id of its elements.
+void readEntitiesV4(GmshV4Reader& reader,
+                    std::map<std::pair<int, int>, int>& physical_tags)
+{
+    std::size_t n_entities[4];
+    for (auto& n : n_entities)
+    {
+        n = reader.readSize();
+    }
+    for (int dim = 0; dim < 4; ++dim)
+    {
+        for (std::size_t i = 0; i < n_entities[dim]; ++i)
+        {
+            int const tag = reader.readInt();
+            // points have coordinates, all others a bounding box.
+            for (int k = 0; k < (dim == 0 ? 3 : 6); ++k)
+            {
+                reader.readDouble();
+            }
+            std::size_t const n_physical_tags = reader.readSize();
+            for (std::size_t k = 0; k < n_physical_tags; ++k)
+            {
+                int const physical_tag = reader.readInt();
+                if (k == 0)
+                {
+                    physical_tags[{dim, tag}] = physical_tag;
+                }
+            }
+            if (dim > 0)
+            {
+                std::size_t const n_bounding_entities = reader.readSize();
+                for (std::size_t k = 0; k < n_bounding_entities; ++k)
+                {
+                    reader.readInt();
+                }
+            }
+        }
+    }
+}
+
+void readNodesV4(GmshV4Reader& reader, GmshMeshData& data)
+{
+    std::size_t const n_blocks = reader.readSize();
+    std::size_t const n_nodes = reader.readSize();
+    reader.readSize();  // minimum node tag
+    reader.readSize();  // maximum node tag
+    data.resizeNodes(n_nodes);
+
+    std::size_t offset = 0;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+    {
+        int const entity_dim = reader.readInt();
+        reader.readInt();  // entity tag
+        int const parametric = reader.readInt();
+        std::size_t const n_block_nodes = reader.readSize();
+        if (offset + n_block_nodes > n_nodes)
+        {
+            OGS_FATAL("readGMSHMesh(): The node blocks contain more than %zu "
+                      "nodes.",
+                      n_nodes);
+        }
+
+        for (std::size_t i = 0; i < n_block_nodes; ++i)
+        {
+            data.node_tags[offset + i] = reader.readSize();
+        }
+        for (std::size_t i = 0; i < n_block_nodes; ++i)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                data.coordinates[3 * (offset + i) + k] = reader.readDouble();
+            }
+            for (int k = 0; parametric != 0 && k < entity_dim; ++k)
+            {
+                reader.readDouble();
+            }
+        }
+        offset += n_block_nodes;
+    }
+    if (offset != n_nodes)
+    {
+        OGS_FATAL("readGMSHMesh(): Expected %zu nodes but read %zu.", n_nodes,
+                  offset);
+    }
+}
+
+void readElementsV4(GmshV4Reader& reader,
+                    std::map<std::pair<int, int>, int> const& physical_tags,
+                    GmshMeshData& data)
+{
+    std::size_t const n_blocks = reader.readSize();
+    std::size_t const n_elements = reader.readSize();
+    reader.readSize();  // minimum element tag
+    reader.readSize();  // maximum element tag
+    data.resizeElements(n_elements);
+
+    std::size_t offset = 0;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+    {
+        int const entity_dim = reader.readInt();
+        int const entity_tag = reader.readInt();
+        int const type = reader.readInt();
+        std::size_t const n_block_elements = reader.readSize();
+        if (offset + n_block_elements > n_elements)
+        {
+            OGS_FATAL("readGMSHMesh(): The element blocks contain more than "
+                      "%zu elements.",
+                      n_elements);
+        }
+
+        std::size_t const n_element_nodes = getNumberOfElementNodes(type);
+        if (n_element_nodes == 0)
+        {
+            OGS_FATAL("readGMSHMesh(): Unknown element type %d.", type);
+        }
+        auto const physical_tag = physical_tags.find({entity_dim, entity_tag});
+        int const material_id =
+            physical_tag == physical_tags.end() ? 0 : physical_tag->second;
+        bool const is_supported = isSupportedElementType(type);
+
+        for (std::size_t i = offset; i < offset + n_block_elements; ++i)
+        {
+            data.element_types[i] = type;
+            data.material_ids[i] = material_id;
+            reader.readSize();  // element tag
+            for (std::size_t k = 0; k < n_element_nodes; ++k)
+            {
+                std::size_t const node_tag = reader.readSize();
+                if (is_supported)
+                {
+                    data.element_node_tags[max_element_nodes * i + k] =
+                        node_tag;
+                }
+            }
+        }
+        offset += n_block_elements;
+    }
+    if (offset != n_elements)
+    {
+        OGS_FATAL("readGMSHMesh(): Expected %zu elements but read %zu.",
+                  n_elements, offset);
+    }
+}
+
+MeshLib::Mesh* readGMSHMeshV4(char const* const first, char const* const last,
+                              bool const binary, std::string const& fname)
+{
+    GmshMeshData data;
+    std::map<std::pair<int, int>, int> physical_tags;
+    GmshV4Reader reader(first, last, binary, fname);
+
+    char const* position = first;
+    while (position != last)
+    {
+        char const* const line_end = BaseLib::nextLine(position, last);
+        std::string keyword;
+        BaseLib::parseWord(position, line_end, keyword);
+        position = line_end;
+        if (keyword.empty() || keyword[0] != '$' ||
+            keyword.compare(0, 4, "$End") == 0)
+        {
+            continue;
+        }
+
+        reader.setPosition(position);
+        if (keyword == "$Entities")
+        {
+            readEntitiesV4(reader, physical_tags);
+        }
+        else if (keyword == "$Nodes")
+        {
+            readNodesV4(reader, data);
+        }
+        else if (keyword == "$Elements")
+        {
+            readElementsV4(reader, physical_tags, data);
+        }
+        else if (keyword == "$PartitionedEntities")
+        {
+            WARN("readGMSHMesh(): Partitioned Gmsh meshes are not supported.");
+            return nullptr;
+        }
+
+        // Continue behind the section, which is skipped entirely if unknown.
+        auto const section_end = BaseLib::findKeyword(
+            reader.position(), last, "$End" + keyword.substr(1));
+        if (section_end == last)
+        {
+            ERR("readGMSHMesh(): The section %s is not terminated.",
+                keyword.c_str());
+            return nullptr;
+        }
+        position = section_end;
+    }
+
+    return createMesh(data, fname);
+}
+}  // namespace
+
+namespace FileIO
+{
+namespace GMSH
+{
+
+bool isGMSHMeshFile(const std::string& fname)
+{
+    std::ifstream input(fname.c_str());
+
+    if (!input) {
+        ERR("isGMSHMeshFile(): Could not open file %s.", fname.c_str());
+        return false;
+    }
+
+    std::string header_first_line;
+    input >> header_first_line;
+    if (header_first_line.find("$MeshFormat") != std::string::npos) {
+        // read version
+        std::string version;
+        getline(input, version);
+        getline(input, version);
+        INFO("isGMSHMeshFile(): Found GMSH mesh file version: %s.",
+             version.c_str());
+        input.close();
+        return true;
+    }
+
+    return false;
+}
+
+MeshLib::Mesh* readGMSHMesh(std::string const& fname)
+{
+    BaseLib::MemoryMappedFile const file(fname);
+    if (file.data() == nullptr)
+    {
+        WARN ("readGMSHMesh() - Could not open file %s.", fname.c_str());
+        return nullptr;
+    }
+
+    char const* position = file.begin();
+    char const* const last = file.end();
+    std::string keyword;
+    if (!BaseLib::parseWord(position, last, keyword) ||
+        keyword != "$MeshFormat")
+    {
+        WARN ("No GMSH file format recognized.");
+        return nullptr;
+    }
+    position = BaseLib::nextLine(position, last);
+
+    // version-number file-type data-size
+    std::string version;
+    int file_type = 0;
+    std::size_t data_size = 0;
+    if (!BaseLib::parseWord(position, last, version) ||
+        !BaseLib::parseInteger(position, last, file_type) ||
+        !BaseLib::parseInteger(position, last, data_size))
+    {
+        WARN("Could not read the gmsh file format.");
+        return nullptr;
+    }
+    position = BaseLib::nextLine(position, last);
+    bool const binary = file_type != 0;
+
+    if (version == "2.2")
+    {
+        if (binary)
+        {
+            WARN("Currently reading gmsh binary file type is not supported "
+                 "for version 2.2.");
+            return nullptr;
+        }
+        return readGMSHMeshV2(position, last, fname);
+    }
+
+    if (version != "4.1")
+    {
+        WARN("Wrong gmsh file format version %s; supported are 2.2 and 4.1.",
+             version.c_str());
+        return nullptr;
+    }
+    if (binary)
+    {
+        if (data_size != sizeof(std::uint64_t))
+        {
+            WARN("Gmsh binary files with data size %zu are not supported.",
+                 data_size);
+            return nullptr;
+        }
+        // A binary one detects a different byte order.
+        std::int32_t one = 0;
+        if (last - position < static_cast<long>(sizeof(one)))
+        {
+            WARN("The gmsh file %s is truncated.", fname.c_str());
+            return nullptr;
+        }
+        std::memcpy(&one, position, sizeof(one));
+        if (one != 1)
+        {
+            WARN("The byte order of the gmsh binary file %s differs from the "
+                 "one of this machine.",
+                 fname.c_str());
+            return nullptr;
+        }
+        position += sizeof(one);
+    }
+    return readGMSHMeshV4(position, last, binary, fname);
+}
+
 } // end namespace GMSH
 } // end namespace FileIO
@@ -0,0 +1,63 @@
+/**
+ * @file VTK2BinaryMesh.cpp
+ * @brief Converts a VTK mesh into the binary OGS mesh format.
+ *
+ * @copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <memory>
+#include <string>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/IO/Binary/BinaryMeshIO.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/Mesh.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Converts a VTK mesh into the binary OGS mesh format (.bmsh), which "
+        "can be read without parsing. All mesh properties are kept.\n\n"
+        "OpenGeoSys-6 software, version " +
+            BaseLib::BuildInfo::git_describe +
+            ".\n"
+            "Copyright (c) 2012-2018, OpenGeoSys Community "
+            "(http://www.opengeosys.org)",
+        ' ', BaseLib::BuildInfo::git_describe);
+    TCLAP::ValueArg<std::string> mesh_in(
+        "i", "mesh-input-file",
+        "the name of the file containing the input mesh", true, "",
+        "file name of input mesh");
+    cmd.add(mesh_in);
+    TCLAP::ValueArg<std::string> mesh_out(
+        "o", "mesh-output-file",
+        "the name of the file the mesh will be written to", true, "",
+        "file name of output mesh");
+    cmd.add(mesh_out);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::IO::VtuInterface::readVTUFile(mesh_in.getValue()));
+    if (!mesh)
+    {
+        return EXIT_FAILURE;
+    }
+    INFO("Mesh read: %d nodes, %d elements.", mesh->getNumberOfNodes(),
+         mesh->getNumberOfElements());
+
+    if (!MeshLib::IO::Binary::writeBinaryMesh(*mesh, mesh_out.getValue()))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -67,6 +67,13 @@ int main(int argc, char* argv[])
                                 "integer");
     cmd.add(nparts);
 
+    TCLAP::ValueArg<int> threads_per_partition(
+        "t", "threads-per-partition",
+        "the number of OpenMP threads used by each MPI process for a hybrid "
+        "MPI and OpenMP run; the mesh is partitioned into np/t domains",
+        false, 1, "integer");
+    cmd.add(threads_per_partition);
+
     TCLAP::SwitchArg ogs2metis_flag(
         "s", "ogs2metis",
         "Indicator to convert the ogs mesh file to METIS input file", cmd,
@@ -116,18 +123,31 @@ int main(int argc, char* argv[])
         return EXIT_SUCCESS;
     }
 
+    if (nparts.getValue() < 1 || threads_per_partition.getValue() < 1)
+    {
+        OGS_FATAL(
+            "Number of partitions and threads per partition must be "
+            "positive.");
+    }
+    if (nparts.getValue() % threads_per_partition.getValue() != 0)
+    {
+        OGS_FATAL(
+            "The number of partitions %d is not a multiple of the number of "
+            "threads per partition %d.",
+            nparts.getValue(), threads_per_partition.getValue());
+    }
+    // In the hybrid mode each MPI process computes one larger domain with
+    // several threads instead of several processes computing one domain each.
+    const int num_partitions =
+        nparts.getValue() / threads_per_partition.getValue();
+    INFO("Partitioning the mesh into %d domains.", num_partitions);
+
     ApplicationUtils::NodeWiseMeshPartitioner mesh_partitioner(
-        nparts.getValue(), std::move(mesh_ptr));
+        num_partitions, std::move(mesh_ptr));
 
     std::string const output_file_name_wo_extension = BaseLib::joinPaths(
         output_directory_arg.getValue(),
         BaseLib::extractBaseNameWithoutExtension(mesh_input.getValue()));
-    const int num_partitions = nparts.getValue();
-
-    if (num_partitions < 1)
-    {
-        OGS_FATAL("Number of partitions must be positive.");
-    }
 
     if (num_partitions == 1)
     {
@@ -148,7 +168,7 @@ int main(int argc, char* argv[])
         const std::string mpmetis_com =
             BaseLib::joinPaths(exe_path, "mpmetis") + " -gtype=nodal " + "'" +
             input_file_name_wo_extension + ".mesh" + "' " +
-            std::to_string(nparts.getValue());
+            std::to_string(num_partitions);
 
         const int status = system(mpmetis_com.c_str());
         if (status != 0)
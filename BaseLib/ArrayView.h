@@ -0,0 +1,75 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace BaseLib
+{
+/// Non-owning view of a contiguous sequence of objects, e.g., of a part of a
+/// std::vector.
+///
+/// The view provides the read access part of the std::vector interface. The
+/// viewed memory must outlive the view and must not be reallocated while the
+/// view is in use.
+template <typename T>
+class ArrayView
+{
+public:
+    using value_type = std::remove_cv_t<T>;
+    using iterator = T*;
+    using const_iterator = T*;
+    using size_type = std::size_t;
+
+    ArrayView() = default;
+
+    ArrayView(T* const data, std::size_t const size) : _data(data), _size(size)
+    {
+    }
+
+    T* begin() const { return _data; }
+    T* end() const { return _data + _size; }
+    T* cbegin() const { return _data; }
+    T* cend() const { return _data + _size; }
+
+    std::size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    T& operator[](std::size_t const i) const
+    {
+        assert(i < _size);
+        return _data[i];
+    }
+
+    T& front() const { return (*this)[0]; }
+    T& back() const { return (*this)[_size - 1]; }
+
+private:
+    T* _data = nullptr;
+    std::size_t _size = 0;
+};
+
+/// Unqualified, ADL-based begin() and end() calls work on ArrayView as on the
+/// standard containers.
+template <typename T>
+T* begin(ArrayView<T> const& view)
+{
+    return view.begin();
+}
+
+template <typename T>
+T* end(ArrayView<T> const& view)
+{
+    return view.end();
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,89 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "AsyncTaskQueue.h"
+
+#include "Error.h"
+
+namespace BaseLib
+{
+AsyncTaskQueue::AsyncTaskQueue(std::size_t const max_queue_size)
+    : _max_queue_size(max_queue_size)
+{
+    if (_max_queue_size == 0)
+    {
+        OGS_FATAL("The maximum queue size must be at least one.");
+    }
+    _worker = std::thread([this]() { run(); });
+}
+
+AsyncTaskQueue::~AsyncTaskQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _queue_changed.notify_all();
+    // The worker finishes all queued tasks before it returns.
+    _worker.join();
+}
+
+std::future<void> AsyncTaskQueue::push(std::function<void()> task)
+{
+    std::packaged_task<void()> packaged_task(std::move(task));
+    auto future = packaged_task.get_future();
+
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _queue_changed.wait(
+            lock, [this]() { return _queue.size() < _max_queue_size; });
+        _queue.push_back(std::move(packaged_task));
+    }
+    _queue_changed.notify_all();
+
+    return future;
+}
+
+void AsyncTaskQueue::waitForAll()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _queue_changed.wait(lock,
+                        [this]() { return _queue.empty() && !_busy; });
+}
+
+void AsyncTaskQueue::run()
+{
+    for (;;)
+    {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _queue_changed.wait(lock,
+                                [this]() { return _stop || !_queue.empty(); });
+            if (_queue.empty())
+            {
+                return;  // Stopped and nothing left to do.
+            }
+            task = std::move(_queue.front());
+            _queue.pop_front();
+            _busy = true;
+        }
+        _queue_changed.notify_all();
+
+        // Exceptions are stored in the task's future.
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _busy = false;
+        }
+        _queue_changed.notify_all();
+    }
+}
+}  // namespace BaseLib
@@ -0,0 +1,62 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace BaseLib
+{
+/// Runs tasks one after another in a dedicated background thread.
+///
+/// The tasks are executed in the order they have been pushed. The number of
+/// queued tasks is bounded; push() blocks until there is space in the queue.
+/// The destructor waits for all queued tasks to finish.
+class AsyncTaskQueue final
+{
+public:
+    /// \param max_queue_size maximum number of tasks waiting for execution,
+    ///                       must be at least one.
+    explicit AsyncTaskQueue(std::size_t const max_queue_size);
+
+    AsyncTaskQueue(AsyncTaskQueue const&) = delete;
+    AsyncTaskQueue& operator=(AsyncTaskQueue const&) = delete;
+
+    ~AsyncTaskQueue();
+
+    /// Adds the given \c task to the queue.
+    ///
+    /// \return a future becoming ready when the task has finished. Exceptions
+    /// thrown by the task are rethrown by its get() method.
+    std::future<void> push(std::function<void()> task);
+
+    /// Blocks until all queued tasks have finished.
+    void waitForAll();
+
+private:
+    void run();
+
+    std::size_t const _max_queue_size;
+
+    std::mutex _mutex;
+    std::condition_variable _queue_changed;
+    std::deque<std::packaged_task<void()>> _queue;
+    //! True while the worker thread executes a task.
+    bool _busy = false;
+    bool _stop = false;
+
+    std::thread _worker;
+};
+}  // namespace BaseLib
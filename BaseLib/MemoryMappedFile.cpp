@@ -0,0 +1,77 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MemoryMappedFile.h"
+
+#include <fstream>
+
+#if !defined(_WIN32) && !defined(__MINGW32__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define OGS_USE_MMAP
+#endif
+
+namespace BaseLib
+{
+MemoryMappedFile::MemoryMappedFile(std::string const& file_name)
+{
+#ifdef OGS_USE_MMAP
+    int const fd = open(file_name.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        return;
+    }
+    struct stat file_status;
+    if (fstat(fd, &file_status) == 0 && file_status.st_size > 0)
+    {
+        _size = static_cast<std::size_t>(file_status.st_size);
+        void* const data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            _data = static_cast<char const*>(data);
+            _is_mapped = true;
+            // Files are usually read front to back.
+            madvise(data, _size, MADV_SEQUENTIAL);
+        }
+    }
+    close(fd);
+    if (_is_mapped)
+    {
+        return;
+    }
+    _size = 0;
+#endif
+
+    std::ifstream is(file_name, std::ios::binary | std::ios::ate);
+    if (!is)
+    {
+        return;
+    }
+    _buffer.resize(static_cast<std::size_t>(is.tellg()));
+    is.seekg(0);
+    if (is.read(_buffer.data(), _buffer.size()))
+    {
+        _data = _buffer.data();
+        _size = _buffer.size();
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+#ifdef OGS_USE_MMAP
+    if (_is_mapped)
+    {
+        munmap(const_cast<char*>(_data), _size);
+    }
+#endif
+}
+
+}  // namespace BaseLib
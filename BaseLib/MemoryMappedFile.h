@@ -0,0 +1,45 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace BaseLib
+{
+/// Read-only view of the whole content of a file.
+///
+/// On POSIX systems the file is memory mapped, otherwise it is read into a
+/// buffer at once. If the file could not be opened, data() returns nullptr.
+class MemoryMappedFile
+{
+public:
+    explicit MemoryMappedFile(std::string const& file_name);
+
+    MemoryMappedFile(MemoryMappedFile const&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+
+    ~MemoryMappedFile();
+
+    char const* data() const { return _data; }
+    std::size_t size() const { return _size; }
+
+    char const* begin() const { return _data; }
+    char const* end() const { return _data + _size; }
+
+private:
+    char const* _data = nullptr;
+    std::size_t _size = 0;
+    bool _is_mapped = false;
+    std::vector<char> _buffer;
+};
+
+}  // namespace BaseLib
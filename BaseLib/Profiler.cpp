@@ -0,0 +1,470 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <tuple>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+#include <logog/include/logog.hpp>
+#include <nlohmann/json.hpp>
+
+namespace
+{
+int rank()
+{
+#ifdef USE_MPI
+    int rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    return rank;
+#else
+    return 0;
+#endif
+}
+
+int numberOfRanks()
+{
+#ifdef USE_MPI
+    int size = 1;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    return size;
+#else
+    return 1;
+#endif
+}
+
+/// Identifies one profiled quantity, e.g., the total time of a scope in a
+/// specific time step. The time step is -1 for the sum over all time steps.
+using Key = std::tuple<std::string /*path*/, long /*time_step*/,
+                       std::string /*quantity*/>;
+
+/// A quantity over all ranks.
+struct Statistics
+{
+    double min;
+    double max;
+    double sum;
+    int ranks;
+
+    double average() const { return sum / ranks; }
+};
+
+using Quantities = std::map<Key, Statistics>;
+
+#ifdef USE_MPI
+std::string serialize(Key const& key)
+{
+    return std::get<0>(key) + '\t' + std::to_string(std::get<1>(key)) + '\t' +
+           std::get<2>(key);
+}
+
+Key deserialize(std::string const& s)
+{
+    auto const first = s.find('\t');
+    auto const second = s.find('\t', first + 1);
+    return Key{s.substr(0, first),
+               std::stol(s.substr(first + 1, second - first - 1)),
+               s.substr(second + 1)};
+}
+
+/// Extends the local summary by the keys of all other ranks and reduces the
+/// values over all ranks.
+Quantities reduce(Quantities const& local)
+{
+    // Gather the union of the keys of all ranks.
+    std::string local_keys;
+    for (auto const& entry : local)
+    {
+        local_keys += serialize(entry.first);
+        local_keys += '\n';
+    }
+
+    int const size = numberOfRanks();
+    int const local_length = static_cast<int>(local_keys.size());
+    std::vector<int> lengths(size);
+    MPI_Allgather(&local_length, 1, MPI_INT, lengths.data(), 1, MPI_INT,
+                  MPI_COMM_WORLD);
+    std::vector<int> offsets(size + 1, 0);
+    std::partial_sum(lengths.begin(), lengths.end(), offsets.begin() + 1);
+    std::vector<char> all_keys(offsets.back());
+    MPI_Allgatherv(local_keys.data(), local_length, MPI_CHAR, all_keys.data(),
+                   lengths.data(), offsets.data(), MPI_CHAR, MPI_COMM_WORLD);
+
+    std::set<Key> keys;
+    std::istringstream is(std::string(all_keys.begin(), all_keys.end()));
+    for (std::string line; std::getline(is, line);)
+    {
+        keys.insert(deserialize(line));
+    }
+
+    // Reduce the values; keys missing on a rank do not contribute.
+    auto const n = keys.size();
+    std::vector<double> min(n, std::numeric_limits<double>::max());
+    std::vector<double> max(n, std::numeric_limits<double>::lowest());
+    std::vector<double> sum(n, 0.0);
+    std::vector<int> ranks(n, 0);
+    std::size_t i = 0;
+    for (auto const& key : keys)
+    {
+        auto const it = local.find(key);
+        if (it != local.end())
+        {
+            min[i] = max[i] = sum[i] = it->second.sum;
+            ranks[i] = 1;
+        }
+        ++i;
+    }
+    MPI_Allreduce(MPI_IN_PLACE, min.data(), n, MPI_DOUBLE, MPI_MIN,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, max.data(), n, MPI_DOUBLE, MPI_MAX,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, sum.data(), n, MPI_DOUBLE, MPI_SUM,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, ranks.data(), n, MPI_INT, MPI_SUM,
+                  MPI_COMM_WORLD);
+
+    Quantities summary;
+    i = 0;
+    for (auto const& key : keys)
+    {
+        summary.emplace_hint(summary.end(), key,
+                             Statistics{min[i], max[i], sum[i], ranks[i]});
+        ++i;
+    }
+    return summary;
+}
+#endif
+
+nlohmann::json toJSON(Statistics const& s)
+{
+    return {{"min", s.min}, {"max", s.max}, {"avg", s.average()}};
+}
+
+void openForWriting(std::ofstream& os, std::string const& file_name)
+{
+    os.open(file_name);
+    if (!os)
+    {
+        ERR("Profiler: Could not open file '%s' for writing.",
+            file_name.c_str());
+    }
+}
+}  // namespace
+
+namespace BaseLib
+{
+Profiler& Profiler::instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler()
+{
+    clear();
+}
+
+void Profiler::enable()
+{
+    if (!_enabled && _scopes.size() == 1 && _trace.empty())
+    {
+        _enable_time = Clock::now();
+    }
+    _enabled = true;
+}
+
+void Profiler::clear()
+{
+    assert(_open_scopes.empty());
+    _scopes.assign(1, Scope{});
+    _scopes.front().parent = 0;
+    _trace.clear();
+    _time_step = 0;
+    _enable_time = Clock::now();
+}
+
+void Profiler::beginScope(char const* const name)
+{
+    auto const parent =
+        _open_scopes.empty() ? std::size_t{0} : _open_scopes.back().first;
+
+    auto const& children = _scopes[parent].children;
+    auto const child =
+        std::find_if(children.begin(), children.end(),
+                     [&](std::size_t const c) { return _scopes[c].name == name; });
+
+    std::size_t scope;
+    if (child != children.end())
+    {
+        scope = *child;
+    }
+    else
+    {
+        scope = _scopes.size();
+        _scopes.emplace_back();
+        _scopes.back().name = name;
+        _scopes.back().parent = parent;
+        _scopes[parent].children.push_back(scope);
+    }
+
+    _open_scopes.emplace_back(scope, Clock::now());
+}
+
+void Profiler::endScope()
+{
+    auto const end = Clock::now();
+    assert(!_open_scopes.empty());
+    auto const open_scope = _open_scopes.back();
+    _open_scopes.pop_back();
+
+    double const duration =
+        std::chrono::duration<double>(end - open_scope.second).count();
+
+    auto& scope = _scopes[open_scope.first];
+    if (scope.calls == 0)
+    {
+        scope.min = duration;
+        scope.max = duration;
+    }
+    else
+    {
+        scope.min = std::min(scope.min, duration);
+        scope.max = std::max(scope.max, duration);
+    }
+    ++scope.calls;
+    scope.total += duration;
+
+    if (scope.time_steps.empty() ||
+        scope.time_steps.back().time_step != _time_step)
+    {
+        scope.time_steps.push_back({_time_step, 0, 0.0});
+    }
+    ++scope.time_steps.back().calls;
+    scope.time_steps.back().total += duration;
+
+    _trace.push_back({open_scope.first, secondsSinceEnable(open_scope.second),
+                      duration, _time_step});
+}
+
+void Profiler::addToCounter(char const* const name, double const value)
+{
+    if (!_enabled)
+    {
+        return;
+    }
+
+    auto& counters =
+        _scopes[_open_scopes.empty() ? 0 : _open_scopes.back().first].counters;
+    auto const counter =
+        std::find_if(counters.begin(), counters.end(),
+                     [&](std::pair<std::string, double> const& c) {
+                         return c.first == name;
+                     });
+    if (counter != counters.end())
+    {
+        counter->second += value;
+    }
+    else
+    {
+        counters.emplace_back(name, value);
+    }
+}
+
+std::string Profiler::path(std::size_t scope) const
+{
+    std::string path = _scopes[scope].name;
+    for (scope = _scopes[scope].parent; scope != 0;
+         scope = _scopes[scope].parent)
+    {
+        path = _scopes[scope].name + '/' + path;
+    }
+    return path;
+}
+
+struct Profiler::Summary
+{
+    Quantities quantities;
+};
+
+Profiler::Summary Profiler::summarize() const
+{
+    Quantities local;
+    auto const add = [&](std::string const& path, long const time_step,
+                         std::string const& quantity, double const value) {
+        local[Key{path, time_step, quantity}] = {value, value, value, 1};
+    };
+
+    for (std::size_t s = 1; s < _scopes.size(); ++s)
+    {
+        auto const& scope = _scopes[s];
+        if (scope.calls == 0 && scope.counters.empty())
+        {
+            continue;  // still open
+        }
+        auto const p = path(s);
+        add(p, -1, "calls", scope.calls);
+        add(p, -1, "total", scope.total);
+        add(p, -1, "min", scope.min);
+        add(p, -1, "max", scope.max);
+        for (auto const& entry : scope.time_steps)
+        {
+            add(p, entry.time_step, "calls", entry.calls);
+            add(p, entry.time_step, "total", entry.total);
+        }
+        for (auto const& counter : scope.counters)
+        {
+            add(p, -1, "counter:" + counter.first, counter.second);
+        }
+    }
+
+#ifdef USE_MPI
+    return {reduce(local)};
+#else
+    return {std::move(local)};
+#endif
+}
+
+void Profiler::writeJSON(std::ostream& os) const
+{
+    auto const summary = summarize();
+
+    nlohmann::json scopes = nlohmann::json::array();
+    std::string current_path;
+    for (auto const& entry : summary.quantities)
+    {
+        auto const& path = std::get<0>(entry.first);
+        auto const time_step = std::get<1>(entry.first);
+        auto const& quantity = std::get<2>(entry.first);
+
+        if (scopes.empty() || path != current_path)
+        {
+            current_path = path;
+            scopes.push_back({{"path", path},
+                              {"counters", nlohmann::json::object()},
+                              {"time_steps", nlohmann::json::array()}});
+        }
+        auto& scope = scopes.back();
+
+        if (time_step >= 0)
+        {
+            auto& time_steps = scope["time_steps"];
+            if (time_steps.empty() ||
+                time_steps.back()["time_step"] != time_step)
+            {
+                time_steps.push_back({{"time_step", time_step}});
+            }
+            time_steps.back()[quantity] = toJSON(entry.second);
+        }
+        else if (quantity.compare(0, 8, "counter:") == 0)
+        {
+            scope["counters"][quantity.substr(8)] = toJSON(entry.second);
+        }
+        else
+        {
+            scope[quantity] = toJSON(entry.second);
+        }
+    }
+
+    nlohmann::json const json = {{"number_of_ranks", numberOfRanks()},
+                                 {"scopes", scopes}};
+    os << json.dump(2) << '\n';
+}
+
+void Profiler::writeCSV(std::ostream& os) const
+{
+    auto const summary = summarize();
+    auto const& q = summary.quantities;
+
+    os << "scope,time_step,calls_min,calls_max,total_min,total_max,total_avg"
+          "\n";
+    for (auto const& entry : q)
+    {
+        auto const& path = std::get<0>(entry.first);
+        auto const time_step = std::get<1>(entry.first);
+        if (std::get<2>(entry.first) != "calls")
+        {
+            continue;
+        }
+        auto const& calls = entry.second;
+        auto const& total = q.at(Key{path, time_step, "total"});
+
+        os << '"' << path << "\","
+           << (time_step < 0 ? std::string("all") : std::to_string(time_step))
+           << ',' << calls.min << ',' << calls.max << ',' << total.min << ','
+           << total.max << ',' << total.average() << '\n';
+    }
+}
+
+void Profiler::writeChromeTrace(std::ostream& os) const
+{
+    // Complete events ("ph": "X") with microsecond time stamps.
+    os << "{\"traceEvents\":[";
+    int const pid = rank();
+    bool first = true;
+    for (auto const& event : _trace)
+    {
+        nlohmann::json const e = {
+            {"name", _scopes[event.scope].name},
+            {"cat", "ogs"},
+            {"ph", "X"},
+            {"pid", pid},
+            {"tid", 0},
+            {"ts", event.begin * 1e6},
+            {"dur", event.duration * 1e6},
+            {"args", {{"path", path(event.scope)},
+                      {"time_step", event.time_step}}}};
+        os << (first ? "\n" : ",\n") << e.dump();
+        first = false;
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void Profiler::write(std::string const& prefix) const
+{
+    {
+        std::ostringstream json;
+        writeJSON(json);
+        std::ostringstream csv;
+        writeCSV(csv);
+
+        if (rank() == 0)
+        {
+            INFO("Writing profiling summary to %s.json and %s.csv.",
+                 prefix.c_str(), prefix.c_str());
+            std::ofstream json_file;
+            openForWriting(json_file, prefix + ".json");
+            json_file << json.str();
+            std::ofstream csv_file;
+            openForWriting(csv_file, prefix + ".csv");
+            csv_file << csv.str();
+        }
+    }
+
+    std::string const trace_file_name =
+        numberOfRanks() == 1
+            ? prefix + "_trace.json"
+            : prefix + "_trace_" + std::to_string(rank()) + ".json";
+    std::ofstream trace_file;
+    openForWriting(trace_file, trace_file_name);
+    writeChromeTrace(trace_file);
+}
+
+}  // namespace BaseLib
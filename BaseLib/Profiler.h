@@ -0,0 +1,177 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace BaseLib
+{
+/// Registry of the run times of nested program phases, e.g., of the assembly
+/// or of the linear solver, and of counters attached to these phases.
+///
+/// Phases are timed by ProfilingScope objects. All scopes of the same name
+/// opened within the same parent scope are accumulated in one entry, which is
+/// additionally broken down by the time step set via setTimeStep(). At the end
+/// of a run the entries are written as JSON and CSV summaries and as a trace
+/// file which can be loaded in Chrome's about:tracing or in Perfetto.
+///
+/// The profiler is disabled by default; then a scope costs a single branch.
+///
+/// \note The profiler is not thread-safe. Scopes must be opened and closed by
+/// the main thread only.
+class Profiler
+{
+public:
+    /// The profiler used by ProfilingScope.
+    static Profiler& instance();
+
+    void enable();
+    void disable() { _enabled = false; }
+    bool isEnabled() const { return _enabled; }
+
+    /// Removes all recorded scopes, counters and trace events.
+    /// \pre No scope is open.
+    void clear();
+
+    /// Subsequent scopes are accounted for the given time step.
+    void setTimeStep(std::size_t const time_step) { _time_step = time_step; }
+
+    /// Opens a scope nested into the currently open one.
+    void beginScope(char const* name);
+
+    /// Closes the most recently opened scope.
+    void endScope();
+
+    /// Adds \c value to the counter \c name of the currently open scope if the
+    /// profiler is enabled.
+    void addToCounter(char const* name, double value);
+
+    /// Writes the summary to \c prefix.json and \c prefix.csv and the trace to
+    /// \c prefix_trace.json.
+    ///
+    /// With MPI the call is collective: the summary aggregates the minimum,
+    /// maximum and average of all ranks and is written by rank zero, while
+    /// each rank writes its trace to \c prefix_trace_<rank>.json.
+    void write(std::string const& prefix) const;
+
+    /// Writes the summary in JSON format, see write(). Collective with MPI.
+    void writeJSON(std::ostream& os) const;
+
+    /// Writes the summary in CSV format, see write(). There is one line per
+    /// scope and time step and one for the sum over all time steps. Collective
+    /// with MPI.
+    void writeCSV(std::ostream& os) const;
+
+    /// Writes all closed scopes of this process in the Chrome trace event
+    /// format.
+    void writeChromeTrace(std::ostream& os) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct TimeStepEntry
+    {
+        std::size_t time_step;
+        std::size_t calls;
+        double total;
+    };
+
+    struct Scope
+    {
+        std::string name;
+        std::size_t parent;
+        std::vector<std::size_t> children;
+
+        std::size_t calls = 0;
+        double total = 0;
+        double min = 0;
+        double max = 0;
+
+        std::vector<TimeStepEntry> time_steps;
+        std::vector<std::pair<std::string, double>> counters;
+    };
+
+    struct TraceEvent
+    {
+        std::size_t scope;
+        double begin;
+        double duration;
+        std::size_t time_step;
+    };
+
+    /// The recorded quantities aggregated over all ranks.
+    struct Summary;
+
+    Profiler();
+
+    /// Aggregates the recorded quantities over all ranks; collective with MPI.
+    Summary summarize() const;
+
+    /// Returns the path of the scope, i.e., the names of the scope and all its
+    /// parents separated by slashes.
+    std::string path(std::size_t scope) const;
+
+    double secondsSinceEnable(Clock::time_point const t) const
+    {
+        return std::chrono::duration<double>(t - _enable_time).count();
+    }
+
+    bool _enabled = false;
+    std::size_t _time_step = 0;
+    Clock::time_point _enable_time;
+
+    /// The scope tree; the first entry is the unnamed root.
+    std::vector<Scope> _scopes;
+
+    /// The open scopes and the times when they were opened.
+    std::vector<std::pair<std::size_t, Clock::time_point>> _open_scopes;
+
+    std::vector<TraceEvent> _trace;
+};
+
+/// Times the enclosing block as a nested scope of the Profiler::instance().
+class ProfilingScope final
+{
+public:
+    explicit ProfilingScope(char const* name)
+        : _active(Profiler::instance().isEnabled())
+    {
+        if (_active)
+        {
+            Profiler::instance().beginScope(name);
+        }
+    }
+
+    explicit ProfilingScope(std::string const& name)
+        : ProfilingScope(name.c_str())
+    {
+    }
+
+    ProfilingScope(ProfilingScope const&) = delete;
+    ProfilingScope& operator=(ProfilingScope const&) = delete;
+
+    ~ProfilingScope()
+    {
+        if (_active)
+        {
+            Profiler::instance().endScope();
+        }
+    }
+
+private:
+    bool const _active;
+};
+
+}  // namespace BaseLib
@@ -0,0 +1,164 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TextParsing.h"
+
+#include <cstdint>
+#include <locale>
+#include <sstream>
+
+namespace
+{
+bool isDigit(char const c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/// Conversion of the number by the standard library for all cases which are
+/// not handled by the fast path.
+bool parseDoubleSlow(char const* const first, char const* const last,
+                     double& value)
+{
+    std::istringstream is(std::string(first, last));
+    is.imbue(std::locale::classic());
+    return static_cast<bool>(is >> value);
+}
+}  // namespace
+
+namespace BaseLib
+{
+bool parseDouble(char const*& first, char const* const last, double& value)
+{
+    char const* p = skipBlanks(first, last);
+    char const* const number_begin = p;
+
+    bool negative = false;
+    if (p != last && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        ++p;
+    }
+
+    // Up to 19 significant decimal digits fit into the mantissa; further
+    // digits only shift the exponent.
+    std::uint64_t mantissa = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    bool is_truncated = false;
+    for (; p != last && isDigit(*p); ++p)
+    {
+        has_digits = true;
+        if (significant_digits < 19)
+        {
+            mantissa = 10 * mantissa + static_cast<unsigned>(*p - '0');
+            significant_digits += mantissa != 0;
+        }
+        else
+        {
+            ++exponent;
+            is_truncated |= *p != '0';
+        }
+    }
+    if (p != last && *p == '.')
+    {
+        ++p;
+        for (; p != last && isDigit(*p); ++p)
+        {
+            has_digits = true;
+            if (significant_digits < 19)
+            {
+                mantissa = 10 * mantissa + static_cast<unsigned>(*p - '0');
+                significant_digits += mantissa != 0;
+                --exponent;
+            }
+            else
+            {
+                is_truncated |= *p != '0';
+            }
+        }
+    }
+    if (!has_digits)
+    {
+        // Special values like "inf" or "nan" are not handled.
+        return false;
+    }
+
+    if (p != last && (*p == 'e' || *p == 'E'))
+    {
+        char const* q = p + 1;
+        bool negative_exponent = false;
+        if (q != last && (*q == '-' || *q == '+'))
+        {
+            negative_exponent = *q == '-';
+            ++q;
+        }
+        if (q != last && isDigit(*q))
+        {
+            int e = 0;
+            for (; q != last && isDigit(*q); ++q)
+            {
+                if (e < 100000)
+                {
+                    e = 10 * e + (*q - '0');
+                }
+            }
+            exponent += negative_exponent ? -e : e;
+            p = q;
+        }
+    }
+
+    // Both the mantissa and the power of ten are exactly representable, hence
+    // a single, correctly rounded operation yields the correctly rounded
+    // result.
+    static double const powers_of_ten[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    if (mantissa == 0 && !is_truncated)
+    {
+        value = negative ? -0.0 : 0.0;
+    }
+    else if (!is_truncated && mantissa <= (std::uint64_t{1} << 53) &&
+             exponent >= -22 && exponent <= 22)
+    {
+        auto const m = static_cast<double>(mantissa);
+        value = exponent < 0 ? m / powers_of_ten[-exponent]
+                             : m * powers_of_ten[exponent];
+        if (negative)
+        {
+            value = -value;
+        }
+    }
+    else if (!parseDoubleSlow(number_begin, p, value))
+    {
+        return false;
+    }
+
+    first = p;
+    return true;
+}
+
+bool parseWord(char const*& first, char const* const last, std::string& word)
+{
+    char const* const word_begin = skipBlanks(first, last);
+    char const* word_end = word_begin;
+    while (word_end != last && !isBlank(*word_end) && *word_end != '\n')
+    {
+        ++word_end;
+    }
+    if (word_end == word_begin)
+    {
+        return false;
+    }
+    word.assign(word_begin, word_end);
+    first = word_end;
+    return true;
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,219 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/// Locale independent parsing of text held in memory, e.g., in a
+/// BaseLib::MemoryMappedFile.
+///
+/// The parse functions skip leading blanks (spaces, tabs and carriage
+/// returns, but not line breaks), read one value from the range
+/// <tt>[first, last)</tt> and advance \c first behind it. If no value could be
+/// read, false is returned and \c first is left unchanged.
+namespace BaseLib
+{
+inline bool isBlank(char const c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline char const* skipBlanks(char const* first, char const* const last)
+{
+    while (first != last && isBlank(*first))
+    {
+        ++first;
+    }
+    return first;
+}
+
+/// Returns the beginning of the line following the one \c first points into,
+/// or \c last.
+inline char const* nextLine(char const* const first, char const* const last)
+{
+    auto const* const line_end = std::find(first, last, '\n');
+    return line_end == last ? last : line_end + 1;
+}
+
+/// Returns the beginning of the first occurrence of \c keyword in
+/// <tt>[first, last)</tt> or \c last.
+inline char const* findKeyword(char const* const first,
+                               char const* const last,
+                               std::string const& keyword)
+{
+    return std::search(first, last, keyword.begin(), keyword.end());
+}
+
+/// Reads a floating point number in the format of \c std::strtod without
+/// hexadecimal floats. Numbers which are exactly representable in a few
+/// operations, which are almost all numbers written with up to 15 significant
+/// digits, are converted directly; all others fall back to the standard
+/// library in the classic "C" locale. The result is correctly rounded in both
+/// cases.
+bool parseDouble(char const*& first, char const* last, double& value);
+
+/// Reads a decimal integer. Values not representable by \c Integer are
+/// rejected.
+template <typename Integer>
+bool parseInteger(char const*& first, char const* const last, Integer& value)
+{
+    static_assert(std::is_integral<Integer>::value,
+                  "parseInteger() requires an integral type.");
+    using Unsigned = std::make_unsigned_t<Integer>;
+
+    char const* p = skipBlanks(first, last);
+    bool negative = false;
+    if (p != last && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        if (negative && !std::is_signed<Integer>::value)
+        {
+            return false;
+        }
+        ++p;
+    }
+
+    Unsigned const max_value =
+        negative ? static_cast<Unsigned>(
+                       -(std::numeric_limits<Integer>::min() + 1)) + 1
+                 : static_cast<Unsigned>(std::numeric_limits<Integer>::max());
+    Unsigned result = 0;
+    char const* const digits_begin = p;
+    for (; p != last && *p >= '0' && *p <= '9'; ++p)
+    {
+        auto const digit = static_cast<Unsigned>(*p - '0');
+        if (result > (max_value - digit) / 10)
+        {
+            return false;
+        }
+        result = result * 10 + digit;
+    }
+    if (p == digits_begin)
+    {
+        return false;
+    }
+
+    value = negative ? static_cast<Integer>(-static_cast<Integer>(result - 1) -
+                                            1)
+                     : static_cast<Integer>(result);
+    first = p;
+    return true;
+}
+
+/// Reads a sequence of non-blank characters.
+bool parseWord(char const*& first, char const* last, std::string& word);
+
+/// Calls <tt>parse_line(line_first, line_last, line_number)</tt> for each of
+/// the first \c number_of_lines non-blank lines in <tt>[first, last)</tt>.
+/// The line number counts non-blank lines only and starts with zero; further
+/// lines are ignored.
+///
+/// The range is split into chunks on line boundaries and the chunks are
+/// processed by parallel OpenMP threads, if available. Therefore \c parse_line
+/// must be safe to be called concurrently for different lines and must not
+/// throw.
+///
+/// \return false if there are less than \c number_of_lines non-blank lines or
+/// if \c parse_line returned false for any line.
+template <typename LineParser>
+bool parseLinesInParallel(char const* const first, char const* const last,
+                          std::size_t const number_of_lines,
+                          LineParser const& parse_line)
+{
+    auto const is_blank_line = [](char const* const line_first,
+                                  char const* const line_last) {
+        return std::all_of(line_first, line_last, [](char const c) {
+            return isBlank(c) || c == '\n';
+        });
+    };
+
+    // Small chunks keep the threads busy; very small ones do not pay off.
+    std::size_t const min_chunk_size = 1 << 16;
+#ifdef _OPENMP
+    std::size_t const max_number_of_chunks = 4 * omp_get_max_threads();
+#else
+    std::size_t const max_number_of_chunks = 1;
+#endif
+    auto const size = static_cast<std::size_t>(last - first);
+    std::size_t const number_of_chunks = std::max<std::size_t>(
+        1, std::min(max_number_of_chunks, size / min_chunk_size));
+
+    std::vector<char const*> chunk_begins(number_of_chunks + 1, last);
+    chunk_begins[0] = first;
+    for (std::size_t c = 1; c < number_of_chunks; ++c)
+    {
+        chunk_begins[c] =
+            std::max(chunk_begins[c - 1],
+                     nextLine(first + c * size / number_of_chunks - 1, last));
+    }
+
+    // The number of lines per chunk determines the first line number of each
+    // chunk.
+    std::vector<std::size_t> first_line_numbers(number_of_chunks + 1, 0);
+    auto const n_chunks = static_cast<long>(number_of_chunks);
+#pragma omp parallel for
+    for (long c = 0; c < n_chunks; ++c)
+    {
+        std::size_t n_lines = 0;
+        for (auto const* line = chunk_begins[c]; line != chunk_begins[c + 1];)
+        {
+            auto const* const line_end = nextLine(line, chunk_begins[c + 1]);
+            if (!is_blank_line(line, line_end))
+            {
+                ++n_lines;
+            }
+            line = line_end;
+        }
+        first_line_numbers[c + 1] = n_lines;
+    }
+    for (std::size_t c = 0; c < number_of_chunks; ++c)
+    {
+        first_line_numbers[c + 1] += first_line_numbers[c];
+    }
+    if (first_line_numbers.back() < number_of_lines)
+    {
+        return false;
+    }
+
+    std::atomic<bool> success{true};
+#pragma omp parallel for
+    for (long c = 0; c < n_chunks; ++c)
+    {
+        std::size_t line_number = first_line_numbers[c];
+        for (auto const* line = chunk_begins[c];
+             line != chunk_begins[c + 1] && line_number < number_of_lines &&
+             success.load();)
+        {
+            auto const* const line_end = nextLine(line, chunk_begins[c + 1]);
+            if (!is_blank_line(line, line_end))
+            {
+                if (!parse_line(line, line_end, line_number))
+                {
+                    success = false;
+                }
+                ++line_number;
+            }
+            line = line_end;
+        }
+    }
+    return success;
+}
+
+}  // namespace BaseLib
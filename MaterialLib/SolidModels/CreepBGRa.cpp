@@ -11,6 +11,7 @@
 
 #include "CreepBGRa.h"
 
+#include <array>
 #include <limits>
 
 #include "BaseLib/Error.h"
@@ -40,6 +41,78 @@ CreepBGRa<DisplacementDim>::integrateStress(
     typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
     /*material_state_variables*/,
     double const T) const
+{
+    EvaluatedProperties const properties{this->_mp.lambda(t, x),
+                                         this->_mp.mu(t, x),
+                                         _a(t, x)[0],
+                                         _n(t, x)[0],
+                                         _sigma_f(t, x)[0],
+                                         _q(t, x)[0]};
+
+    KelvinVector sigma;
+    KelvinMatrix tangentStiffness;
+    if (!integrateStressWithProperties(properties, dt, eps_prev, eps,
+                                       sigma_prev, T, sigma, tangentStiffness))
+    {
+        return {};
+    }
+
+    return {std::make_tuple(sigma, createMaterialStateVariables(),
+                            tangentStiffness)};
+}
+
+template <int DisplacementDim>
+bool CreepBGRa<DisplacementDim>::integrateStressBatch(
+    double const t, MeshLib::Element const& element, double const dt,
+    typename MechanicsBase<DisplacementDim>::StressBatch& batch,
+    double const T) const
+{
+    using Elastic = LinearElasticIsotropic<DisplacementDim>;
+    using MaterialStateVariables = typename Elastic::MaterialStateVariables;
+
+    auto const n_integration_points = batch.size();
+
+    // The parameters are evaluated for all integration points at once.
+    thread_local std::vector<double> parameter_values;
+    std::array<Parameter const*, 6> const parameters = {
+        {&this->_mp.youngs_modulus(), &this->_mp.poissons_ratio(), &_a, &_n,
+         &_sigma_f, &_q}};
+    this->evaluateParametersOnElement(parameters, element, n_integration_points,
+                                      t, parameter_values);
+
+    for (std::size_t ip = 0; ip < n_integration_points; ++ip)
+    {
+        auto const* const values = parameter_values.data() + ip;
+        auto const n = n_integration_points;
+        double const E = values[0];
+        double const nu = values[n];
+        EvaluatedProperties const properties{
+            Elastic::MaterialProperties::lambda(E, nu),
+            Elastic::MaterialProperties::mu(E, nu),
+            values[2 * n],
+            values[3 * n],
+            values[4 * n],
+            values[5 * n]};
+
+        // The model has no internal state.
+        batch.template newMaterialStateVariables<MaterialStateVariables>(ip);
+
+        if (!integrateStressWithProperties(
+                properties, dt, batch.eps_prev[ip], batch.eps[ip],
+                batch.sigma_prev[ip], T, batch.sigma[ip], batch.C[ip]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <int DisplacementDim>
+bool CreepBGRa<DisplacementDim>::integrateStressWithProperties(
+    EvaluatedProperties const& properties, double const dt,
+    KelvinVector const& eps_prev, KelvinVector const& eps,
+    KelvinVector const& sigma_prev, double const T, KelvinVector& sigma,
+    KelvinMatrix& tangentStiffness) const
 {
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
 
@@ -47,7 +120,7 @@ CreepBGRa<DisplacementDim>::integrateStress(
                                    Eigen::RowMajor>>
         linear_solver;
 
-    const auto C = this->getElasticTensor(t, x, T);
+    const auto C = this->getElasticTensor(properties.lambda, properties.mu);
     KelvinVector sigma_try = sigma_prev + C * (eps - eps_prev);
 
     auto const& deviatoric_matrix = Invariants::deviatoric_projection;
@@ -57,22 +130,23 @@ CreepBGRa<DisplacementDim>::integrateStress(
     // In case |s_{try}| is zero and _n < 3 (rare case).
     if (norm_s_try < std::numeric_limits<double>::epsilon() * C(0, 0))
     {
-        return {std::make_tuple(sigma_try, createMaterialStateVariables(), C)};
+        sigma = sigma_try;
+        tangentStiffness = C;
+        return true;
     }
 
     ResidualVectorType solution = sigma_try;
 
-    const double A = _a(t, x)[0];
-    const double n = _n(t, x)[0];
-    const double sigma0 = _sigma_f(t, x)[0];
-    const double Q = _q(t, x)[0];
+    const double n = properties.n;
 
     const double constant_coefficient =
-        getCreepConstantCoefficient(A, n, sigma0);
+        getCreepConstantCoefficient(properties.A, n, properties.sigma0);
 
     const double b =
         dt * constant_coefficient *
-        std::exp(-Q / (MaterialLib::PhysicalConstant::IdealGasConstant * T));
+        std::exp(-properties.Q /
+                 (MaterialLib::PhysicalConstant::IdealGasConstant * T));
+    double const G2b = 2.0 * b * properties.mu;
 
     // In newton_solver.solve(), the Jacobian is calculated first, and then
     // then comes the assembly of the residue vector. In order to save
@@ -89,7 +163,6 @@ CreepBGRa<DisplacementDim>::integrateStress(
         // side effect
         s_n1 = deviatoric_matrix * solution;
         double const norm_s_n1 = Invariants::FrobeniusNorm(s_n1);
-        double const G2b = 2.0 * b * this->_mp.mu(t, x);
         // side effect
         pow_norm_s_n1_n_minus_one_2b_G = G2b * std::pow(norm_s_n1, n - 1);
         jacobian = KelvinMatrix::Identity() +
@@ -118,16 +191,18 @@ CreepBGRa<DisplacementDim>::integrateStress(
     auto const success_iterations = newton_solver.solve(jacobian);
 
     if (!success_iterations)
-        return {};
+        return false;
 
     // If *success_iterations>0, tangentStiffness = J_(sigma)^{-1}C
     // where J_(sigma) is the Jacobian of the last local Newton-Raphson
     // iteration, which is already LU decomposed.
-    KelvinMatrix tangentStiffness =
-        (*success_iterations == 0) ? C : linear_solver.solve(C);
+    if (*success_iterations == 0)
+        tangentStiffness = C;
+    else
+        tangentStiffness.noalias() = linear_solver.solve(C);
+    sigma = solution;
 
-    return {std::make_tuple(solution, createMaterialStateVariables(),
-                            tangentStiffness)};
+    return true;
 }
 
 template <int DisplacementDim>
@@ -87,6 +87,11 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressBatch(
+        double const t, MeshLib::Element const& element, double const dt,
+        typename MechanicsBase<DisplacementDim>::StressBatch& batch,
+        double const T) const override;
+
     ConstitutiveModel getConstitutiveModel() const override
     {
         return ConstitutiveModel::CreepBGRa;
@@ -97,6 +102,28 @@ public:
         double const T, double const deviatoric_stress_norm) const override;
 
 private:
+    /// Parameters of the model evaluated at an integration point.
+    struct EvaluatedProperties
+    {
+        double lambda;  ///< Lamé's first parameter.
+        double mu;      ///< Shear modulus.
+        double A;
+        double n;
+        double sigma0;
+        double Q;
+    };
+
+    /// Computes the stress \c sigma and the tangent \c C with the
+    /// parameters already evaluated.
+    /// Returns false if the local Newton iterations did not converge.
+    bool integrateStressWithProperties(EvaluatedProperties const& properties,
+                                       double const dt,
+                                       KelvinVector const& eps_prev,
+                                       KelvinVector const& eps,
+                                       KelvinVector const& sigma_prev,
+                                       double const T, KelvinVector& sigma,
+                                       KelvinMatrix& tangentStiffness) const;
+
     NumLib::NewtonRaphsonSolverParameters const _nonlinear_solver_parameters;
 
     Parameter const& _a;        /// A parameter determined by experiment.
@@ -483,9 +483,71 @@ SolidEhlers<DisplacementDim>::integrateStress(
     assert(dynamic_cast<StateVariables<DisplacementDim> const*>(
                &material_state_variables) != nullptr);
 
-    StateVariables<DisplacementDim> state =
+    auto state = std::make_unique<StateVariables<DisplacementDim>>(
         static_cast<StateVariables<DisplacementDim> const&>(
-            material_state_variables);
+            material_state_variables));
+
+    KelvinVector sigma;
+    KelvinMatrix tangentStiffness;
+    // do the evaluation once per function call.
+    if (!integrateStressWithProperties(MaterialProperties(t, x, _mp), dt,
+                                       eps_prev, eps, sigma_prev, *state, sigma,
+                                       tangentStiffness))
+    {
+        return {};
+    }
+
+    return {std::make_tuple(
+        sigma,
+        std::unique_ptr<
+            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
+            std::move(state)},
+        tangentStiffness)};
+}
+
+template <int DisplacementDim>
+bool SolidEhlers<DisplacementDim>::integrateStressBatch(
+    double const t, MeshLib::Element const& element, double const dt,
+    typename MechanicsBase<DisplacementDim>::StressBatch& batch,
+    double const /*T*/) const
+{
+    auto const n_integration_points = batch.size();
+
+    // The parameters are evaluated for all integration points at once.
+    thread_local std::vector<double> parameter_values;
+    this->evaluateParametersOnElement(_mp.parameters(), element,
+                                      n_integration_points, t,
+                                      parameter_values);
+
+    for (std::size_t ip = 0; ip < n_integration_points; ++ip)
+    {
+        assert(dynamic_cast<StateVariables<DisplacementDim> const*>(
+                   batch.material_state_variables[ip]) != nullptr);
+
+        auto& state = batch.template newMaterialStateVariables<
+            StateVariables<DisplacementDim>>(ip);
+        state = static_cast<StateVariables<DisplacementDim> const&>(
+            *batch.material_state_variables[ip]);
+
+        MaterialProperties const mp(parameter_values.data() + ip,
+                                    n_integration_points);
+        if (!integrateStressWithProperties(
+                mp, dt, batch.eps_prev[ip], batch.eps[ip], batch.sigma_prev[ip],
+                state, batch.sigma[ip], batch.C[ip]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <int DisplacementDim>
+bool SolidEhlers<DisplacementDim>::integrateStressWithProperties(
+    MaterialProperties const& mp, double const dt, KelvinVector const& eps_prev,
+    KelvinVector const& eps, KelvinVector const& sigma_prev,
+    StateVariables<DisplacementDim>& state, KelvinVector& sigma_final,
+    KelvinMatrix& tangentStiffness) const
+{
     state.setInitialConditions();
 
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
@@ -497,13 +559,9 @@ SolidEhlers<DisplacementDim>::integrateStress(
     // deviatoric strain
     KelvinVector const eps_D = P_dev * eps;
 
-    // do the evaluation once per function call.
-    MaterialProperties const mp(t, x, _mp);
-
     KelvinVector sigma = predict_sigma<DisplacementDim>(mp.G, mp.K, sigma_prev,
                                                         eps, eps_prev, eps_V);
 
-    KelvinMatrix tangentStiffness;
 
     PhysicalStressWithInvariants<DisplacementDim> s{mp.G * sigma};
     // Quit early if sigma is zero (nothing to do) or if we are still in elastic
@@ -596,7 +654,7 @@ SolidEhlers<DisplacementDim>::integrateStress(
             auto const success_iterations = newton_solver.solve(jacobian);
 
             if (!success_iterations)
-                return {};
+                return false;
 
             // If the Newton loop didn't run, the linear solver will not be
             // initialized.
@@ -624,15 +682,8 @@ SolidEhlers<DisplacementDim>::integrateStress(
                 .template block<KelvinVectorSize, KelvinVectorSize>(0, 0);
     }
 
-    KelvinVector sigma_final = mp.G * sigma;
-
-    return {std::make_tuple(
-        sigma_final,
-        std::unique_ptr<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
-            new StateVariables<DisplacementDim>{
-                static_cast<StateVariables<DisplacementDim> const&>(state)}},
-        tangentStiffness)};
+    sigma_final.noalias() = mp.G * sigma;
+    return true;
 }
 
 template <int DisplacementDim>
@@ -18,12 +18,14 @@
 
 #pragma once
 
+#include <array>
 #ifndef NDEBUG
 #include <ostream>
 #endif
 
 #include "BaseLib/Error.h"
 #include "MathLib/KelvinVector.h"
+#include "NumLib/Checkpoint.h"
 #include "NumLib/NewtonRaphson.h"
 #include "ProcessLib/Parameter/Parameter.h"
 
@@ -89,6 +91,14 @@ struct MaterialPropertiesParameters
 
     P const& kappa;  ///< hardening parameter
     P const& hardening_coefficient;
+
+    /// The parameters in the order of the members of MaterialProperties.
+    std::array<P const*, 16> parameters() const
+    {
+        return {{&G, &K, &alpha, &beta, &gamma, &delta, &epsilon, &m,
+                 &alpha_p, &beta_p, &gamma_p, &delta_p, &epsilon_p, &m_p,
+                 &kappa, &hardening_coefficient}};
+    }
 };
 
 struct DamagePropertiesParameters
@@ -123,6 +133,30 @@ struct MaterialProperties final
           hardening_coefficient(mp.hardening_coefficient(t, x)[0])
     {
     }
+
+    /// Constructs the properties from already evaluated parameters, the k-th
+    /// parameter of MaterialPropertiesParameters::parameters() being
+    /// <tt>values[k * stride]</tt>.
+    MaterialProperties(double const* const values, std::size_t const stride)
+        : G(values[0]),
+          K(values[stride]),
+          alpha(values[2 * stride]),
+          beta(values[3 * stride]),
+          gamma(values[4 * stride]),
+          delta(values[5 * stride]),
+          epsilon(values[6 * stride]),
+          m(values[7 * stride]),
+          alpha_p(values[8 * stride]),
+          beta_p(values[9 * stride]),
+          gamma_p(values[10 * stride]),
+          delta_p(values[11 * stride]),
+          epsilon_p(values[12 * stride]),
+          m_p(values[13 * stride]),
+          kappa(values[14 * stride]),
+          hardening_coefficient(values[15 * stride])
+    {
+    }
+
     double const G;
     double const K;
 
@@ -218,6 +252,39 @@ struct StateVariables
         damage_prev = damage;
     }
 
+    void writeCheckpoint(std::ostream& os) const override
+    {
+        for (auto const* const state : {&eps_p, &eps_p_prev})
+        {
+            NumLib::writeCheckpointMatrix(os, state->D);
+            NumLib::writeCheckpointValue(os, state->V);
+            NumLib::writeCheckpointValue(os, state->eff);
+        }
+        for (auto const* const state : {&damage, &damage_prev})
+        {
+            NumLib::writeCheckpointValue(os, state->kappa_d());
+            NumLib::writeCheckpointValue(os, state->value());
+        }
+    }
+
+    void readCheckpoint(std::istream& is) override
+    {
+        for (auto* const state : {&eps_p, &eps_p_prev})
+        {
+            NumLib::readCheckpointMatrix(is, state->D);
+            NumLib::readCheckpointValue(is, state->V);
+            NumLib::readCheckpointValue(is, state->eff);
+        }
+        for (auto* const state : {&damage, &damage_prev})
+        {
+            double kappa_d;
+            double value;
+            NumLib::readCheckpointValue(is, kappa_d);
+            NumLib::readCheckpointValue(is, value);
+            *state = Damage{kappa_d, value};
+        }
+    }
+
     using KelvinVector =
         MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
 
@@ -321,6 +388,11 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressBatch(
+        double const t, MeshLib::Element const& element, double const dt,
+        typename MechanicsBase<DisplacementDim>::StressBatch& batch,
+        double const T) const override;
+
     std::vector<typename MechanicsBase<DisplacementDim>::InternalVariable>
     getInternalVariables() const override;
 
@@ -337,6 +409,19 @@ public:
     }
 
 private:
+    /// Computes the stress \c sigma, the tangent \c C and the new \c state
+    /// with the material properties already evaluated. On input \c state
+    /// holds the material state of the previous iteration.
+    /// Returns false if the local Newton iterations did not converge.
+    bool integrateStressWithProperties(MaterialProperties const& mp,
+                                       double const dt,
+                                       KelvinVector const& eps_prev,
+                                       KelvinVector const& eps,
+                                       KelvinVector const& sigma_prev,
+                                       StateVariables<DisplacementDim>& state,
+                                       KelvinVector& sigma_final,
+                                       KelvinMatrix& tangentStiffness) const;
+
     NumLib::NewtonRaphsonSolverParameters const _nonlinear_solver_parameters;
 
     MaterialPropertiesParameters _mp;
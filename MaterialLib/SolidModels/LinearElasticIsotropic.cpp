@@ -46,11 +46,19 @@ typename LinearElasticIsotropic<DisplacementDim>::KelvinMatrix
 LinearElasticIsotropic<DisplacementDim>::getElasticTensor(
     double const t, ProcessLib::SpatialPosition const& x,
     double const /*T*/) const
+{
+    return getElasticTensor(_mp.lambda(t, x), _mp.mu(t, x));
+}
+
+template <int DisplacementDim>
+typename LinearElasticIsotropic<DisplacementDim>::KelvinMatrix
+LinearElasticIsotropic<DisplacementDim>::getElasticTensor(double const lambda,
+                                                          double const mu)
 {
     KelvinMatrix C = KelvinMatrix::Zero();
 
-    C.template topLeftCorner<3, 3>().setConstant(_mp.lambda(t, x));
-    C.noalias() += 2 * _mp.mu(t, x) * KelvinMatrix::Identity();
+    C.template topLeftCorner<3, 3>().setConstant(lambda);
+    C.noalias() += 2 * mu * KelvinMatrix::Identity();
 
     return C;
 }
@@ -35,16 +35,27 @@ public:
         /// Lamé's first parameter.
         double lambda(double const t, X const& x) const
         {
-            return _youngs_modulus(t, x)[0] * _poissons_ratio(t, x)[0] /
-                   (1 + _poissons_ratio(t, x)[0]) /
-                   (1 - 2 * _poissons_ratio(t, x)[0]);
+            return lambda(_youngs_modulus(t, x)[0], _poissons_ratio(t, x)[0]);
         }
 
         /// Lamé's second parameter, the shear modulus.
         double mu(double const t, X const& x) const
         {
-            return _youngs_modulus(t, x)[0] /
-                   (2 * (1 + _poissons_ratio(t, x)[0]));
+            return mu(_youngs_modulus(t, x)[0], _poissons_ratio(t, x)[0]);
+        }
+
+        /// Lamé's first parameter for the given Young's modulus \c E and
+        /// Poisson's ratio \c nu.
+        static double lambda(double const E, double const nu)
+        {
+            return E * nu / (1 + nu) / (1 - 2 * nu);
+        }
+
+        /// Lamé's second parameter for the given Young's modulus \c E and
+        /// Poisson's ratio \c nu.
+        static double mu(double const E, double const nu)
+        {
+            return E / (2 * (1 + nu));
         }
 
         /// the bulk modulus.
@@ -54,6 +65,9 @@ public:
                    (3 * (1 - 2 * _poissons_ratio(t, x)[0]));
         }
 
+        P const& youngs_modulus() const { return _youngs_modulus; }
+        P const& poissons_ratio() const { return _poissons_ratio; }
+
     private:
         P const& _youngs_modulus;
         P const& _poissons_ratio;
@@ -124,6 +138,9 @@ public:
                                   ProcessLib::SpatialPosition const& x,
                                   double const T) const;
 
+    /// The elasticity tensor for the given Lamé parameters.
+    static KelvinMatrix getElasticTensor(double const lambda, double const mu);
+
 
     MaterialProperties getMaterialProperties() { return _mp; }
 protected:
@@ -80,17 +80,77 @@ Lubby2<DisplacementDim>::integrateStress(
         material_state_variables,
     double const /*T*/) const
 {
-    using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
-
     assert(dynamic_cast<MaterialStateVariables const*>(
                &material_state_variables) != nullptr);
-    MaterialStateVariables state(
+    auto state = std::make_unique<MaterialStateVariables>(
         static_cast<MaterialStateVariables const&>(material_state_variables));
-    state.setInitialConditions();
 
     auto local_lubby2_properties =
         detail::LocalLubby2Properties<DisplacementDim>{t, x, _mp};
 
+    KelvinVector sigma;
+    KelvinMatrix C;
+    if (!integrateStressWithProperties(local_lubby2_properties, dt, eps,
+                                       *state, sigma, C))
+    {
+        return {};
+    }
+
+    return {std::make_tuple(
+        sigma,
+        std::unique_ptr<
+            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
+            std::move(state)},
+        C)};
+}
+
+template <int DisplacementDim>
+bool Lubby2<DisplacementDim>::integrateStressBatch(
+    double const t, MeshLib::Element const& element, double const dt,
+    typename MechanicsBase<DisplacementDim>::StressBatch& batch,
+    double const /*T*/) const
+{
+    auto const n_integration_points = batch.size();
+
+    // The parameters are evaluated for all integration points at once.
+    thread_local std::vector<double> parameter_values;
+    this->evaluateParametersOnElement(_mp.parameters(), element,
+                                      n_integration_points, t,
+                                      parameter_values);
+
+    for (std::size_t ip = 0; ip < n_integration_points; ++ip)
+    {
+        assert(dynamic_cast<MaterialStateVariables const*>(
+                   batch.material_state_variables[ip]) != nullptr);
+
+        auto& state =
+            batch.template newMaterialStateVariables<MaterialStateVariables>(
+                ip);
+        state = static_cast<MaterialStateVariables const&>(
+            *batch.material_state_variables[ip]);
+
+        detail::LocalLubby2Properties<DisplacementDim> local_lubby2_properties{
+            parameter_values.data() + ip, n_integration_points};
+        if (!integrateStressWithProperties(local_lubby2_properties, dt,
+                                           batch.eps[ip], state,
+                                           batch.sigma[ip], batch.C[ip]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <int DisplacementDim>
+bool Lubby2<DisplacementDim>::integrateStressWithProperties(
+    detail::LocalLubby2Properties<DisplacementDim>& local_lubby2_properties,
+    double const dt, KelvinVector const& eps, MaterialStateVariables& state,
+    KelvinVector& sigma, KelvinMatrix& C) const
+{
+    using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
+
+    state.setInitialConditions();
+
     // calculation of deviatoric parts
     auto const& P_dev = Invariants::deviatoric_projection;
     KelvinVector const epsd_i = P_dev * eps;
@@ -134,7 +194,7 @@ Lubby2<DisplacementDim>::integrateStress(
 
         auto const update_jacobian = [&](LocalJacobianMatrix& jacobian) {
             calculateJacobianBurgers(
-                t, x, dt, jacobian, sig_eff, sigd_j, state.eps_K_j,
+                dt, jacobian, sig_eff, sigd_j, state.eps_K_j,
                 local_lubby2_properties);  // for solution dependent Jacobians
         };
 
@@ -165,7 +225,7 @@ Lubby2<DisplacementDim>::integrateStress(
         auto const success_iterations = newton_solver.solve(K_loc);
 
         if (!success_iterations)
-            return {};
+            return false;
 
         // If the Newton loop didn't run, the linear solver will not be
         // initialized.
@@ -174,22 +234,16 @@ Lubby2<DisplacementDim>::integrateStress(
             linear_solver.compute(K_loc);
     }
 
-    KelvinMatrix C =
-        tangentStiffnessA<DisplacementDim>(local_lubby2_properties.GM0,
+    C = tangentStiffnessA<DisplacementDim>(local_lubby2_properties.GM0,
                                            local_lubby2_properties.KM0,
                                            linear_solver);
 
     // Hydrostatic part for the stress and the tangent.
     double const eps_i_trace = Invariants::trace(eps);
-    KelvinVector const sigma =
+    sigma.noalias() =
         local_lubby2_properties.GM0 * sigd_j +
         local_lubby2_properties.KM0 * eps_i_trace * Invariants::identity2;
-    return {std::make_tuple(
-        sigma,
-        std::unique_ptr<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
-            new MaterialStateVariables{state}},
-        C)};
+    return true;
 }
 
 template <int DisplacementDim>
@@ -222,8 +276,6 @@ void Lubby2<DisplacementDim>::calculateResidualBurgers(
 
 template <int DisplacementDim>
 void Lubby2<DisplacementDim>::calculateJacobianBurgers(
-    double const t,
-    ProcessLib::SpatialPosition const& x,
     const double dt,
     JacobianMatrix& Jac,
     double s_eff,
@@ -257,9 +309,9 @@ void Lubby2<DisplacementDim>::calculateJacobianBurgers(
             1. / (properties.etaK * properties.etaK) *
             (properties.GM0 * sig_i - 2. * properties.GK * eps_K_i);
 
-        KelvinVector const dG_K = 1.5 * _mp.mK(t, x)[0] * properties.GK *
+        KelvinVector const dG_K = 1.5 * properties.mK * properties.GK *
                                   properties.GM0 / s_eff * sig_i;
-        KelvinVector const dmu_vK = 1.5 * _mp.mvK(t, x)[0] * properties.GM0 *
+        KelvinVector const dmu_vK = 1.5 * properties.mvK * properties.GM0 *
                                     properties.etaK / s_eff * sig_i;
         Jac.template block<KelvinVectorSize, KelvinVectorSize>(KelvinVectorSize,
                                                                0)
@@ -282,7 +334,7 @@ void Lubby2<DisplacementDim>::calculateJacobianBurgers(
         -0.5 * properties.GM0 / properties.etaM * KelvinMatrix::Identity();
     if (s_eff > 0.)
     {
-        KelvinVector const dmu_vM = 1.5 * _mp.mvM(t, x)[0] * properties.GM0 *
+        KelvinVector const dmu_vM = 1.5 * properties.mvM * properties.GM0 *
                                     properties.etaM / s_eff * sig_i;
         Jac.template block<KelvinVectorSize, KelvinVectorSize>(
                2 * KelvinVectorSize, 0)
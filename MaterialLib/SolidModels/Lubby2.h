@@ -9,7 +9,10 @@
 
 #pragma once
 
+#include <array>
+
 #include "MathLib/KelvinVector.h"
+#include "NumLib/Checkpoint.h"
 #include "NumLib/NewtonRaphson.h"
 #include "ProcessLib/Parameter/Parameter.h"
 
@@ -55,6 +58,13 @@ struct Lubby2MaterialProperties
     P const& mK;
     P const& mvK;
     P const& mvM;
+
+    /// The parameters in the order of the members of
+    /// detail::LocalLubby2Properties.
+    std::array<P const*, 8> parameters() const
+    {
+        return {{&GM0, &KM0, &GK0, &etaK0, &etaM0, &mK, &mvK, &mvM}};
+    }
 };
 
 namespace detail
@@ -76,6 +86,21 @@ struct LocalLubby2Properties
     {
     }
 
+    /// Constructs the properties from already evaluated parameters, the k-th
+    /// parameter of Lubby2MaterialProperties::parameters() being
+    /// <tt>values[k * stride]</tt>.
+    LocalLubby2Properties(double const* const values, std::size_t const stride)
+        : GM0(values[0]),
+          KM0(values[stride]),
+          GK0(values[2 * stride]),
+          etaK0(values[3 * stride]),
+          etaM0(values[4 * stride]),
+          mK(values[5 * stride]),
+          mvK(values[6 * stride]),
+          mvM(values[7 * stride])
+    {
+    }
+
     void update(double const s_eff)
     {
         double const GM0_s_eff = GM0 * s_eff;
@@ -139,6 +164,22 @@ public:
             eps_M_t = eps_M_j;
         }
 
+        void writeCheckpoint(std::ostream& os) const override
+        {
+            NumLib::writeCheckpointMatrix(os, eps_K_t);
+            NumLib::writeCheckpointMatrix(os, eps_K_j);
+            NumLib::writeCheckpointMatrix(os, eps_M_t);
+            NumLib::writeCheckpointMatrix(os, eps_M_j);
+        }
+
+        void readCheckpoint(std::istream& is) override
+        {
+            NumLib::readCheckpointMatrix(is, eps_K_t);
+            NumLib::readCheckpointMatrix(is, eps_K_j);
+            NumLib::readCheckpointMatrix(is, eps_M_t);
+            NumLib::readCheckpointMatrix(is, eps_M_j);
+        }
+
         using KelvinVector =
             MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
         using KelvinMatrix =
@@ -231,7 +272,22 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressBatch(
+        double const t, MeshLib::Element const& element, double const dt,
+        typename MechanicsBase<DisplacementDim>::StressBatch& batch,
+        double const T) const override;
+
 private:
+    /// Computes the stress \c sigma, the tangent \c C and the new \c state
+    /// with the material properties already evaluated. On input \c state
+    /// holds the material state of the previous iteration.
+    /// Returns false if the local Newton iterations did not converge.
+    bool integrateStressWithProperties(
+        detail::LocalLubby2Properties<DisplacementDim>& local_lubby2_properties,
+        double const dt, KelvinVector const& eps,
+        MaterialStateVariables& state, KelvinVector& sigma,
+        KelvinMatrix& C) const;
+
     /// Calculates the 18x1 residual vector.
     void calculateResidualBurgers(
         double const dt,
@@ -246,8 +302,6 @@ private:
 
     /// Calculates the 18x18 Jacobian.
     void calculateJacobianBurgers(
-        double const t,
-        ProcessLib::SpatialPosition const& x,
         double const dt,
         JacobianMatrix& Jac,
         double s_eff,
@@ -11,22 +11,18 @@
 
 #include <boost/optional.hpp>
 #include <functional>
+#include <iosfwd>
 #include <memory>
 #include <tuple>
 #include <vector>
 
+#include <Eigen/StdVector>
+
 #include "BaseLib/Error.h"
+#include "MeshLib/Elements/Element.h"
 #include "ProcessLib/Deformation/BMatrixPolicy.h"
-
-namespace ProcessLib
-{
-class SpatialPosition;
-}
-
-namespace MeshLib
-{
-class Element;
-}
+#include "ProcessLib/Parameter/Parameter.h"
+#include "ProcessLib/Parameter/SpatialPosition.h"
 
 namespace MaterialLib
 {
@@ -61,6 +57,13 @@ struct MechanicsBase
             MaterialStateVariables const&) = default;
 
         virtual void pushBackState() = 0;
+
+        /// Writes the current and the previous state for a checkpoint. Models
+        /// without state beyond sigma and eps need not override this.
+        virtual void writeCheckpoint(std::ostream& /*os*/) const {}
+
+        /// Restores the state written by writeCheckpoint().
+        virtual void readCheckpoint(std::istream& /*is*/) {}
     };
 
     /// Polymorphic creator for MaterialStateVariables objects specific for a
@@ -119,6 +122,95 @@ struct MechanicsBase
                     MaterialStateVariables const& material_state_variables,
                     double const T) const = 0;
 
+    using KelvinVectors =
+        std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>>;
+    using KelvinMatrices =
+        std::vector<KelvinMatrix, Eigen::aligned_allocator<KelvinMatrix>>;
+
+    /// Arguments and results of integrateStressBatch() for all integration
+    /// points of an element. The entries of all members belong to the
+    /// integration point of the same index.
+    ///
+    /// A batch is meant to be kept by the caller between calls, such that its
+    /// storage is reused. Also the objects in \c material_state_variables_new
+    /// are reused by the material models if they are still owned by the batch.
+    struct StressBatch
+    {
+        void resize(std::size_t const n)
+        {
+            eps_prev.resize(n);
+            eps.resize(n);
+            sigma_prev.resize(n);
+            material_state_variables.resize(n);
+            sigma.resize(n);
+            material_state_variables_new.resize(n);
+            C.resize(n);
+        }
+
+        std::size_t size() const { return eps.size(); }
+
+        /// Returns the object the new material state of the integration point
+        /// \c ip is written to. An object of another type than \c State is
+        /// replaced.
+        template <typename State>
+        State& newMaterialStateVariables(std::size_t const ip)
+        {
+            auto& state = material_state_variables_new[ip];
+            if (auto* const s = dynamic_cast<State*>(state.get()))
+                return *s;
+            auto new_state = std::make_unique<State>();
+            auto& s = *new_state;
+            state = std::move(new_state);
+            return s;
+        }
+
+        // Arguments.
+        KelvinVectors eps_prev;
+        KelvinVectors eps;
+        KelvinVectors sigma_prev;
+        std::vector<MaterialStateVariables const*> material_state_variables;
+
+        // Results.
+        KelvinVectors sigma;
+        std::vector<std::unique_ptr<MaterialStateVariables>>
+            material_state_variables_new;
+        KelvinMatrices C;
+    };
+
+    /// Computation of the constitutive relation for all integration points of
+    /// the given element at once. The arguments and the results are passed in
+    /// \c batch, the integration point ip being at the position ip of each of
+    /// its members.
+    ///
+    /// The default implementation calls integrateStress() for each
+    /// integration point. Material models override it to evaluate their
+    /// parameters once per element and to avoid the dynamic allocation of the
+    /// material states.
+    /// Returns false in case of errors in the computation at any of the
+    /// integration points.
+    virtual bool integrateStressBatch(double const t,
+                                      MeshLib::Element const& element,
+                                      double const dt, StressBatch& batch,
+                                      double const T) const
+    {
+        ProcessLib::SpatialPosition x_position;
+        x_position.setElementID(element.getID());
+
+        for (std::size_t ip = 0; ip < batch.size(); ++ip)
+        {
+            x_position.setIntegrationPoint(ip);
+            auto&& solution = integrateStress(
+                t, x_position, dt, batch.eps_prev[ip], batch.eps[ip],
+                batch.sigma_prev[ip], *batch.material_state_variables[ip], T);
+            if (!solution)
+                return false;
+
+            std::tie(batch.sigma[ip], batch.material_state_variables_new[ip],
+                     batch.C[ip]) = std::move(*solution);
+        }
+        return true;
+    }
+
     /// Helper type for providing access to internal variables.
     struct InternalVariable
     {
@@ -167,6 +259,42 @@ struct MechanicsBase
         MaterialStateVariables const& material_state_variables) const = 0;
 
     virtual ~MechanicsBase() = default;
+
+protected:
+    /// Evaluates the first component of each of the given parameters at all
+    /// integration points of the element. The value of the k-th parameter at
+    /// the integration point ip is stored in
+    /// <tt>values[k * n_integration_points + ip]</tt>.
+    template <typename Parameters>
+    static void evaluateParametersOnElement(Parameters const& parameters,
+                                            MeshLib::Element const& element,
+                                            unsigned const n_integration_points,
+                                            double const t,
+                                            std::vector<double>& values)
+    {
+        thread_local std::vector<double> component_values;
+
+        values.resize(parameters.size() * n_integration_points);
+        double* parameter_values = values.data();
+        for (ProcessLib::Parameter<double> const* const parameter : parameters)
+        {
+            auto const n_components = parameter->getNumberOfComponents();
+            if (n_components == 1)
+            {
+                parameter->getIntegrationPointValuesOnElement(
+                    element, n_integration_points, t, parameter_values);
+            }
+            else
+            {
+                component_values.resize(n_components * n_integration_points);
+                parameter->getIntegrationPointValuesOnElement(
+                    element, n_integration_points, t, component_values.data());
+                for (unsigned ip = 0; ip < n_integration_points; ++ip)
+                    parameter_values[ip] = component_values[ip * n_components];
+            }
+            parameter_values += n_integration_points;
+        }
+    }
 };
 
 }  // namespace Solids
@@ -9,6 +9,10 @@
 
 #include "EigenLinearSolver.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_MKL
@@ -22,6 +26,7 @@
 #endif
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/Profiler.h"
 #include "EigenVector.h"
 #include "EigenMatrix.h"
 #include "EigenTools.h"
@@ -42,12 +47,96 @@ public:
 
     //! Solves the linear equation system \f$ A x = b \f$ for \f$ x \f$.
     virtual bool solve(Matrix &A, Vector const& b, Vector &x, EigenOption &opt) = 0;
+
+    std::size_t getNumberOfSavedAnalyses() const { return _saved_analyses; }
+    std::size_t getNumberOfSavedFactorizations() const
+    {
+        return _saved_factorizations;
+    }
+
+protected:
+    void countSavedAnalysis()
+    {
+        ++_saved_analyses;
+        BaseLib::Profiler::instance().addToCounter("saved_analyses", 1);
+    }
+
+    void countSavedFactorization()
+    {
+        ++_saved_factorizations;
+        BaseLib::Profiler::instance().addToCounter("saved_factorizations", 1);
+    }
+
+private:
+    std::size_t _saved_analyses = 0;
+    std::size_t _saved_factorizations = 0;
 };
 
 namespace details
 {
 
+/// Keeps a copy of the sparsity pattern of the last matrix passed to update().
+class SparsityPattern
+{
+public:
+    using Matrix = EigenMatrix::RawMatrixType;
+
+    /// Returns true if the pattern of the compressed matrix \c A differs from
+    /// the stored one and stores the pattern of \c A in that case.
+    bool update(Matrix const& A)
+    {
+        assert(A.isCompressed());
+        auto const* const outer = A.outerIndexPtr();
+        auto const* const inner = A.innerIndexPtr();
+        auto const n_outer = A.outerSize() + 1;
+        auto const n_inner = A.nonZeros();
+
+        if (A.rows() == _rows && A.cols() == _cols &&
+            static_cast<Eigen::Index>(_outer.size()) == n_outer &&
+            static_cast<Eigen::Index>(_inner.size()) == n_inner &&
+            std::equal(_outer.begin(), _outer.end(), outer) &&
+            std::equal(_inner.begin(), _inner.end(), inner))
+        {
+            return false;
+        }
+
+        _rows = A.rows();
+        _cols = A.cols();
+        _outer.assign(outer, outer + n_outer);
+        _inner.assign(inner, inner + n_inner);
+        return true;
+    }
+
+private:
+    Eigen::Index _rows = -1;
+    Eigen::Index _cols = -1;
+    std::vector<Matrix::StorageIndex> _outer;
+    std::vector<Matrix::StorageIndex> _inner;
+};
+
+/// Returns true if \c values holds the nonzero values of \c A.
+/// \pre \c A is compressed and has the pattern the \c values belong to.
+bool hasValues(EigenMatrix::RawMatrixType const& A,
+               std::vector<double> const& values)
+{
+    return static_cast<Eigen::Index>(values.size()) == A.nonZeros() &&
+           std::equal(values.begin(), values.end(), A.valuePtr());
+}
+
+void storeValues(EigenMatrix::RawMatrixType const& A,
+                 std::vector<double>& values)
+{
+    values.assign(A.valuePtr(), A.valuePtr() + A.nonZeros());
+}
+
 /// Template class for Eigen direct linear solvers
+///
+/// The symbolic analysis is only redone if the sparsity pattern of the matrix
+/// changes, the factorization only if the matrix changes. If
+/// EigenOption::max_factorization_reuse is positive, the LU
+/// factors of an earlier matrix are used for iterative refinement of the
+/// solution; the matrix is only refactorized if the refinement does not
+/// converge within a few steps.
 template <class T_SOLVER>
 class EigenDirectLinearSolver final : public EigenLinearSolverBase
 {
@@ -58,7 +147,45 @@ public:
              EigenOption::getSolverName(opt.solver_type).c_str());
         if (!A.isCompressed()) A.makeCompressed();
 
-        _solver.compute(A);
+        if (_pattern.update(A))
+        {
+            _solver.analyzePattern(A);
+            _is_factorized = false;
+        }
+        else
+        {
+            countSavedAnalysis();
+        }
+
+        // E.g., linear time-invariant processes with constant time steps
+        // produce the same matrix again and again.
+        if (_is_factorized && hasValues(A, _factorized_values))
+        {
+            INFO("\t reused factorization of the unchanged matrix");
+            countSavedFactorization();
+            x = _solver.solve(b);
+            if(_solver.info()!=Eigen::Success) {
+                ERR("Failed during Eigen linear solve");
+                return false;
+            }
+            return true;
+        }
+
+        if (_is_factorized && _reuses < opt.max_factorization_reuse)
+        {
+            if (solveByRefinement(A, b, x, opt))
+            {
+                ++_reuses;
+                countSavedFactorization();
+                return true;
+            }
+            DBUG("Refinement with the reused factorization did not converge.");
+        }
+
+        _solver.factorize(A);
+        _is_factorized = _solver.info() == Eigen::Success;
+        _reuses = 0;
+        storeValues(A, _factorized_values);
         if(_solver.info()!=Eigen::Success) {
             ERR("Failed during Eigen linear solver initialization");
             return false;
@@ -74,10 +201,90 @@ public:
     }
 
 private:
+    /// Iterative refinement with the factorization of an earlier matrix as an
+    /// approximate inverse of \c A. The refinement is considered converged if
+    /// the normwise backward error is as small as for a fresh factorization.
+    bool solveByRefinement(Matrix const& A, Vector const& b, Vector& x,
+                           EigenOption const& opt)
+    {
+        int const max_steps = 10;
+        double const tolerance =
+            std::max(opt.error_tolerance,
+                     1e3 * std::numeric_limits<double>::epsilon());
+        double const norm_A = A.norm();
+        double const norm_b = b.norm();
+
+        Vector y = _solver.solve(b);
+        for (int step = 0; step < max_steps; ++step)
+        {
+            if (_solver.info() != Eigen::Success)
+                return false;
+            Vector const r = b - A * y;
+            double const backward_error =
+                r.norm() / (norm_A * y.norm() + norm_b);
+            if (!std::isfinite(backward_error))
+                return false;
+            if (backward_error <= tolerance)
+            {
+                INFO("\t reused factorization, refinement steps: %d", step);
+                x = std::move(y);
+                return true;
+            }
+            y += _solver.solve(r);
+        }
+        return false;
+    }
+
     T_SOLVER _solver;
+    SparsityPattern _pattern;
+    bool _is_factorized = false;
+    int _reuses = 0;
+    /// The values of the matrix the factorization has been computed for.
+    std::vector<double> _factorized_values;
+};
+
+/// Wraps an Eigen preconditioner such that it can be kept unchanged while the
+/// iterative solver is set up with a new matrix.
+template <typename Precon>
+class ReusablePreconditioner : public Precon
+{
+public:
+    template <typename MatrixType>
+    ReusablePreconditioner& analyzePattern(MatrixType const& A)
+    {
+        if (!keep)
+            Precon::analyzePattern(A);
+        return *this;
+    }
+
+    template <typename MatrixType>
+    ReusablePreconditioner& factorize(MatrixType const& A)
+    {
+        if (!keep)
+            Precon::factorize(A);
+        return *this;
+    }
+
+    template <typename MatrixType>
+    ReusablePreconditioner& compute(MatrixType const& A)
+    {
+        if (!keep)
+            Precon::compute(A);
+        return *this;
+    }
+
+    /// If set, the preconditioner computed for an earlier matrix is kept.
+    bool keep = false;
 };
 
 /// Template class for Eigen iterative linear solvers
+///
+/// The preconditioner's symbolic analysis is only redone if the sparsity
+/// pattern of the matrix changes, the preconditioner itself only if the matrix
+/// changes. If EigenOption::max_factorization_reuse is
+/// positive, the preconditioner of an earlier matrix is kept until the solver
+/// fails or needs more than twice the iterations it needed with a freshly
+/// computed preconditioner.
 template <class T_SOLVER>
 class EigenIterativeLinearSolver final : public EigenLinearSolverBase
 {
@@ -93,13 +300,76 @@ public:
         if (!A.isCompressed())
             A.makeCompressed();
 
-        _solver.compute(A);
+        auto& preconditioner = _solver.preconditioner();
+        if (_pattern.update(A))
+        {
+            preconditioner.keep = false;
+            _solver.analyzePattern(A);
+            _is_factorized = false;
+        }
+        else
+        {
+            countSavedAnalysis();
+        }
+
+        bool const same_matrix =
+            _is_factorized && hasValues(A, _factorized_values);
+        bool const reuse = same_matrix ||
+                           (_is_factorized &&
+                            _reuses < opt.max_factorization_reuse &&
+                            !_convergence_degraded);
+
+        // The solver always has to be set up with the current matrix, the
+        // preconditioner only if it is not reused.
+        preconditioner.keep = reuse;
+        _solver.factorize(A);
         if(_solver.info()!=Eigen::Success) {
+            ERR("Failed during Eigen linear solver initialization");
+            _is_factorized = false;
+            return false;
+        }
+
+        if (reuse)
+        {
+            Vector const initial_guess = x;
+            x = _solver.solveWithGuess(b, initial_guess);
+            if (_solver.info() == Eigen::Success)
+            {
+                INFO("\t reused preconditioner");
+                countSavedFactorization();
+                if (!same_matrix)
+                {
+                    ++_reuses;
+                    _convergence_degraded =
+                        _solver.iterations() >
+                        2 * std::max<Eigen::Index>(_fresh_iterations, 1);
+                }
+                return finish(opt);
+            }
+            DBUG("Solve with the reused preconditioner failed.");
+            x = initial_guess;
+        }
+
+        preconditioner.keep = false;
+        if (reuse)
+            _solver.factorize(A);
+        _is_factorized = _solver.info() == Eigen::Success;
+        if (!_is_factorized) {
             ERR("Failed during Eigen linear solver initialization");
             return false;
         }
+        _reuses = 0;
+        _convergence_degraded = false;
+        storeValues(A, _factorized_values);
 
         x = _solver.solveWithGuess(b, x);
+        _fresh_iterations = _solver.iterations();
+        return finish(opt);
+    }
+
+private:
+    bool finish(EigenOption const& opt)
+    {
         INFO("\t iteration: %d/%ld", _solver.iterations(), opt.max_iterations);
         INFO("\t residual: %e\n", _solver.error());
 
@@ -111,15 +381,21 @@ public:
         return true;
     }
 
-private:
     T_SOLVER _solver;
+    SparsityPattern _pattern;
+    bool _is_factorized = false;
+    bool _convergence_degraded = false;
+    int _reuses = 0;
+    Eigen::Index _fresh_iterations = 0;
+    /// The values of the matrix the preconditioner has been computed for.
+    std::vector<double> _factorized_values;
 };
 
 template <template <typename, typename> class Solver, typename Precon>
 std::unique_ptr<EigenLinearSolverBase> createIterativeSolver()
 {
     using Slv = EigenIterativeLinearSolver<
-        Solver<EigenMatrix::RawMatrixType, Precon>>;
+        Solver<EigenMatrix::RawMatrixType, ReusablePreconditioner<Precon>>>;
     return std::make_unique<Slv>();
 }
 
@@ -214,7 +490,28 @@ EigenLinearSolver::EigenLinearSolver(
     OGS_FATAL("Invalid Eigen linear solver type. Aborting.");
 }
 
-EigenLinearSolver::~EigenLinearSolver() = default;
+EigenLinearSolver::~EigenLinearSolver()
+{
+    if (_solver && (_solver->getNumberOfSavedAnalyses() > 0 ||
+                    _solver->getNumberOfSavedFactorizations() > 0))
+    {
+        INFO(
+            "Eigen linear solver: %zu symbolic analyses and %zu factorizations "
+            "were saved.",
+            _solver->getNumberOfSavedAnalyses(),
+            _solver->getNumberOfSavedFactorizations());
+    }
+}
+
+std::size_t EigenLinearSolver::getNumberOfSavedAnalyses() const
+{
+    return _solver->getNumberOfSavedAnalyses();
+}
+
+std::size_t EigenLinearSolver::getNumberOfSavedFactorizations() const
+{
+    return _solver->getNumberOfSavedFactorizations();
+}
 
 void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
 {
@@ -244,6 +541,12 @@ void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
             ptSolver->getConfigParameterOptional<int>("max_iteration_step")) {
         _option.max_iterations = *max_iteration_step;
     }
+    if (auto max_factorization_reuse =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__max_factorization_reuse}
+            ptSolver->getConfigParameterOptional<int>(
+                "max_factorization_reuse")) {
+        _option.max_factorization_reuse = *max_factorization_reuse;
+    }
     if (auto scaling =
             //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__scaling}
             ptSolver->getConfigParameterOptional<bool>("scaling")) {
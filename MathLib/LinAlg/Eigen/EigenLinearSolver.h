@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 #include "BaseLib/ConfigTree.h"
@@ -55,6 +57,15 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Number of solves which reused the symbolic analysis of the previous
+    /// matrix because its sparsity pattern did not change.
+    std::size_t getNumberOfSavedAnalyses() const;
+
+    /// Number of solves which reused a factorization or a preconditioner
+    /// computed for an earlier matrix, see
+    /// EigenOption::max_factorization_reuse.
+    std::size_t getNumberOfSavedFactorizations() const;
+
 protected:
     EigenOption _option;
     std::unique_ptr<EigenLinearSolverBase> _solver;
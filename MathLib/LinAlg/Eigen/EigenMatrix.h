@@ -9,8 +9,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <fstream>
+#include <numeric>
 #include <string>
+#include <vector>
 
 #include <Eigen/Sparse>
 
@@ -31,6 +35,25 @@ class EigenMatrix final
 public:
     using RawMatrixType = Eigen::SparseMatrix<double, Eigen::RowMajor>;
     using IndexType = RawMatrixType::Index;
+    /// Type of the positions in the value array of the compressed matrix,
+    /// i.e., the storage index type of the raw matrix.
+    using ValueOffsetType = int;
+
+    /// Rows and positions in the value array of the compressed matrix of the
+    /// entries of some columns, see getColumnEntries().
+    struct ColumnEntries
+    {
+        /// The off-diagonal entries of \c columns[i] are the entries
+        /// \c begin[i] to \c begin[i+1] of \c rows and \c offsets. They
+        /// are only listed for the first occurrence of a column.
+        std::vector<IndexType> columns;
+        std::vector<std::size_t> begin;
+        std::vector<IndexType> rows;
+        std::vector<ValueOffsetType> offsets;
+        /// Position of the diagonal entry of each column or -1 if the
+        /// diagonal entry does not exist.
+        std::vector<ValueOffsetType> diagonal_offsets;
+    };
 
     // TODO The matrix constructor should take num_rows and num_cols as arguments
     //      that is left for a later refactoring.
@@ -45,6 +68,38 @@ public:
             _mat.reserve(Eigen::VectorXi::Constant(n, n_nonzero_columns));
     }
 
+    /// Copies the matrix including the caches which are valid for it.
+    EigenMatrix(EigenMatrix const& other) : _mat(other._mat)
+    {
+        copyCaches(other);
+    }
+
+    /// Copies the matrix. If the structure of this matrix does not change, as
+    /// for repeated copies of an assembled matrix, the own caches are kept.
+    /// Otherwise the caches of \c other are taken.
+    EigenMatrix& operator=(EigenMatrix const& other)
+    {
+        if (this == &other)
+            return *this;
+        if (!hasSameStructure(other))
+        {
+            _mat = other._mat;
+            copyCaches(other);
+            return *this;
+        }
+        bool const value_offsets_valid = areValueOffsetsValid();
+        bool const column_entries_valid = areColumnEntriesValid();
+        _mat = other._mat;
+        if (value_offsets_valid)
+            _value_offsets_inner_indices = _mat.innerIndexPtr();
+        if (column_entries_valid)
+            _column_entries_inner_indices = _mat.innerIndexPtr();
+        return *this;
+    }
+
+    EigenMatrix(EigenMatrix&&) = default;
+    EigenMatrix& operator=(EigenMatrix&&) = default;
+
     /// return the number of rows
     IndexType getNumberOfRows() const { return _mat.rows(); }
 
@@ -116,6 +171,36 @@ public:
             std::vector<IndexType> const& col_pos, const T_DENSE_MATRIX &sub_matrix,
             double fkt = 1.0);
 
+    /// Add sub-matrix at positions given by \c indices like add(). Once the
+    /// matrix is compressed, the positions of the sub-matrix entries in the
+    /// value array of the raw matrix are cached under the given \c item_id,
+    /// e.g. a mesh element id, such that subsequent calls do not have to
+    /// search for the entries anymore.
+    ///
+    /// The cache is invalidated if the structure of the matrix changes. As
+    /// long as the matrix is not compressed or an entry does not exist yet,
+    /// the values are added via add().
+    ///
+    /// \pre The \c indices used for one \c item_id do not change.
+    template <class T_DENSE_MATRIX>
+    void add(std::size_t const item_id,
+             RowColumnIndices<IndexType> const& indices,
+             const T_DENSE_MATRIX& sub_matrix);
+
+    /// Clears the positions cached by add(item_id, indices, sub_matrix). This
+    /// is necessary if the matrix is reused with different indices for the
+    /// same \c item_id, e.g., by a different process.
+    void clearValueOffsets() { _value_offsets.clear(); }
+
+    /// Finds the entries of the given \c columns, which is a search through
+    /// all rows of the row major matrix. The result is cached and reused as
+    /// long as the structure of the matrix and the \c columns do not change,
+    /// e.g., for the Dirichlet boundary conditions in each iteration.
+    ///
+    /// \pre The matrix is compressed.
+    ColumnEntries const& getColumnEntries(
+        std::vector<IndexType> const& columns);
+
     /// get value. This function returns zero if the element doesn't exist.
     double get(IndexType row, IndexType col) const
     {
@@ -164,8 +249,213 @@ public:
 
 protected:
     RawMatrixType _mat;
+
+private:
+    /// Finds the positions of the entries of the sub-matrix given by \c
+    /// indices in the value array of the compressed matrix. Returns false if
+    /// any of the entries does not exist.
+    bool findValueOffsets(RowColumnIndices<IndexType> const& indices,
+                          std::vector<ValueOffsetType>& offsets) const;
+
+    /// Clears the value offsets cache if the structure of the matrix changed
+    /// since the cache has been filled.
+    void validateValueOffsets();
+
+    bool areValueOffsetsValid() const
+    {
+        return _value_offsets_non_zeros == _mat.nonZeros() &&
+               _value_offsets_inner_indices == _mat.innerIndexPtr();
+    }
+
+    bool areColumnEntriesValid() const
+    {
+        return _column_entries_non_zeros == _mat.nonZeros() &&
+               _column_entries_inner_indices == _mat.innerIndexPtr();
+    }
+
+    /// Checks if both matrices are compressed and have the same non-zero
+    /// entries.
+    bool hasSameStructure(EigenMatrix const& other) const
+    {
+        auto const& m = other._mat;
+        if (!_mat.isCompressed() || !m.isCompressed() ||
+            _mat.rows() != m.rows() || _mat.cols() != m.cols() ||
+            _mat.nonZeros() != m.nonZeros())
+            return false;
+        return std::equal(_mat.outerIndexPtr(),
+                          _mat.outerIndexPtr() + _mat.outerSize() + 1,
+                          m.outerIndexPtr()) &&
+               std::equal(_mat.innerIndexPtr(),
+                          _mat.innerIndexPtr() + _mat.nonZeros(),
+                          m.innerIndexPtr());
+    }
+
+    /// Takes the caches of \c other after its raw matrix has been copied.
+    /// Caches which are invalid for \c other are invalidated.
+    void copyCaches(EigenMatrix const& other)
+    {
+        _value_offsets = other._value_offsets;
+        _value_offsets_non_zeros =
+            other.areValueOffsetsValid() ? _mat.nonZeros() : -1;
+        _value_offsets_inner_indices = _mat.innerIndexPtr();
+
+        _column_entries = other._column_entries;
+        _column_entries_non_zeros =
+            other.areColumnEntriesValid() ? _mat.nonZeros() : -1;
+        _column_entries_inner_indices = _mat.innerIndexPtr();
+    }
+
+    /// Positions of sub-matrix entries in the value array of the compressed
+    /// matrix, see add(item_id, indices, sub_matrix).
+    std::vector<std::vector<ValueOffsetType>> _value_offsets;
+    /// Number of non-zeros and the inner index array of the matrix the
+    /// \c _value_offsets are valid for.
+    IndexType _value_offsets_non_zeros = 0;
+    void const* _value_offsets_inner_indices = nullptr;
+
+    /// Cache of getColumnEntries() and the number of non-zeros and the inner
+    /// index array of the matrix it is valid for.
+    ColumnEntries _column_entries;
+    IndexType _column_entries_non_zeros = 0;
+    void const* _column_entries_inner_indices = nullptr;
 };
 
+template <class T_DENSE_MATRIX>
+void EigenMatrix::add(std::size_t const item_id,
+                      RowColumnIndices<IndexType> const& indices,
+                      const T_DENSE_MATRIX& sub_matrix)
+{
+    if (!_mat.isCompressed())
+    {
+        add(indices, sub_matrix);
+        return;
+    }
+
+    validateValueOffsets();
+    if (_value_offsets.size() <= item_id)
+        _value_offsets.resize(item_id + 1);
+
+    auto& offsets = _value_offsets[item_id];
+    auto const n_rows = indices.rows.size();
+    auto const n_cols = indices.columns.size();
+    if (offsets.size() != n_rows * n_cols &&
+        !findValueOffsets(indices, offsets))
+    {
+        // Some entries are missing; they will be inserted, which uncompresses
+        // the matrix and invalidates the cache.
+        offsets.clear();
+        add(indices, sub_matrix);
+        return;
+    }
+
+    auto* const values = _mat.valuePtr();
+    for (auto i = decltype(n_rows){0}; i < n_rows; i++)
+    {
+        auto const* const row_offsets = offsets.data() + i * n_cols;
+        for (auto j = decltype(n_cols){0}; j < n_cols; j++)
+            values[row_offsets[j]] += sub_matrix(i, j);
+    }
+}
+
+inline bool EigenMatrix::findValueOffsets(
+    RowColumnIndices<IndexType> const& indices,
+    std::vector<ValueOffsetType>& offsets) const
+{
+    offsets.clear();
+    offsets.reserve(indices.rows.size() * indices.columns.size());
+
+    auto const* const outer = _mat.outerIndexPtr();
+    auto const* const inner = _mat.innerIndexPtr();
+    for (auto const row : indices.rows)
+    {
+        auto const* const row_begin = inner + outer[row];
+        auto const* const row_end = inner + outer[row + 1];
+        for (auto const col : indices.columns)
+        {
+            auto const* const it = std::lower_bound(row_begin, row_end, col);
+            if (it == row_end || *it != col)
+                return false;
+            offsets.push_back(static_cast<ValueOffsetType>(it - inner));
+        }
+    }
+    return true;
+}
+
+inline void EigenMatrix::validateValueOffsets()
+{
+    if (areValueOffsetsValid())
+        return;
+
+    _value_offsets.clear();
+    _value_offsets_non_zeros = _mat.nonZeros();
+    _value_offsets_inner_indices = _mat.innerIndexPtr();
+}
+
+inline EigenMatrix::ColumnEntries const& EigenMatrix::getColumnEntries(
+    std::vector<IndexType> const& columns)
+{
+    assert(_mat.isCompressed());
+    if (areColumnEntriesValid() && _column_entries.columns == columns)
+        return _column_entries;
+
+    auto& entries = _column_entries;
+    auto const n_columns = columns.size();
+    entries.columns = columns;
+    entries.begin.assign(n_columns + 1, 0);
+    entries.diagonal_offsets.assign(n_columns, -1);
+
+    // Position of the first occurrence of each matrix column in columns.
+    std::size_t const none = n_columns;
+    std::vector<std::size_t> position(_mat.cols(), none);
+    for (std::size_t i = 0; i < n_columns; i++)
+    {
+        if (position[columns[i]] == none)
+            position[columns[i]] = i;
+    }
+
+    auto const* const outer = _mat.outerIndexPtr();
+    auto const* const inner = _mat.innerIndexPtr();
+    auto const n_rows = _mat.rows();
+    // Count the entries of each column, ...
+    for (IndexType row = 0; row < n_rows; row++)
+    {
+        for (auto k = outer[row]; k < outer[row + 1]; k++)
+        {
+            auto const i = position[inner[k]];
+            if (i == none)
+                continue;
+            if (inner[k] == row)
+                entries.diagonal_offsets[i] = k;
+            else
+                entries.begin[i + 1]++;
+        }
+    }
+    std::partial_sum(entries.begin.begin(), entries.begin.end(),
+                     entries.begin.begin());
+
+    // ... and store them in a second pass.
+    entries.rows.resize(entries.begin.back());
+    entries.offsets.resize(entries.begin.back());
+    std::vector<std::size_t> end(entries.begin.begin(),
+                                 entries.begin.end() - 1);
+    for (IndexType row = 0; row < n_rows; row++)
+    {
+        for (auto k = outer[row]; k < outer[row + 1]; k++)
+        {
+            auto const i = position[inner[k]];
+            if (i == none || inner[k] == row)
+                continue;
+            entries.rows[end[i]] = row;
+            entries.offsets[end[i]] = k;
+            end[i]++;
+        }
+    }
+
+    _column_entries_non_zeros = _mat.nonZeros();
+    _column_entries_inner_indices = _mat.innerIndexPtr();
+    return entries;
+}
+
 template <class T_DENSE_MATRIX>
 void EigenMatrix::add(std::vector<IndexType> const& row_pos,
                       std::vector<IndexType> const& col_pos,
@@ -19,6 +19,7 @@ EigenOption::EigenOption()
     precon_type = PreconType::NONE;
     max_iterations = static_cast<int>(1e6);
     error_tolerance = 1.e-16;
+    max_factorization_reuse = 0;
 #ifdef USE_EIGEN_UNSUPPORTED
     scaling = false;
 #endif
@@ -43,6 +43,10 @@ struct EigenOption final
     int max_iterations;
     /// Error tolerance
     double error_tolerance;
+    /// Maximum number of consecutive solves reusing the factorization (direct
+    /// solvers) or the preconditioner (iterative solvers) computed for an
+    /// earlier matrix with the same sparsity pattern. Zero disables the reuse.
+    int max_factorization_reuse;
 #ifdef USE_EIGEN_UNSUPPORTED
     /// Scaling the coefficient matrix and the RHS bector
     bool scaling;
@@ -26,6 +26,9 @@ void applyKnownSolution(EigenMatrix &A_, EigenVector &b_, EigenVector &/*x*/,
     auto &A = A_.getRawMatrix();
     auto &b = b_.getRawVector();
 
+    if (!A.isCompressed())
+        A.makeCompressed();
+
     // A(k, j) = 0.
     // set row to zero
     for (auto row_id : vec_knownX_id)
@@ -33,7 +36,11 @@ void applyKnownSolution(EigenMatrix &A_, EigenVector &b_, EigenVector &/*x*/,
             if (it.col() != decltype(it.col())(row_id)) it.valueRef() = 0.0;
         }
 
-    SpMat AT = A.transpose();
+    // The columns are modified in place via the positions of their entries in
+    // the value array instead of working on the transposed matrix.
+    auto const& columns = A_.getColumnEntries(vec_knownX_id);
+    auto* const values = A.valuePtr();
+    std::vector<SpMat::Index> missing_diagonals;
 
     for (std::size_t ix=0; ix<vec_knownX_id.size(); ix++)
     {
@@ -42,24 +49,33 @@ void applyKnownSolution(EigenMatrix &A_, EigenVector &b_, EigenVector &/*x*/,
 
         // b_i -= A(i,k)*val, i!=k
         // set column to zero, subtract from rhs
-        for (SpMat::InnerIterator it(AT, row_id); it; ++it)
+        for (auto e = columns.begin[ix]; e < columns.begin[ix + 1]; e++)
         {
-            if (it.col() == row_id) continue;
-
-            b[it.col()] -= it.value()*x;
-            it.valueRef() = 0.0;
+            auto& value = values[columns.offsets[e]];
+            b[columns.rows[e]] -= value*x;
+            value = 0.0;
         }
 
-        auto& c = AT.coeffRef(row_id, row_id);
-        if (c != 0.0) {
-            b[row_id] = x * c;
+        auto const diagonal = columns.diagonal_offsets[ix];
+        if (diagonal >= 0 && values[diagonal] != 0.0) {
+            b[row_id] = x * values[diagonal];
         } else {
             b[row_id] = x;
-            c = 1.0;
+            if (diagonal >= 0)
+                values[diagonal] = 1.0;
+            else
+                missing_diagonals.push_back(row_id);
         }
     }
 
-    A = AT.transpose();
+    // Inserting entries changes the structure, which invalidates the value
+    // positions used above.
+    if (!missing_diagonals.empty())
+    {
+        for (auto const row_id : missing_diagonals)
+            A.coeffRef(row_id, row_id) = 1.0;
+        A.makeCompressed();
+    }
 }
 
 } // MathLib
@@ -68,13 +68,20 @@ public:
     std::vector<double> get(std::vector<IndexType> const& indices) const
     {
         std::vector<double> local_x;
-        local_x.reserve(indices.size());
+        get(indices, local_x);
+        return local_x;
+    }
 
-        for (auto i : indices) {
-            local_x.emplace_back(_vec[i]);
-        }
+    /// Get entries. The storage of \c local_x is reused if it is large
+    /// enough.
+    void get(std::vector<IndexType> const& indices,
+             std::vector<double>& local_x) const
+    {
+        local_x.resize(indices.size());
 
-        return local_x;
+        for (std::size_t i = 0; i < indices.size(); ++i) {
+            local_x[i] = _vec[indices[i]];
+        }
     }
 
     /// set entry
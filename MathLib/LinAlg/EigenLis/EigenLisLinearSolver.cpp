@@ -26,7 +26,7 @@ namespace MathLib
 EigenLisLinearSolver::EigenLisLinearSolver(
     const std::string /*solver_name*/,
     BaseLib::ConfigTree const* const option)
-    : _lis_option(option)
+    : _lis_solver("", option)
 {
 }
 
@@ -49,9 +49,7 @@ bool EigenLisLinearSolver::solve(EigenMatrix &A_, EigenVector& b_,
     LisVector lisb(b.rows(), b.data());
     LisVector lisx(x.rows(), x.data());
 
-    LisLinearSolver lissol; // TODO not always creat Lis solver here
-    lissol.setOption(_lis_option);
-    bool const status = lissol.solve(lisA, lisb, lisx);
+    bool const status = _lis_solver.solve(lisA, lisb, lisx);
 
     for (std::size_t i=0; i<lisx.size(); i++)
         x[i] = lisx[i];
@@ -14,6 +14,7 @@
 #include <lis.h>
 
 #include "BaseLib/ConfigTree.h"
+#include "MathLib/LinAlg/Lis/LisLinearSolver.h"
 #include "MathLib/LinAlg/Lis/LisOption.h"
 
 namespace MathLib
@@ -42,12 +43,19 @@ public:
     /**
      * copy linear solvers options
      */
-    void setOption(const LisOption &option) { _lis_option = option; }
+    void setOption(const LisOption &option) { _lis_solver.setOption(option); }
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// \copydoc LisLinearSolver::getNumberOfSavedPreconditioners()
+    std::size_t getNumberOfSavedPreconditioners() const
+    {
+        return _lis_solver.getNumberOfSavedPreconditioners();
+    }
+
 private:
-    LisOption _lis_option;
+    /// Kept over all solves, s.t. its preconditioner can be reused.
+    LisLinearSolver _lis_solver;
 };
 
 } // MathLib
@@ -1,5 +1,6 @@
 #include "LinearSolverOptions.h"
 
+#include <map>
 #include <set>
 
 //! Configuration tag names of all known linear solvers for their
@@ -9,6 +10,12 @@ static
 std::set<std::string>
 known_linear_solvers { "eigen", "lis", "petsc" };
 
+//! Configuration tag names of linear solver parameters which are given beside
+//! the solver's tag, together with the tag name of their solver.
+static
+std::multimap<std::string, std::string>
+additional_linear_solver_parameters { {"lis", "lis_max_preconditioner_reuse"} };
+
 namespace MathLib
 {
 
@@ -18,7 +25,13 @@ ignoreOtherLinearSolvers(const BaseLib::ConfigTree &config,
                          const std::string &solver_name)
 {
     for (auto const& s : known_linear_solvers) {
-        if (s!=solver_name) config.ignoreConfigParameter(s);
+        if (s == solver_name)
+            continue;
+        config.ignoreConfigParameter(s);
+        auto const parameters =
+            additional_linear_solver_parameters.equal_range(s);
+        for (auto p = parameters.first; p != parameters.second; ++p)
+            config.ignoreConfigParameter(p->second);
     }
 }
 
@@ -18,8 +18,13 @@
 
 #include "LisLinearSolver.h"
 
+#include <algorithm>
+
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/Error.h"
+#include "BaseLib/Profiler.h"
+
 #include "LisCheck.h"
 #include "LisMatrix.h"
 #include "LisVector.h"
@@ -32,6 +37,56 @@ LisLinearSolver::LisLinearSolver(
                     const BaseLib::ConfigTree* const option)
 : _lis_option(option)
 {
+    int const ierr = lis_solver_create(&_solver);
+    if (!checkLisError(ierr))
+        OGS_FATAL("Could not create the Lis solver.");
+    setOption(_lis_option);
+}
+
+LisLinearSolver::~LisLinearSolver()
+{
+    destroyPreconditioner();
+    lis_solver_destroy(_solver);
+
+    if (_saved_preconditioners > 0)
+    {
+        INFO("Lis linear solver: %zu preconditioners were saved.",
+             _saved_preconditioners);
+    }
+}
+
+void LisLinearSolver::setOption(const LisOption& option)
+{
+    _lis_option = option;
+    // The options are parsed only here, not on every solve.
+    lis_solver_set_option(
+        const_cast<char*>(_lis_option._option_string.c_str()), _solver);
+    destroyPreconditioner();
+}
+
+bool LisLinearSolver::createPreconditioner(LisMatrix& A, LisVector& b)
+{
+    destroyPreconditioner();
+    // The same as in lis_solve(), which creates and destroys the
+    // preconditioner for each solve.
+    _solver->A = A.getRawMatrix();
+    _solver->b = b.getRawVector();
+    int const ierr = lis_precon_create(_solver, &_precon);
+    if (!checkLisError(ierr))
+    {
+        _precon = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void LisLinearSolver::destroyPreconditioner()
+{
+    if (_precon != nullptr)
+    {
+        lis_precon_destroy(_precon);
+        _precon = nullptr;
+    }
 }
 
 bool LisLinearSolver::solve(LisMatrix &A, LisVector &b, LisVector &x)
@@ -41,59 +96,97 @@ bool LisLinearSolver::solve(LisMatrix &A, LisVector &b, LisVector &x)
     INFO("------------------------------------------------------------------");
     INFO("*** LIS solver computation");
 
-    // Create solver
-    LIS_SOLVER solver;
-    int ierr = lis_solver_create(&solver);
-    if (!checkLisError(ierr))
-        return false;
-
-    lis_solver_set_option(
-        const_cast<char*>(_lis_option._option_string.c_str()), solver);
 #ifdef _OPENMP
     INFO("-> number of threads: %i", (int) omp_get_max_threads());
 #endif
     {
         int precon;
-        ierr = lis_solver_get_precon(solver, &precon);
+        lis_solver_get_precon(_solver, &precon);
         INFO("-> precon: %i", precon);
     }
     {
         int slv;
-        ierr = lis_solver_get_solver(solver, &slv);
+        lis_solver_get_solver(_solver, &slv);
         INFO("-> solver: %i", slv);
     }
 
-    // solve
-    INFO("-> solve");
-    ierr = lis_solve(A.getRawMatrix(), b.getRawVector(), x.getRawVector(), solver);
+    bool const reuse = _precon != nullptr &&
+                       _reuses < _lis_option._max_preconditioner_reuse &&
+                       !_convergence_degraded;
+    bool success = false;
+    if (reuse)
+    {
+        // Kept for a repeated solve with a new preconditioner.
+        LisVector initial_guess(x);
+
+        INFO("-> solve with reused preconditioner");
+        int iterations = 0;
+        success = solveWithPreconditioner(A, b, x, iterations);
+        if (success)
+        {
+            ++_reuses;
+            ++_saved_preconditioners;
+            BaseLib::Profiler::instance().addToCounter("saved_factorizations",
+                                                       1);
+            _convergence_degraded =
+                iterations > 2 * std::max(_fresh_iterations, 1);
+        }
+        else
+        {
+            DBUG("Solve with the reused preconditioner failed.");
+            lis_vector_copy(initial_guess.getRawVector(), x.getRawVector());
+        }
+    }
+
+    if (!success)
+    {
+        if (!createPreconditioner(A, b))
+            return false;
+        _reuses = 0;
+        _convergence_degraded = false;
+
+        INFO("-> solve");
+        success = solveWithPreconditioner(A, b, x, _fresh_iterations);
+    }
+    INFO("------------------------------------------------------------------");
+
+    return success;
+}
+
+bool LisLinearSolver::solveWithPreconditioner(LisMatrix& A, LisVector& b,
+                                              LisVector& x, int& iterations)
+{
+    _solver->A = A.getRawMatrix();
+    _solver->b = b.getRawVector();
+    int ierr = lis_solve_kernel(A.getRawMatrix(), b.getRawVector(),
+                                x.getRawVector(), _solver, _precon);
     if (!checkLisError(ierr))
         return false;
 
     LIS_INT linear_solver_status;
-    ierr = lis_solver_get_status(solver, &linear_solver_status);
+    ierr = lis_solver_get_status(_solver, &linear_solver_status);
     if (!checkLisError(ierr))
         return false;
 
     INFO("-> status: %d", linear_solver_status);
 
     {
-        int iter = 0;
-        ierr = lis_solver_get_iter(solver, &iter);
+        ierr = lis_solver_get_iter(_solver, &iterations);
         if (!checkLisError(ierr))
             return false;
 
-        INFO("-> iteration: %d", iter);
+        INFO("-> iteration: %d", iterations);
     }
     {
         double resid = 0.0;
-        ierr = lis_solver_get_residualnorm(solver, &resid);
+        ierr = lis_solver_get_residualnorm(_solver, &resid);
         if (!checkLisError(ierr))
             return false;
         INFO("-> residual: %g", resid);
     }
     {
         double time, itime, ptime, p_ctime, p_itime;
-        ierr = lis_solver_get_timeex(solver, &time, &itime,
+        ierr = lis_solver_get_timeex(_solver, &time, &itime,
                                      &ptime, &p_ctime, &p_itime);
         if (!checkLisError(ierr))
             return false;
@@ -104,12 +197,6 @@ bool LisLinearSolver::solve(LisMatrix &A, LisVector &b, LisVector &x)
         INFO("-> time precond. iter   (s): %g", p_itime);
     }
 
-    // Clear solver
-    ierr = lis_solver_destroy(solver);
-    if (!checkLisError(ierr))
-        return false;
-    INFO("------------------------------------------------------------------");
-
     return linear_solver_status == LIS_SUCCESS;
 }
 
@@ -32,6 +32,15 @@ class LisVector;
 /**
  * \brief Linear solver using Lis (http://www.ssisc.org/lis/)
  *
+ * The Lis solver object is created and configured once and used for all
+ * solves. The vector \c x passed to solve() is used as initial guess unless
+ * \c -initx_zeros is set in the options.
+ *
+ * If LisOption::_max_preconditioner_reuse is positive, the preconditioner of
+ * an earlier matrix is kept until the solver fails or needs more than twice
+ * the iterations it needed with a freshly computed preconditioner. The
+ * preconditioner stores its own data, hence the matrix passed to solve() may
+ * be a different Lis matrix object each time.
  */
 class LisLinearSolver final
 {
@@ -47,16 +56,43 @@ public:
     LisLinearSolver(const std::string solver_name = "",
                     BaseLib::ConfigTree const*const option = nullptr);
 
+    LisLinearSolver(LisLinearSolver const&) = delete;
+    LisLinearSolver& operator=(LisLinearSolver const&) = delete;
+
+    ~LisLinearSolver();
+
     /**
      * configure linear solvers
      * @param option
      */
-    void setOption(const LisOption &option) { _lis_option = option; }
+    void setOption(const LisOption &option);
 
     bool solve(LisMatrix& A, LisVector &b, LisVector &x);
 
+    /// Number of solves which used a preconditioner of an earlier matrix.
+    std::size_t getNumberOfSavedPreconditioners() const
+    {
+        return _saved_preconditioners;
+    }
+
 private:
+    /// Creates the preconditioner for the given system, replacing the old one.
+    bool createPreconditioner(LisMatrix& A, LisVector& b);
+    void destroyPreconditioner();
+
+    /// Solves with the current preconditioner and reports the solver
+    /// statistics. The number of iterations is returned in \c iterations.
+    bool solveWithPreconditioner(LisMatrix& A, LisVector& b, LisVector& x,
+                                 int& iterations);
+
     LisOption _lis_option;
+    LIS_SOLVER _solver = nullptr;
+    LIS_PRECON _precon = nullptr;
+
+    int _reuses = 0;
+    bool _convergence_degraded = false;
+    int _fresh_iterations = 0;
+    std::size_t _saved_preconditioners = 0;
 };
 
 } // MathLib
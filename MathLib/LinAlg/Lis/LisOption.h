@@ -50,10 +50,20 @@ struct LisOption
                     INFO("Lis options: \"%s\"", _option_string.c_str());
                 }
             }
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__lis_max_preconditioner_reuse}
+            if (auto const reuse = options->getConfigParameterOptional<int>(
+                    "lis_max_preconditioner_reuse"))
+            {
+                _max_preconditioner_reuse = *reuse;
+            }
         }
     }
 
     std::string _option_string = "-initx_zeros 0";
 
+    /// Maximum number of consecutive solves using the preconditioner computed
+    /// for an earlier matrix.
+    int _max_preconditioner_reuse = 0;
+
 };
 }
@@ -136,9 +136,11 @@ void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz)
     MatCreate(PETSC_COMM_WORLD, &_A);
     MatSetSizes(_A, _n_loc_rows, _n_loc_cols, _nrows, _ncols);
 
+    // The default type is set first, s.t. it can be replaced via the PETSc
+    // options, e.g., by the threaded "-mat_type mpiaijmkl" in hybrid runs.
+    MatSetType(_A, MATMPIAIJ);
     MatSetFromOptions(_A);
 
-    MatSetType(_A, MATMPIAIJ);
     MatSeqAIJSetPreallocation(_A, d_nz, PETSC_NULL);
     MatMPIAIJSetPreallocation(_A, d_nz, PETSC_NULL, o_nz, PETSC_NULL);
     // If pre-allocation does not work one can use MatSetUp(_A), which is much
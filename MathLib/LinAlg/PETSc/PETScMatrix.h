@@ -165,6 +165,21 @@ public:
         add(indices.rows, cols, sub_matrix);
     }
 
+    /*!
+       \brief Add sub-matrix at positions given by global \c indices.
+
+       The \c item_id is ignored. The overload exists for interface
+       compatibility with EigenMatrix, which caches the positions of the
+       entries per item.
+     */
+    template <class T_DENSE_MATRIX>
+    void add(std::size_t const /*item_id*/,
+             RowColumnIndices<PetscInt> const& indices,
+             const T_DENSE_MATRIX& sub_matrix)
+    {
+        add(indices, sub_matrix);
+    }
+
     /*!
       \brief         Add a submatrix to this.
       \param row_pos The row indices of the entries of the submatrix.
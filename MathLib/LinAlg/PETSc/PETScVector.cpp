@@ -210,7 +210,15 @@ PetscScalar PETScVector::get(const PetscInt idx) const
 std::vector<PetscScalar> PETScVector::get(
     std::vector<IndexType> const& indices) const
 {
-    std::vector<PetscScalar> local_x(indices.size());
+    std::vector<PetscScalar> local_x;
+    get(indices, local_x);
+    return local_x;
+}
+
+void PETScVector::get(std::vector<IndexType> const& indices,
+                      std::vector<PetscScalar>& local_x) const
+{
+    local_x.resize(indices.size());
     // If VecGetValues can get values from different processors,
     // use VecGetValues(_v, indices.size(), indices.data(),
     //                    local_x.data());
@@ -232,8 +240,6 @@ std::vector<PetscScalar> PETScVector::get(
             local_x[i] = _entry_array[id_p];
         }
     }
-
-    return local_x;
 }
 
 PetscScalar* PETScVector::getLocalVector() const
@@ -150,6 +150,11 @@ public:
     /// called beforehand.
     std::vector<PetscScalar> get(std::vector<IndexType> const& indices) const;
 
+    /// Get several entries. The storage of \c local_x is reused if it is
+    /// large enough. setLocalAccessibleVector() must be called beforehand.
+    void get(std::vector<IndexType> const& indices,
+             std::vector<PetscScalar>& local_x) const;
+
     /// Get the value of an entry by [] operator.
     /// setLocalAccessibleVector() must be called beforehand.
     PetscScalar operator[](PetscInt idx) const { return get(idx); }
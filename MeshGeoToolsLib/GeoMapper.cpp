@@ -28,6 +28,8 @@
 #include "GeoLib/Raster.h"
 #include "GeoLib/StationBorehole.h"
 
+#include "MathLib/GeometricBasics.h"
+
 #include "MeshLib/Mesh.h"
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Elements/FaceRule.h"
@@ -40,7 +42,7 @@ namespace MeshGeoToolsLib {
 
 GeoMapper::GeoMapper(GeoLib::GEOObjects &geo_objects, const std::string &geo_name)
     : _geo_objects(geo_objects), _geo_name(const_cast<std::string&>(geo_name)),
-    _surface_mesh(nullptr), _grid(nullptr), _raster(nullptr)
+    _surface_mesh(nullptr), _raster(nullptr)
 {
 }
 
@@ -86,9 +88,7 @@ void GeoMapper::mapOnMesh(MeshLib::Mesh const*const mesh)
         _surface_mesh = MeshLib::MeshSurfaceExtraction::getMeshSurface(*mesh, dir, 90);
     }
 
-    // init grid
-    MathLib::Point3d origin(std::array<double,3>{{0,0,0}});
-    MathLib::Vector3 normal(0,0,-1);
+    // init grids
     std::vector<MeshLib::Node> flat_nodes;
     flat_nodes.reserve(_surface_mesh->getNumberOfNodes());
     // copy nodes and project the copied nodes to the x-y-plane, i.e. set
@@ -97,7 +97,9 @@ void GeoMapper::mapOnMesh(MeshLib::Mesh const*const mesh)
         flat_nodes.emplace_back(*n_ptr);
         flat_nodes.back()[2] = 0.0;
     }
-    _grid = new GeoLib::Grid<MeshLib::Node>(flat_nodes.cbegin(), flat_nodes.cend());
+    _grid.reset(new GeoLib::Grid<MeshLib::Node>(flat_nodes.cbegin(),
+                                                flat_nodes.cend()));
+    _surface_element_grid.reset(new MeshLib::MeshElementGrid(*_surface_mesh));
 
     if (GeoLib::isStation((*pnts)[0])) {
         mapStationData(*pnts);
@@ -105,7 +107,9 @@ void GeoMapper::mapOnMesh(MeshLib::Mesh const*const mesh)
         mapPointDataToMeshSurface(*pnts);
     }
 
-    delete _grid;
+    // The node grid refers to the local flat_nodes.
+    _grid.reset();
+    _surface_element_grid.reset();
 }
 
 void GeoMapper::mapToConstantValue(double value)
@@ -130,8 +134,11 @@ void GeoMapper::mapStationData(std::vector<GeoLib::Point*> const& points)
         max_val = bounding_box.getMaxPoint()[2];
     }
 
-    for (auto * pnt : points)
+    auto const n_points = static_cast<long>(points.size());
+#pragma omp parallel for
+    for (long i = 0; i < n_points; ++i)
     {
+        auto* const pnt = points[i];
         double offset =
             (_grid)
                 ? (getMeshElevation((*pnt)[0], (*pnt)[1], min_val, max_val) -
@@ -163,10 +170,13 @@ void GeoMapper::mapPointDataToMeshSurface(std::vector<GeoLib::Point*> const& pnt
     double const min_val(aabb.getMinPoint()[2]);
     double const max_val(aabb.getMaxPoint()[2]);
 
-    for (auto * pnt : pnts) {
+    auto const n_pnts = static_cast<long>(pnts.size());
+#pragma omp parallel for
+    for (long i = 0; i < n_pnts; ++i)
+    {
         // check if pnt is inside of the bounding box of the _surface_mesh
         // projected onto the y-x plane
-        GeoLib::Point &p(*pnt);
+        GeoLib::Point &p(*pnts[i]);
         if (p[0] < aabb.getMinPoint()[0] || aabb.getMaxPoint()[0] < p[0])
             continue;
         if (p[1] < aabb.getMinPoint()[1] || aabb.getMaxPoint()[1] < p[1])
@@ -187,31 +197,33 @@ float GeoMapper::getDemElevation(GeoLib::Point const& pnt) const
 double GeoMapper::getMeshElevation(
     double x, double y, double min_val, double max_val) const
 {
-    const MeshLib::Node* pnt =
-        _grid->getNearestPoint(MathLib::Point3d{{{x, y, 0}}});
-    const std::vector<MeshLib::Element*> elements(
-        _surface_mesh->getNode(pnt->getID())->getElements());
-    std::unique_ptr<GeoLib::Point> intersection;
+    GeoLib::Point const top(x, y, max_val);
+    GeoLib::Point const bottom(x, y, min_val);
+    auto const elements = _surface_element_grid->getElementsInVolume(
+        MathLib::Point3d{{{x, y, min_val}}},
+        MathLib::Point3d{{{x, y, max_val}}});
 
-    for (auto const & element : elements)
+    for (auto const element : elements)
     {
-        if (intersection == nullptr &&
-            element->getGeomType() != MeshLib::MeshElemType::LINE)
-            intersection = GeoLib::triangleLineIntersection(
-                *element->getNode(0), *element->getNode(1),
-                *element->getNode(2), GeoLib::Point(x, y, max_val),
-                GeoLib::Point(x, y, min_val));
+        if (element->getGeomType() == MeshLib::MeshElemType::LINE)
+            continue;
+
+        auto intersection = GeoLib::triangleLineIntersection(
+            *element->getNode(0), *element->getNode(1), *element->getNode(2),
+            top, bottom);
 
         if (intersection == nullptr &&
             element->getGeomType() == MeshLib::MeshElemType::QUAD)
             intersection = GeoLib::triangleLineIntersection(
                 *element->getNode(0), *element->getNode(2),
-                *element->getNode(3), GeoLib::Point(x, y, max_val),
-                GeoLib::Point(x, y, min_val));
+                *element->getNode(3), top, bottom);
+
+        if (intersection)
+            return (*intersection)[2];
     }
-    if (intersection)
-        return (*intersection)[2];
     // if something goes wrong, simply take the elevation of the nearest mesh node
+    const MeshLib::Node* pnt =
+        _grid->getNearestPoint(MathLib::Point3d{{{x, y, 0}}});
     return (*(_surface_mesh->getNode(pnt->getID())))[2];
 }
 
@@ -220,11 +232,35 @@ double GeoMapper::getMeshElevation(
 /// The algorithm projects every element of the elements vector and the point
 /// \c p orthogonal to the \f$x\f$-\f$y\f$ plane. In the \f$x\f$-\f$y\f$ plane
 /// it is checked if the projected point is in the projected element.
+/// Triangles and quadrilaterals are tested without copying the element.
 static MeshLib::Element const* findElementContainingPointXY(
     std::vector<MeshLib::Element const*> const& elements,
     MathLib::Point3d const& p)
 {
+    MathLib::Point3d const p_xy{{{p[0], p[1], 0.0}}};
+    auto projected_node = [](MeshLib::Element const& elem, unsigned k) {
+        MeshLib::Node const& node(*elem.getNode(k));
+        return MathLib::Point3d{{{node[0], node[1], 0.0}}};
+    };
+    double const eps(std::numeric_limits<double>::epsilon());
+
     for (auto const elem : elements) {
+        auto const type(elem->getGeomType());
+        if (type == MeshLib::MeshElemType::TRIANGLE ||
+            type == MeshLib::MeshElemType::QUAD)
+        {
+            auto const a(projected_node(*elem, 0));
+            auto const b(projected_node(*elem, 1));
+            auto const c(projected_node(*elem, 2));
+            if (MathLib::isPointInTriangle(p_xy, a, b, c, eps))
+                return elem;
+            if (type == MeshLib::MeshElemType::QUAD &&
+                MathLib::isPointInTriangle(p_xy, a, c,
+                                           projected_node(*elem, 3), eps))
+                return elem;
+            continue;
+        }
+
         std::unique_ptr<MeshLib::Element> elem_2d(elem->clone());
         // reset/copy the nodes
         for (std::size_t k(0); k<elem_2d->getNumberOfNodes(); ++k) {
@@ -234,7 +270,7 @@ static MeshLib::Element const* findElementContainingPointXY(
         for (std::size_t k(0); k<elem_2d->getNumberOfNodes(); ++k) {
             (*const_cast<MeshLib::Node*>(elem_2d->getNode(k)))[2] = 0.0;
         }
-        if (elem_2d->isPntInElement(MathLib::Point3d{ {{p[0], p[1], 0.0}} })) {
+        if (elem_2d->isPntInElement(p_xy)) {
             // clean up the copied nodes
             for (std::size_t k(0); k<elem_2d->getNumberOfNodes(); ++k) {
                 delete elem_2d->getNode(k);
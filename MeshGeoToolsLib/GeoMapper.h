@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 #include "GeoLib/Point.h"
@@ -24,6 +25,7 @@
 
 namespace MeshLib {
     class Mesh;
+    class MeshElementGrid;
     class Node;
 }
 
@@ -72,10 +74,13 @@ private:
     /// Mapping points on a raster.
     void mapPointDataToDEM(std::vector<GeoLib::Point*> const& points);
 
-    /// Mapping points on mesh.
+    /// Mapping points on mesh. The points are mapped in parallel.
     void mapPointDataToMeshSurface(std::vector<GeoLib::Point*> const& points);
 
-    /// Returns the elevation at Point (x,y) based on a mesh. This uses collision detection for triangles and nearest neighbor for quads.
+    /// Returns the elevation at Point (x,y) based on a mesh. The candidate
+    /// surface elements are taken from the element grid and intersected with
+    /// the vertical line through (x,y). If no element is hit, the elevation of
+    /// the nearest mesh node is returned.
     /// NOTE: This medhod only returns correct values if the node numbering of the elements is correct!
     double getMeshElevation(double x, double y, double min_val, double max_val) const;
 
@@ -87,7 +92,10 @@ private:
 
     /// only necessary for mapping on mesh
     MeshLib::Mesh* _surface_mesh;
-    GeoLib::Grid<MeshLib::Node>* _grid;
+    /// Grid of the surface mesh nodes projected to the x-y-plane.
+    std::unique_ptr<GeoLib::Grid<MeshLib::Node>> _grid;
+    /// Grid of the surface mesh elements, built once per mapOnMesh() call.
+    std::unique_ptr<MeshLib::MeshElementGrid> _surface_element_grid;
 
     /// only necessary for mapping on DEM
     std::unique_ptr<GeoLib::Raster const> _raster;
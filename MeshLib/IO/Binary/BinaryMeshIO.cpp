@@ -0,0 +1,547 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BinaryMeshIO.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/MemoryMappedFile.h"
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+char const magic[8] = {'O', 'G', 'S', 'B', 'M', 'S', 'H', '\0'};
+std::uint64_t const format_version = 1;
+std::uint64_t const byte_order_mark = 0x0102030405060708;
+
+/// Value types of the property vectors. The numbers are stored in the file
+/// and must not be changed.
+enum class ValueType : std::uint64_t
+{
+    Double = 0,
+    Float = 1,
+    Char = 2,
+    UnsignedChar = 3,
+    Int = 4,
+    UnsignedInt = 5,
+    Long = 6,
+    UnsignedLong = 7,
+    LongLong = 8,
+    UnsignedLongLong = 9
+};
+
+template <typename T>
+struct ValueTypeOf;
+template <>
+struct ValueTypeOf<double>
+{
+    static constexpr ValueType value = ValueType::Double;
+};
+template <>
+struct ValueTypeOf<float>
+{
+    static constexpr ValueType value = ValueType::Float;
+};
+template <>
+struct ValueTypeOf<char>
+{
+    static constexpr ValueType value = ValueType::Char;
+};
+template <>
+struct ValueTypeOf<unsigned char>
+{
+    static constexpr ValueType value = ValueType::UnsignedChar;
+};
+template <>
+struct ValueTypeOf<int>
+{
+    static constexpr ValueType value = ValueType::Int;
+};
+template <>
+struct ValueTypeOf<unsigned>
+{
+    static constexpr ValueType value = ValueType::UnsignedInt;
+};
+template <>
+struct ValueTypeOf<long>
+{
+    static constexpr ValueType value = ValueType::Long;
+};
+template <>
+struct ValueTypeOf<unsigned long>
+{
+    static constexpr ValueType value = ValueType::UnsignedLong;
+};
+template <>
+struct ValueTypeOf<long long>
+{
+    static constexpr ValueType value = ValueType::LongLong;
+};
+template <>
+struct ValueTypeOf<unsigned long long>
+{
+    static constexpr ValueType value = ValueType::UnsignedLongLong;
+};
+
+/// Writes arrays to a stream such that every array starts at an eight byte
+/// boundary.
+class BinaryWriter
+{
+public:
+    explicit BinaryWriter(std::ostream& os) : _os(os) {}
+
+    template <typename T>
+    void writeArray(T const* const data, std::size_t const n)
+    {
+        _os.write(reinterpret_cast<char const*>(data), n * sizeof(T));
+        _position += n * sizeof(T);
+        auto const padding = (8 - _position % 8) % 8;
+        char const zeros[8] = {};
+        _os.write(zeros, padding);
+        _position += padding;
+    }
+
+    void writeValue(std::uint64_t const value) { writeArray(&value, 1); }
+
+    void writeString(std::string const& s)
+    {
+        writeValue(s.size());
+        writeArray(s.data(), s.size());
+    }
+
+private:
+    std::ostream& _os;
+    std::size_t _position = 0;
+};
+
+/// Reads the arrays written by the BinaryWriter from a contiguous block of
+/// memory. Every access is checked against the size of the block.
+class BinaryReader
+{
+public:
+    BinaryReader(char const* const data, std::size_t const size,
+                 std::string const& file_name)
+        : _data(data), _size(size), _file_name(file_name)
+    {
+    }
+
+    template <typename T>
+    T const* readArray(std::size_t const n)
+    {
+        if (n > (_size - _position) / sizeof(T))
+        {
+            OGS_FATAL("The binary mesh file '%s' is truncated.",
+                      _file_name.c_str());
+        }
+        auto const* const array =
+            reinterpret_cast<T const*>(_data + _position);
+        _position += n * sizeof(T);
+        _position = std::min(_size, _position + (8 - _position % 8) % 8);
+        return array;
+    }
+
+    std::uint64_t readValue() { return *readArray<std::uint64_t>(1); }
+
+    std::string readString()
+    {
+        auto const length = readValue();
+        auto const* const s = readArray<char>(length);
+        return std::string(s, length);
+    }
+
+    bool atEnd() const { return _position == _size; }
+
+private:
+    char const* const _data;
+    std::size_t const _size;
+    std::string const& _file_name;
+    std::size_t _position = 0;
+};
+
+template <typename T>
+bool writePropertyVector(BinaryWriter& writer,
+                         MeshLib::Properties const& properties,
+                         std::string const& name)
+{
+    if (!properties.existsPropertyVector<T>(name))
+    {
+        return false;
+    }
+    auto const& property = *properties.getPropertyVector<T>(name);
+    writer.writeString(name);
+    writer.writeValue(static_cast<std::uint64_t>(ValueTypeOf<T>::value));
+    writer.writeValue(static_cast<std::uint64_t>(property.getMeshItemType()));
+    writer.writeValue(property.getNumberOfComponents());
+    writer.writeValue(property.getNumberOfTuples());
+    writer.writeArray(property.data(), property.size());
+    return true;
+}
+
+template <typename T>
+void readPropertyVector(BinaryReader& reader, MeshLib::Properties& properties,
+                        std::string const& name,
+                        MeshLib::MeshItemType const item_type,
+                        std::size_t const n_components,
+                        std::size_t const n_tuples)
+{
+    auto const* const values = reader.readArray<T>(n_tuples * n_components);
+    auto* const property = properties.createNewPropertyVector<T>(
+        name, item_type, n_components);
+    if (property == nullptr)
+    {
+        OGS_FATAL("The property '%s' is contained twice in the binary mesh.",
+                  name.c_str());
+    }
+    property->assign(values, values + n_tuples * n_components);
+}
+
+template <typename ElementType>
+MeshLib::Element* createElement(std::vector<MeshLib::Node*> const& nodes,
+                                std::uint64_t const* const node_ids,
+                                std::size_t const n_element_nodes)
+{
+    if (n_element_nodes != ElementType::n_all_nodes)
+    {
+        OGS_FATAL(
+            "The binary mesh contains an element with %zu nodes where %u "
+            "nodes were expected.",
+            n_element_nodes, ElementType::n_all_nodes);
+    }
+    auto** const element_nodes = new MeshLib::Node*[ElementType::n_all_nodes];
+    for (unsigned k = 0; k < ElementType::n_all_nodes; ++k)
+    {
+        if (node_ids[k] >= nodes.size())
+        {
+            delete[] element_nodes;
+            OGS_FATAL("The binary mesh contains an invalid node id %zu.",
+                      static_cast<std::size_t>(node_ids[k]));
+        }
+        element_nodes[k] = nodes[node_ids[k]];
+    }
+    return new ElementType(element_nodes);
+}
+
+MeshLib::Element* createElement(MeshLib::CellType const cell_type,
+                                std::vector<MeshLib::Node*> const& nodes,
+                                std::uint64_t const* const node_ids,
+                                std::size_t const n_element_nodes)
+{
+    using namespace MeshLib;
+    switch (cell_type)
+    {
+        case CellType::POINT1:
+            return createElement<Point>(nodes, node_ids, n_element_nodes);
+        case CellType::LINE2:
+            return createElement<Line>(nodes, node_ids, n_element_nodes);
+        case CellType::LINE3:
+            return createElement<Line3>(nodes, node_ids, n_element_nodes);
+        case CellType::TRI3:
+            return createElement<Tri>(nodes, node_ids, n_element_nodes);
+        case CellType::TRI6:
+            return createElement<Tri6>(nodes, node_ids, n_element_nodes);
+        case CellType::QUAD4:
+            return createElement<Quad>(nodes, node_ids, n_element_nodes);
+        case CellType::QUAD8:
+            return createElement<Quad8>(nodes, node_ids, n_element_nodes);
+        case CellType::QUAD9:
+            return createElement<Quad9>(nodes, node_ids, n_element_nodes);
+        case CellType::TET4:
+            return createElement<Tet>(nodes, node_ids, n_element_nodes);
+        case CellType::TET10:
+            return createElement<Tet10>(nodes, node_ids, n_element_nodes);
+        case CellType::HEX8:
+            return createElement<Hex>(nodes, node_ids, n_element_nodes);
+        case CellType::HEX20:
+            return createElement<Hex20>(nodes, node_ids, n_element_nodes);
+        case CellType::PRISM6:
+            return createElement<Prism>(nodes, node_ids, n_element_nodes);
+        case CellType::PRISM15:
+            return createElement<Prism15>(nodes, node_ids, n_element_nodes);
+        case CellType::PYRAMID5:
+            return createElement<Pyramid>(nodes, node_ids, n_element_nodes);
+        case CellType::PYRAMID13:
+            return createElement<Pyramid13>(nodes, node_ids, n_element_nodes);
+        default:
+            OGS_FATAL("The binary mesh contains an unsupported cell type %d.",
+                      static_cast<int>(cell_type));
+    }
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+namespace Binary
+{
+bool writeBinaryMesh(MeshLib::Mesh const& mesh, std::string const& file_name)
+{
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        ERR("writeBinaryMesh(): Could not open file '%s' for writing.",
+            file_name.c_str());
+        return false;
+    }
+
+    auto const& nodes = mesh.getNodes();
+    auto const& elements = mesh.getElements();
+
+    std::vector<std::uint64_t> offsets;
+    offsets.reserve(elements.size() + 1);
+    offsets.push_back(0);
+    for (auto const* e : elements)
+    {
+        offsets.push_back(offsets.back() + e->getNumberOfNodes());
+    }
+
+    auto const& properties = mesh.getProperties();
+    auto const property_names = properties.getPropertyVectorNames();
+
+    BinaryWriter writer(os);
+    writer.writeArray(magic, sizeof(magic));
+    writer.writeValue(format_version);
+    writer.writeValue(byte_order_mark);
+    writer.writeValue(nodes.size());
+    writer.writeValue(mesh.getNumberOfBaseNodes());
+    writer.writeValue(elements.size());
+    writer.writeValue(offsets.back());
+    writer.writeString(mesh.getName());
+
+    {
+        std::vector<double> coordinates;
+        coordinates.reserve(3 * nodes.size());
+        for (auto const* node : nodes)
+        {
+            coordinates.insert(coordinates.end(), node->getCoords(),
+                               node->getCoords() + 3);
+        }
+        writer.writeArray(coordinates.data(), coordinates.size());
+    }
+
+    {
+        std::vector<std::uint8_t> cell_types;
+        cell_types.reserve(elements.size());
+        for (auto const* e : elements)
+        {
+            cell_types.push_back(static_cast<std::uint8_t>(e->getCellType()));
+        }
+        writer.writeArray(cell_types.data(), cell_types.size());
+    }
+
+    writer.writeArray(offsets.data(), offsets.size());
+
+    {
+        std::vector<std::uint64_t> connectivity;
+        connectivity.reserve(offsets.back());
+        for (auto const* e : elements)
+        {
+            for (unsigned k = 0; k < e->getNumberOfNodes(); ++k)
+            {
+                connectivity.push_back(e->getNodeIndex(k));
+            }
+        }
+        writer.writeArray(connectivity.data(), connectivity.size());
+    }
+
+    // The number of written properties is only known afterwards.
+    auto const n_properties_position = os.tellp();
+    writer.writeValue(0);
+    std::uint64_t n_properties = 0;
+    for (auto const& name : property_names)
+    {
+        if (writePropertyVector<double>(writer, properties, name) ||
+            writePropertyVector<float>(writer, properties, name) ||
+            writePropertyVector<char>(writer, properties, name) ||
+            writePropertyVector<unsigned char>(writer, properties, name) ||
+            writePropertyVector<int>(writer, properties, name) ||
+            writePropertyVector<unsigned>(writer, properties, name) ||
+            writePropertyVector<long>(writer, properties, name) ||
+            writePropertyVector<unsigned long>(writer, properties, name) ||
+            writePropertyVector<long long>(writer, properties, name) ||
+            writePropertyVector<unsigned long long>(writer, properties, name))
+        {
+            ++n_properties;
+            continue;
+        }
+        WARN(
+            "writeBinaryMesh(): The property '%s' has an unsupported value "
+            "type and is not written.",
+            name.c_str());
+    }
+    os.seekp(n_properties_position);
+    os.write(reinterpret_cast<char const*>(&n_properties),
+             sizeof(n_properties));
+
+    if (!os)
+    {
+        ERR("writeBinaryMesh(): Writing the file '%s' failed.",
+            file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+MeshLib::Mesh* readBinaryMesh(std::string const& file_name)
+{
+    BaseLib::MemoryMappedFile const file(file_name);
+    if (file.data() == nullptr)
+    {
+        ERR("readBinaryMesh(): Could not read file '%s'.", file_name.c_str());
+        return nullptr;
+    }
+
+    BinaryReader reader(file.data(), file.size(), file_name);
+    if (std::memcmp(reader.readArray<char>(sizeof(magic)), magic,
+                    sizeof(magic)) != 0)
+    {
+        ERR("readBinaryMesh(): The file '%s' is not a binary OGS mesh.",
+            file_name.c_str());
+        return nullptr;
+    }
+    auto const version = reader.readValue();
+    if (version != format_version)
+    {
+        ERR("readBinaryMesh(): The file '%s' has the format version %zu, but "
+            "only version %zu is supported.",
+            file_name.c_str(), static_cast<std::size_t>(version),
+            static_cast<std::size_t>(format_version));
+        return nullptr;
+    }
+    if (reader.readValue() != byte_order_mark)
+    {
+        ERR("readBinaryMesh(): The file '%s' was written on a platform with a "
+            "different byte order.",
+            file_name.c_str());
+        return nullptr;
+    }
+
+    auto const n_nodes = reader.readValue();
+    auto const n_base_nodes = reader.readValue();
+    auto const n_elements = reader.readValue();
+    auto const connectivity_size = reader.readValue();
+    auto const name = reader.readString();
+
+    auto const* const coordinates = reader.readArray<double>(3 * n_nodes);
+    auto const* const cell_types = reader.readArray<std::uint8_t>(n_elements);
+    auto const* const offsets =
+        reader.readArray<std::uint64_t>(n_elements + 1);
+    auto const* const connectivity =
+        reader.readArray<std::uint64_t>(connectivity_size);
+
+    std::vector<MeshLib::Node*> nodes(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; ++i)
+    {
+        nodes[i] = new MeshLib::Node(coordinates + 3 * i, i);
+    }
+
+    std::vector<MeshLib::Element*> elements(n_elements);
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        if (offsets[e] > offsets[e + 1] || offsets[e + 1] > connectivity_size)
+        {
+            OGS_FATAL("The binary mesh file '%s' has invalid element offsets.",
+                      file_name.c_str());
+        }
+        elements[e] = createElement(
+            static_cast<MeshLib::CellType>(cell_types[e]), nodes,
+            connectivity + offsets[e], offsets[e + 1] - offsets[e]);
+    }
+
+    auto mesh = std::make_unique<MeshLib::Mesh>(
+        name, std::move(nodes), std::move(elements), MeshLib::Properties{},
+        n_base_nodes);
+
+    auto& properties = mesh->getProperties();
+    auto const n_properties = reader.readValue();
+    for (std::size_t p = 0; p < n_properties; ++p)
+    {
+        auto const property_name = reader.readString();
+        auto const value_type = static_cast<ValueType>(reader.readValue());
+        auto const item_type =
+            static_cast<MeshLib::MeshItemType>(reader.readValue());
+        auto const n_components = reader.readValue();
+        auto const n_tuples = reader.readValue();
+
+        switch (value_type)
+        {
+            case ValueType::Double:
+                readPropertyVector<double>(reader, properties, property_name,
+                                           item_type, n_components, n_tuples);
+                break;
+            case ValueType::Float:
+                readPropertyVector<float>(reader, properties, property_name,
+                                          item_type, n_components, n_tuples);
+                break;
+            case ValueType::Char:
+                readPropertyVector<char>(reader, properties, property_name,
+                                         item_type, n_components, n_tuples);
+                break;
+            case ValueType::UnsignedChar:
+                readPropertyVector<unsigned char>(reader, properties,
+                                                  property_name, item_type,
+                                                  n_components, n_tuples);
+                break;
+            case ValueType::Int:
+                readPropertyVector<int>(reader, properties, property_name,
+                                        item_type, n_components, n_tuples);
+                break;
+            case ValueType::UnsignedInt:
+                readPropertyVector<unsigned>(reader, properties, property_name,
+                                             item_type, n_components, n_tuples);
+                break;
+            case ValueType::Long:
+                readPropertyVector<long>(reader, properties, property_name,
+                                         item_type, n_components, n_tuples);
+                break;
+            case ValueType::UnsignedLong:
+                readPropertyVector<unsigned long>(reader, properties,
+                                                  property_name, item_type,
+                                                  n_components, n_tuples);
+                break;
+            case ValueType::LongLong:
+                readPropertyVector<long long>(reader, properties,
+                                              property_name, item_type,
+                                              n_components, n_tuples);
+                break;
+            case ValueType::UnsignedLongLong:
+                readPropertyVector<unsigned long long>(
+                    reader, properties, property_name, item_type, n_components,
+                    n_tuples);
+                break;
+            default:
+                OGS_FATAL(
+                    "The property '%s' in the binary mesh file '%s' has an "
+                    "unknown value type.",
+                    property_name.c_str(), file_name.c_str());
+        }
+    }
+
+    if (!reader.atEnd())
+    {
+        OGS_FATAL("The binary mesh file '%s' contains trailing data.",
+                  file_name.c_str());
+    }
+
+    return mesh.release();
+}
+
+}  // namespace Binary
+}  // namespace IO
+}  // namespace MeshLib
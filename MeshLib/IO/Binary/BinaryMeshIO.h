@@ -0,0 +1,56 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+namespace Binary
+{
+/// Writes the mesh including all its properties to a binary mesh file
+/// (extension \c .bmsh).
+///
+/// The file consists of a header followed by arrays which are stored exactly
+/// as they are used when reading the mesh, such that a mesh can be loaded
+/// without any parsing:
+///  - header: the magic string \c "OGSBMSH", the format version, a byte order
+///    mark, the numbers of nodes, base nodes, elements, connectivity entries
+///    and properties and the mesh name,
+///  - node coordinates (3 doubles per node),
+///  - cell types (one MeshLib::CellType per element as byte),
+///  - element offsets into the connectivity (number of elements + 1 entries),
+///  - connectivity, i.e., the node ids of all elements,
+///  - for each property vector the name, value type, mesh item type, number of
+///    components and tuples, and the values.
+///
+/// All integers are stored as 64 bit unsigned values and every array starts at
+/// an eight byte boundary. The data are written in the native byte order;
+/// reading a file with a different byte order is rejected.
+///
+/// \return true on success.
+bool writeBinaryMesh(MeshLib::Mesh const& mesh, std::string const& file_name);
+
+/// Reads a mesh written by writeBinaryMesh().
+///
+/// The file is memory mapped where the operating system supports it and the
+/// nodes, elements and property vectors are created directly from the mapped
+/// arrays.
+///
+/// \return the new mesh or nullptr if the file could not be read.
+MeshLib::Mesh* readBinaryMesh(std::string const& file_name);
+
+}  // namespace Binary
+}  // namespace IO
+}  // namespace MeshLib
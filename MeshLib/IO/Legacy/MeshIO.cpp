@@ -18,6 +18,7 @@
 
 #include "MeshIO.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <memory>
 #include <sstream>
@@ -25,13 +26,112 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/FileTools.h"
-#include "BaseLib/StringTools.h"
+#include "BaseLib/MemoryMappedFile.h"
+#include "BaseLib/TextParsing.h"
 
 #include "MeshLib/Elements/Elements.h"
 #include "MeshLib/Location.h"
 #include "MeshLib/Node.h"
 #include "MeshLib/PropertyVector.h"
 
+namespace
+{
+/// Returns the beginning of the next line starting with a keyword, i.e., with
+/// '$' or '#', or the end of the range.
+char const* findNextKeywordLine(char const* line, char const* const last)
+{
+    while (line != last)
+    {
+        char const* const p = BaseLib::skipBlanks(line, last);
+        if (p != last && (*p == '$' || *p == '#'))
+            return line;
+        line = BaseLib::nextLine(line, last);
+    }
+    return last;
+}
+
+unsigned getNumberOfNodes(MeshLib::MeshElemType const elem_type)
+{
+    switch (elem_type)
+    {
+    case MeshLib::MeshElemType::LINE:
+        return 2;
+    case MeshLib::MeshElemType::TRIANGLE:
+        return 3;
+    case MeshLib::MeshElemType::QUAD:
+    case MeshLib::MeshElemType::TETRAHEDRON:
+        return 4;
+    case MeshLib::MeshElemType::PYRAMID:
+        return 5;
+    case MeshLib::MeshElemType::PRISM:
+        return 6;
+    case MeshLib::MeshElemType::HEXAHEDRON:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+/// Reads an element line "index material_id type node_ids...". Tokens between
+/// the material id and the element type are skipped. Returns nullptr if the
+/// line could not be read.
+MeshLib::Element* readElement(char const* p, char const* const end,
+                              std::vector<MeshLib::Node*> const& nodes,
+                              int& material_id)
+{
+    std::size_t index;
+    if (!BaseLib::parseInteger(p, end, index) ||
+        !BaseLib::parseInteger(p, end, material_id))
+        return nullptr;
+
+    std::string elem_type_str;
+    MeshLib::MeshElemType elem_type (MeshLib::MeshElemType::INVALID);
+    do {
+        if (!BaseLib::parseWord(p, end, elem_type_str))
+            return nullptr;
+        elem_type = MeshLib::String2MeshElemType(elem_type_str);
+    } while (elem_type == MeshLib::MeshElemType::INVALID);
+
+    unsigned const n_nodes = getNumberOfNodes(elem_type);
+    if (n_nodes == 0)
+        return nullptr;
+
+    // The node array will be deleted by the element.
+    auto** elem_nodes = new MeshLib::Node*[n_nodes];
+    for (unsigned k(0); k < n_nodes; ++k)
+    {
+        std::size_t idx;
+        if (!BaseLib::parseInteger(p, end, idx) || idx >= nodes.size())
+        {
+            delete[] elem_nodes;
+            return nullptr;
+        }
+        elem_nodes[k] = nodes[idx];
+    }
+
+    switch(elem_type)
+    {
+    case MeshLib::MeshElemType::LINE:
+        return new MeshLib::Line(elem_nodes);
+    case MeshLib::MeshElemType::TRIANGLE:
+        return new MeshLib::Tri(elem_nodes);
+    case MeshLib::MeshElemType::QUAD:
+        return new MeshLib::Quad(elem_nodes);
+    case MeshLib::MeshElemType::TETRAHEDRON:
+        return new MeshLib::Tet(elem_nodes);
+    case MeshLib::MeshElemType::HEXAHEDRON:
+        return new MeshLib::Hex(elem_nodes);
+    case MeshLib::MeshElemType::PYRAMID:
+        return new MeshLib::Pyramid(elem_nodes);
+    case MeshLib::MeshElemType::PRISM:
+        return new MeshLib::Prism(elem_nodes);
+    default:
+        delete[] elem_nodes;
+        return nullptr;
+    }
+}
+}  // namespace
+
 namespace MeshLib
 {
 namespace IO
@@ -47,215 +147,128 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
 {
     INFO("Reading OGS legacy mesh ... ");
 
-    std::ifstream in (file_name.c_str(),std::ios::in);
-    if (!in.is_open())
+    BaseLib::MemoryMappedFile const file(file_name);
+    if (file.data() == nullptr)
     {
         WARN("MeshIO::loadMeshFromFile() - Could not open file %s.", file_name.c_str());
         return nullptr;
     }
 
-    std::string line_string ("");
-    getline(in, line_string);
+    char const* position = file.begin();
+    char const* const last = file.end();
+    char const* line_end = BaseLib::nextLine(position, last);
+    if (BaseLib::findKeyword(position, line_end, "#FEM_MSH") == line_end)
+    {
+        return nullptr;
+    }
+    position = line_end;
 
     std::vector<MeshLib::Node*> nodes;
     std::vector<MeshLib::Element*> elements;
-    std::vector<std::size_t> materials;
-
-    if(line_string.find("#FEM_MSH") != std::string::npos) // OGS mesh file
+    std::vector<int> materials;
+    auto const clean_up = [&nodes, &elements]() {
+        std::for_each(elements.begin(), elements.end(),
+                      std::default_delete<MeshLib::Element>());
+        std::for_each(nodes.begin(), nodes.end(),
+                      std::default_delete<MeshLib::Node>());
+    };
+
+    while (position != last)
     {
-        while (!in.eof())
+        line_end = BaseLib::nextLine(position, last);
+        bool const is_nodes_section =
+            BaseLib::findKeyword(position, line_end, "$NODES") != line_end;
+        bool const is_elements_section =
+            BaseLib::findKeyword(position, line_end, "$ELEMENTS") != line_end;
+
+        // check keywords
+        if (BaseLib::findKeyword(position, line_end, "#STOP") != line_end)
+            break;
+        position = line_end;
+        if (!is_nodes_section && !is_elements_section)
+            continue;
+
+        std::size_t n_items = 0;
+        BaseLib::parseInteger(position, last, n_items);
+        position = BaseLib::nextLine(position, last);
+        char const* const section_end = findNextKeywordLine(position, last);
+
+        if (is_nodes_section)
         {
-            getline(in, line_string);
-
-            // check keywords
-            if (line_string.find("#STOP") != std::string::npos)
-                break;
-            if (line_string.find("$NODES") != std::string::npos)
-            {
-                double x, y, z, double_dummy;
-                unsigned idx;
-                getline(in, line_string);
-                BaseLib::trim(line_string);
-                unsigned nNodes = atoi(line_string.c_str());
-                std::string s;
-                for (unsigned i = 0; i < nNodes; ++i)
-                {
-                    getline(in, line_string);
-                    std::stringstream iss(line_string);
-                    iss >> idx >> x >> y >> z;
-                    auto* node(new MeshLib::Node(x, y, z, idx));
-                    nodes.push_back(node);
-                    iss >> s;
-                    if (s.find("$AREA") != std::string::npos)
-                        iss >> double_dummy;
-                }
-            }
-            else if (line_string.find("$ELEMENTS") != std::string::npos)
+            nodes.resize(n_items, nullptr);
+            if (!BaseLib::parseLinesInParallel(
+                    position, section_end, n_items,
+                    [&nodes](char const* p, char const* const end,
+                             std::size_t const i) {
+                        // An optional $AREA entry at the end is ignored.
+                        std::size_t idx;
+                        double x[3];
+                        if (!BaseLib::parseInteger(p, end, idx) ||
+                            !BaseLib::parseDouble(p, end, x[0]) ||
+                            !BaseLib::parseDouble(p, end, x[1]) ||
+                            !BaseLib::parseDouble(p, end, x[2]))
+                        {
+                            return false;
+                        }
+                        nodes[i] = new MeshLib::Node(x, idx);
+                        return true;
+                    }))
             {
-                getline(in, line_string);
-                BaseLib::trim(line_string);
-                unsigned nElements = atoi(line_string.c_str());
-                for (unsigned i = 0; i < nElements; ++i)
-                {
-                    getline(in, line_string);
-                    std::stringstream ss(line_string);
-                    materials.push_back(readMaterialID(ss));
-                    MeshLib::Element *elem(readElement(ss,nodes));
-                    if (elem == nullptr) {
-                        ERR("Reading mesh element %d from file \"%s\" failed.",
-                            i, file_name.c_str());
-                        // clean up the elements vector
-                        std::for_each(elements.begin(), elements.end(),
-                            std::default_delete<MeshLib::Element>());
-                        // clean up the nodes vector
-                        std::for_each(nodes.begin(), nodes.end(),
-                            std::default_delete<MeshLib::Node>());
-                        return nullptr;
-                    }
-                    elements.push_back(elem);
-                }
+                ERR("Reading mesh nodes from file \"%s\" failed.",
+                    file_name.c_str());
+                clean_up();
+                return nullptr;
             }
         }
-
-        if (elements.empty())
-        {
-            ERR ("MeshIO::loadMeshFromFile() - File did not contain element information.");
-            for (auto& node : nodes)
-                delete node;
-            return nullptr;
-        }
-
-        MeshLib::Mesh* mesh (new MeshLib::Mesh(BaseLib::extractBaseNameWithoutExtension(
-                                                       file_name), nodes, elements));
-
-        auto* const material_ids =
-            mesh->getProperties().createNewPropertyVector<int>(
-                "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
-        if (!material_ids)
-        {
-            WARN("Could not create PropertyVector for MaterialIDs in Mesh.");
-        }
         else
         {
-            material_ids->insert(material_ids->end(), materials.cbegin(),
-                                 materials.cend());
+            elements.resize(n_items, nullptr);
+            materials.resize(n_items);
+            if (!BaseLib::parseLinesInParallel(
+                    position, section_end, n_items,
+                    [&](char const* const p, char const* const end,
+                        std::size_t const i) {
+                        elements[i] = readElement(p, end, nodes, materials[i]);
+                        return elements[i] != nullptr;
+                    }))
+            {
+                ERR("Reading mesh elements from file \"%s\" failed.",
+                    file_name.c_str());
+                clean_up();
+                return nullptr;
+            }
         }
-        INFO("\t... finished.");
-        INFO("Nr. Nodes: %d.", nodes.size());
-        INFO("Nr. Elements: %d.", elements.size());
-
-        in.close();
-        return mesh;
+        position = section_end;
     }
 
-    in.close();
-    return nullptr;
-}
-
-std::size_t MeshIO::readMaterialID(std::istream & in) const
-{
-    unsigned index, material_id;
-    if (!(in >> index >> material_id))
-        return std::numeric_limits<std::size_t>::max();
-    return material_id;
-}
-
-MeshLib::Element* MeshIO::readElement(std::istream& in,
-    const std::vector<MeshLib::Node*> &nodes) const
-{
-    std::string elem_type_str("");
-    MeshLib::MeshElemType elem_type (MeshLib::MeshElemType::INVALID);
-
-    do {
-        if (!(in >> elem_type_str))
-            return nullptr;
-        elem_type = MeshLib::String2MeshElemType(elem_type_str);
-    } while (elem_type == MeshLib::MeshElemType::INVALID);
+    if (elements.empty())
+    {
+        ERR ("MeshIO::loadMeshFromFile() - File did not contain element information.");
+        for (auto& node : nodes)
+            delete node;
+        return nullptr;
+    }
 
-    auto* idx = new unsigned[8];
-    MeshLib::Element* elem;
+    MeshLib::Mesh* mesh (new MeshLib::Mesh(BaseLib::extractBaseNameWithoutExtension(
+                                                   file_name), nodes, elements));
 
-    switch(elem_type)
+    auto* const material_ids =
+        mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    if (!material_ids)
     {
-    case MeshLib::MeshElemType::LINE: {
-        for (int i = 0; i < 2; ++i)
-            if (!(in >> idx[i]))
-                return nullptr;
-        // edge_nodes array will be deleted from Line object
-        auto** edge_nodes = new MeshLib::Node*[2];
-        for (unsigned k(0); k < 2; ++k)
-            edge_nodes[k] = nodes[idx[k]];
-        elem = new MeshLib::Line(edge_nodes);
-        break;
-    }
-    case MeshLib::MeshElemType::TRIANGLE: {
-        for (int i = 0; i < 3; ++i)
-            if (!(in >> idx[i]))
-                return nullptr;
-        auto** tri_nodes = new MeshLib::Node*[3];
-        for (unsigned k(0); k < 3; ++k)
-            tri_nodes[k] = nodes[idx[k]];
-        elem = new MeshLib::Tri(tri_nodes);
-        break;
-    }
-    case MeshLib::MeshElemType::QUAD: {
-        for (int i = 0; i < 4; ++i)
-            if (!(in >> idx[i]))
-                return nullptr;
-        auto** quad_nodes = new MeshLib::Node*[4];
-        for (unsigned k(0); k < 4; ++k)
-            quad_nodes[k] = nodes[idx[k]];
-        elem = new MeshLib::Quad(quad_nodes);
-        break;
-    }
-    case MeshLib::MeshElemType::TETRAHEDRON: {
-        for (int i = 0; i < 4; ++i)
-            if (!(in >> idx[i]))
-                return nullptr;
-        auto** tet_nodes = new MeshLib::Node*[4];
-        for (unsigned k(0); k < 4; ++k)
-            tet_nodes[k] = nodes[idx[k]];
-        elem = new MeshLib::Tet(tet_nodes);
-        break;
-    }
-    case MeshLib::MeshElemType::HEXAHEDRON: {
-        for (int i = 0; i < 8; ++i)
-            if (!(in >> idx[i]))
-                return nullptr;
-        auto** hex_nodes = new MeshLib::Node*[8];
-        for (unsigned k(0); k < 8; ++k)
-            hex_nodes[k] = nodes[idx[k]];
-        elem = new MeshLib::Hex(hex_nodes);
-        break;
+        WARN("Could not create PropertyVector for MaterialIDs in Mesh.");
     }
-    case MeshLib::MeshElemType::PYRAMID: {
-        for (int i = 0; i < 5; ++i)
-            if (!(in >> idx[i]))
-                return nullptr;
-        auto** pyramid_nodes = new MeshLib::Node*[5];
-        for (unsigned k(0); k < 5; ++k)
-            pyramid_nodes[k] = nodes[idx[k]];
-        elem = new MeshLib::Pyramid(pyramid_nodes);
-        break;
-    }
-    case MeshLib::MeshElemType::PRISM: {
-        for (int i = 0; i < 6; ++i)
-            if (!(in >> idx[i]))
-                return nullptr;
-        auto** prism_nodes = new MeshLib::Node*[6];
-        for (unsigned k(0); k < 6; ++k)
-            prism_nodes[k] = nodes[idx[k]];
-        elem = new MeshLib::Prism(prism_nodes);
-        break;
-    }
-    default:
-        elem = nullptr;
-        break;
+    else
+    {
+        material_ids->insert(material_ids->end(), materials.cbegin(),
+                             materials.cend());
     }
+    INFO("\t... finished.");
+    INFO("Nr. Nodes: %d.", nodes.size());
+    INFO("Nr. Elements: %d.", elements.size());
 
-    delete [] idx;
-
-    return elem;
+    return mesh;
 }
 
 bool MeshIO::write()
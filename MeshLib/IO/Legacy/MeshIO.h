@@ -55,8 +55,6 @@ private:
     void writeElements(std::vector<MeshLib::Element*> const& ele_vec,
                        MeshLib::PropertyVector<int> const* const material_ids,
                        std::ostream& out) const;
-    std::size_t readMaterialID(std::istream & in) const;
-    MeshLib::Element* readElement(std::istream& line, const std::vector<MeshLib::Node*> &nodes) const;
     std::string ElemType2StringOutput(const MeshLib::MeshElemType t) const;
 
     const MeshLib::Mesh* _mesh;
@@ -9,37 +9,135 @@
 
 #include "PVDFile.h"
 
-#include <fstream>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <logog/include/logog.hpp>
 #include "BaseLib/Error.h"
 
+namespace
+{
+char const* const closing_tags = "  </Collection>\n</VTKFile>\n";
+
+//! Returns the given PVD file content up to the line containing the closing
+//! collection tag, without the data sets after the restart time.
+std::string dataSetsUpTo(std::string const& content, double const restart_time,
+                         std::string const& file_name)
+{
+    auto const pos = content.rfind("</Collection>");
+    if (pos == std::string::npos)
+    {
+        OGS_FATAL("Could not find the end of the collection in `%s'.",
+                  file_name.c_str());
+    }
+    // Start of the line containing the closing collection tag.
+    auto const line_begin = content.rfind('\n', pos);
+    auto const collection_end =
+        (line_begin == std::string::npos) ? 0 : line_begin + 1;
+
+    // The times are written with limited precision.
+    double const max_time = restart_time + std::abs(restart_time) * 1e-12;
+
+    char const data_set_tag[] = "<DataSet timestep=\"";
+    std::string kept;
+    for (std::size_t begin = 0; begin < collection_end;)
+    {
+        // Each line before the closing tag ends with a newline.
+        auto const end = content.find('\n', begin) + 1;
+        auto const tag = content.find(data_set_tag, begin);
+        if (tag >= end ||
+            std::strtod(content.c_str() + tag + sizeof(data_set_tag) - 1,
+                        nullptr) <= max_time)
+        {
+            kept.append(content, begin, end - begin);
+        }
+        begin = end;
+    }
+    return kept;
+}
+}  // namespace
+
 namespace MeshLib
 {
 namespace IO
 {
 
-void PVDFile::addVTUFile(const std::string &vtu_fname, double timestep)
+void PVDFile::continueExisting(double const restart_time)
 {
-    _datasets.push_back(std::make_pair(timestep, vtu_fname));
+    assert(!_fh.is_open());
+    _continue_existing = true;
+    _restart_time = restart_time;
+}
+
+void PVDFile::open()
+{
+    // Binary mode is used so that file positions are plain byte offsets.
+    if (_continue_existing)
+    {
+        std::ifstream is(_pvd_filename, std::ios::binary);
+        if (is)
+        {
+            std::string const content{std::istreambuf_iterator<char>(is),
+                                      std::istreambuf_iterator<char>()};
+            is.close();
+            _fh.open(_pvd_filename,
+                     std::ios::out | std::ios::trunc | std::ios::binary);
+            _fh << dataSetsUpTo(content, _restart_time, _pvd_filename);
+            _collection_end = _fh.tellp();
+            _fh << closing_tags;
+            _fh.flush();
+            if (!_fh)
+            {
+                OGS_FATAL("could not write to file `%s'",
+                          _pvd_filename.c_str());
+            }
+            INFO("Appending to the existing PVD file `%s'.",
+                 _pvd_filename.c_str());
+        }
+    }
+
+    if (!_fh.is_open())
+    {
+        _fh.open(_pvd_filename,
+                 std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!_fh)
+        {
+            OGS_FATAL("could not open file `%s'", _pvd_filename.c_str());
+        }
 
-    std::ofstream fh(_pvd_filename.c_str());
-    if (!fh) {
-        OGS_FATAL("could not open file `%s'", _pvd_filename.c_str());
+        _fh << "<?xml version=\"1.0\"?>\n"
+               "<VTKFile type=\"Collection\" version=\"0.1\" "
+               "byte_order=\"LittleEndian\""
+               " compressor=\"vtkZLibDataCompressor\">\n"
+               "  <Collection>\n";
+        _collection_end = _fh.tellp();
     }
 
-    fh << std::setprecision(std::numeric_limits<double>::digits10);
+    _fh << std::setprecision(std::numeric_limits<double>::digits10);
+}
 
-    fh << "<?xml version=\"1.0\"?>\n"
-           "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\""
-           " compressor=\"vtkZLibDataCompressor\">\n"
-           "  <Collection>\n";
+void PVDFile::addVTUFile(const std::string &vtu_fname, double timestep)
+{
+    if (!_fh.is_open())
+    {
+        open();
+    }
 
-    for (auto const& pair : _datasets)
-        fh << "    <DataSet timestep=\"" << pair.first << "\" group=\"\" part=\"0\" file=\"" << pair.second << "\"/>\n";
+    // The new entry is always longer than the closing tags it overwrites.
+    _fh.seekp(_collection_end);
+    _fh << "    <DataSet timestep=\"" << timestep
+        << "\" group=\"\" part=\"0\" file=\"" << vtu_fname << "\"/>\n";
+    _collection_end = _fh.tellp();
+    _fh << closing_tags;
+    _fh.flush();
 
-    fh << "  </Collection>\n</VTKFile>\n";
+    if (!_fh)
+    {
+        OGS_FATAL("could not write to file `%s'", _pvd_filename.c_str());
+    }
 }
 
 } // IO
@@ -9,9 +9,9 @@
 
 #pragma once
 
+#include <fstream>
 #include <string>
 #include <utility>
-#include <vector>
 
 namespace MeshLib
 {
@@ -20,22 +20,37 @@ namespace IO
 
 /*! Writes a basic PVD file for use with Paraview.
  *
+ * The file is kept open. For each added VTU file only the new \c DataSet entry
+ * and the closing tags are written, overwriting the previous closing tags. That
+ * way the file on disk is a complete PVD file after each call of addVTUFile().
  */
 class PVDFile
 {
 public:
-    //! Set a PVD file path
-    explicit PVDFile(std::string pvd_fname)
-        : _pvd_filename(std::move(pvd_fname))
+    //! Set a PVD file path.
+    explicit PVDFile(std::string pvd_fname) : _pvd_filename(std::move(pvd_fname))
     {
     }
 
+    //! If the file exists, e.g. when restarting a simulation, new data sets
+    //! are appended to the existing ones instead of overwriting the file. The
+    //! existing data sets after the given \c restart_time are removed, since
+    //! they will be computed again. Must be called before addVTUFile().
+    void continueExisting(double const restart_time);
+
     //! Add a VTU file to this PVD file.
     void addVTUFile(std::string const& vtu_fname, double timestep);
 
 private:
+    //! Opens the PVD file and determines the position of the closing tags.
+    void open();
+
     std::string const _pvd_filename;
-    std::vector<std::pair<double, std::string>> _datasets; // a vector of (time, VTU file name)
+    bool _continue_existing = false;
+    double _restart_time = 0;
+    std::fstream _fh;
+    //! Position of the closing tags, where the next data set will be written.
+    std::streamoff _collection_end = 0;
 };
 
 } // namespace IO
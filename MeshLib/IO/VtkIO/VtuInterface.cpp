@@ -47,6 +47,14 @@ VtuInterface::VtuInterface(const MeshLib::Mesh* mesh, int dataMode, bool compres
         WARN("Ascii data cannot be compressed, ignoring compression flag.");
 }
 
+VtuInterface::VtuInterface(const MeshLib::Mesh* mesh,
+                           MeshLib::Properties const* properties,
+                           int dataMode, bool compress)
+    : VtuInterface(mesh, dataMode, compress)
+{
+    _properties = properties;
+}
+
 MeshLib::Mesh* VtuInterface::readVTUFile(std::string const &file_name)
 {
     if (!BaseLib::IsFileExisting(file_name)) {
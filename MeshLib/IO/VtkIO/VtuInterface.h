@@ -19,6 +19,7 @@
 
 namespace MeshLib {
 class Mesh;
+class Properties;
 
 namespace IO
 {
@@ -34,6 +35,12 @@ public:
     /// Provide the mesh to write and set if compression should be used.
     VtuInterface(const MeshLib::Mesh* mesh, int dataMode = vtkXMLWriter::Binary, bool compressed = false);
 
+    /// Provide the mesh whose topology is written together with the given
+    /// properties instead of the mesh's own ones.
+    VtuInterface(const MeshLib::Mesh* mesh,
+                 MeshLib::Properties const* properties, int dataMode,
+                 bool compressed);
+
     /// Read an unstructured grid from a VTU file
     /// \return The converted mesh or a nullptr if reading failed
     static MeshLib::Mesh* readVTUFile(std::string const &file_name);
@@ -53,6 +60,7 @@ public:
 
 private:
     const MeshLib::Mesh* _mesh;
+    MeshLib::Properties const* _properties = nullptr;
     int _data_mode;
     bool _use_compressor;
 };
@@ -30,6 +30,7 @@
 
 #include "MeshLib/Mesh.h"
 
+#include "MeshLib/IO/Binary/BinaryMeshIO.h"
 #include "MeshLib/IO/Legacy/MeshIO.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
@@ -78,6 +79,9 @@ MeshLib::Mesh* readMeshFromFileSerial(const std::string &file_name)
     if (BaseLib::hasFileExtension("vtu", file_name))
         return MeshLib::IO::VtuInterface::readVTUFile(file_name);
 
+    if (BaseLib::hasFileExtension("bmsh", file_name))
+        return MeshLib::IO::Binary::readBinaryMesh(file_name);
+
     ERR("readMeshFromFile(): Unknown mesh file format in file %s.", file_name.c_str());
     return nullptr;
 }
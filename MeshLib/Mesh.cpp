@@ -15,6 +15,7 @@
 #include "Mesh.h"
 
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <utility>
 
@@ -110,11 +111,14 @@ void Mesh::addNode(Node* node)
 void Mesh::addElement(Element* elem)
 {
     _elements.push_back(elem);
+}
+
+void Mesh::addElements(std::vector<Element*> const& elements)
+{
+    _elements.insert(_elements.end(), elements.begin(), elements.end());
 
     // add element information to nodes
-    unsigned nNodes (elem->getNumberOfNodes());
-    for (unsigned i=0; i<nNodes; ++i)
-        elem->_nodes[i]->addElement(elem);
+    this->resetElementsConnectedToNodes();
 }
 
 void Mesh::resetNodeIDs()
@@ -150,11 +154,39 @@ void Mesh::setDimension()
 
 void Mesh::setElementsConnectedToNodes()
 {
-    for (auto& element : _elements)
+    // Count the elements connected to each node; offsets[i+1] is the count of
+    // the i-th node before the summation.
+    std::vector<std::size_t> offsets(_nodes.size() + 1, 0);
+    for (Element const* const element : _elements)
+    {
+        const unsigned nNodes(element->getNumberOfNodes());
+        for (unsigned j=0; j<nNodes; ++j)
+        {
+            assert(element->getNodeIndex(j) < _nodes.size() &&
+                   _nodes[element->getNodeIndex(j)] == element->getNode(j));
+            ++offsets[element->getNodeIndex(j) + 1];
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // Fill in the elements in the order of the element vector.
+    _elements_connected_to_nodes.assign(offsets.back(), nullptr);
+    std::vector<std::size_t> positions(offsets.begin(), offsets.end() - 1);
+    for (Element* const element : _elements)
     {
         const unsigned nNodes(element->getNumberOfNodes());
         for (unsigned j=0; j<nNodes; ++j)
-            element->_nodes[j]->addElement(element);
+            _elements_connected_to_nodes[positions[element->getNodeIndex(j)]++] =
+                element;
+    }
+
+    const std::size_t nNodes(_nodes.size());
+    for (std::size_t i=0; i<nNodes; ++i)
+    {
+        if (_nodes[i])
+            _nodes[i]->setElements(
+                {_elements_connected_to_nodes.data() + offsets[i],
+                 offsets[i + 1] - offsets[i]});
     }
 }
 
@@ -162,7 +194,7 @@ void Mesh::resetElementsConnectedToNodes()
 {
     for (auto& node : _nodes)
         if (node)
-            node->clearElements();
+            node->setElements({});
     this->setElementsConnectedToNodes();
 }
 
@@ -192,7 +224,7 @@ void Mesh::setElementNeighbors()
         const std::size_t nNodes (element->getNumberOfBaseNodes());
         for (unsigned n(0); n<nNodes; ++n)
         {
-            std::vector<Element*> const& conn_elems ((element->getNode(n)->getElements()));
+            auto const conn_elems = element->getNode(n)->getElements();
             neighbors.insert(neighbors.end(), conn_elems.begin(), conn_elems.end());
         }
         std::sort(neighbors.begin(), neighbors.end());
@@ -212,12 +244,18 @@ void Mesh::setElementNeighbors()
 
 void Mesh::setNodesConnectedByEdges()
 {
+    std::vector<std::size_t> offsets;
+    offsets.reserve(_nodes.size() + 1);
+    offsets.push_back(0);
+    std::vector<MeshLib::Node*> connected_nodes;
+
     const std::size_t nNodes (this->_nodes.size());
+    std::vector<MeshLib::Node*> conn_set;
     for (unsigned i=0; i<nNodes; ++i)
     {
         MeshLib::Node* node (_nodes[i]);
-        std::vector<MeshLib::Node*> conn_set;
-        const std::vector<MeshLib::Element*> &conn_elems (node->getElements());
+        conn_set.clear();
+        auto const conn_elems = node->getElements();
         const std::size_t nConnElems (conn_elems.size());
         for (unsigned j=0; j<nConnElems; ++j)
         {
@@ -262,12 +300,20 @@ void Mesh::setNodesConnectedByEdges()
 
             }
         }
-        node->setConnectedNodes(conn_set);
+        connected_nodes.insert(connected_nodes.end(), conn_set.begin(),
+                               conn_set.end());
+        offsets.push_back(connected_nodes.size());
     }
+    setConnectedNodes(offsets, std::move(connected_nodes));
 }
 
 void Mesh::setNodesConnectedByElements()
 {
+    std::vector<std::size_t> offsets;
+    offsets.reserve(_nodes.size() + 1);
+    offsets.push_back(0);
+    std::vector<Node*> connected_nodes;
+
     // Allocate temporary space for adjacent nodes.
     std::vector<Node*> adjacent_nodes;
     for (Node* const node : _nodes)
@@ -275,7 +321,7 @@ void Mesh::setNodesConnectedByElements()
         adjacent_nodes.clear();
 
         // Get all elements, to which this node is connected.
-        std::vector<Element*> const& conn_elems = node->getElements();
+        auto const conn_elems = node->getElements();
 
         // And collect all elements' nodes.
         for (Element const* const element : conn_elems)
@@ -293,7 +339,26 @@ void Mesh::setNodesConnectedByElements()
         auto const last = std::unique(adjacent_nodes.begin(), adjacent_nodes.end());
         adjacent_nodes.erase(last, adjacent_nodes.end());
 
-        node->setConnectedNodes(adjacent_nodes);
+        connected_nodes.insert(connected_nodes.end(), adjacent_nodes.begin(),
+                               adjacent_nodes.end());
+        offsets.push_back(connected_nodes.size());
+    }
+    setConnectedNodes(offsets, std::move(connected_nodes));
+}
+
+void Mesh::setConnectedNodes(std::vector<std::size_t> const& offsets,
+                             std::vector<Node*>&& connected_nodes)
+{
+    assert(offsets.size() == _nodes.size() + 1);
+    _nodes_connected_to_nodes = std::move(connected_nodes);
+    _nodes_connected_to_nodes.shrink_to_fit();
+
+    const std::size_t nNodes(_nodes.size());
+    for (std::size_t i=0; i<nNodes; ++i)
+    {
+        _nodes[i]->setConnectedNodes(
+            {_nodes_connected_to_nodes.data() + offsets[i],
+             offsets[i + 1] - offsets[i]});
     }
 }
 
@@ -75,8 +75,16 @@ public:
     void addNode(Node* node);
 
     /// Add an element to the mesh.
+    /// \attention The elements connected to the nodes are not updated, because
+    /// that requires rebuilding the adjacency of the whole mesh. Call
+    /// resetElementsConnectedToNodes() after adding the elements or use
+    /// addElements().
     void addElement(Element* elem);
 
+    /// Add the elements to the mesh and update the elements connected to the
+    /// nodes once for all of them.
+    void addElements(std::vector<Element*> const& elements);
+
     /// Returns the dimension of the mesh (determined by the maximum dimension over all elements).
     unsigned getDimension() const { return _mesh_dimension; }
 
@@ -151,6 +159,8 @@ protected:
     void setDimension();
 
     /// Fills in the neighbor-information for nodes (i.e. which element each node belongs to).
+    /// The connected elements of all nodes are stored contiguously in
+    /// _elements_connected_to_nodes and the nodes get views of their parts.
     void setElementsConnectedToNodes();
 
     /// Fills in the neighbor-information for elements.
@@ -163,6 +173,15 @@ protected:
     /// connected if they are shared by an element.
     void setNodesConnectedByElements();
 
+    /// Stores the given lists of connected nodes contiguously in
+    /// _nodes_connected_to_nodes and sets the nodes' views of them.
+    ///
+    /// \param offsets the connected nodes of the i-th node are stored in
+    /// \c connected_nodes in the range [offsets[i], offsets[i+1]).
+    /// \param connected_nodes the connected nodes of all nodes.
+    void setConnectedNodes(std::vector<std::size_t> const& offsets,
+                           std::vector<Node*>&& connected_nodes);
+
     /// Check if all the nonlinear nodes are stored at the end of the node vector
     void checkNonlinearNodeIDs() const;
 
@@ -178,6 +197,15 @@ protected:
     std::string _name;
     std::vector<Node*> _nodes;
     std::vector<Element*> _elements;
+
+    /// Elements connected to the nodes, stored node by node in compressed
+    /// sparse row format. The nodes' element views point into this vector.
+    std::vector<Element*> _elements_connected_to_nodes;
+
+    /// Nodes connected to the nodes, stored node by node in compressed sparse
+    /// row format. The nodes' connected nodes views point into this vector.
+    std::vector<Node*> _nodes_connected_to_nodes;
+
     std::size_t _n_base_nodes;
     Properties _properties;
 
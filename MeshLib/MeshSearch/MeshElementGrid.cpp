@@ -93,7 +93,9 @@ MeshElementGrid::MeshElementGrid(MeshLib::Mesh const& sfc_mesh) :
     // cell
     for (std::size_t k(0); k<3; k++) {
         _step_sizes[k] = delta[k] / _n_steps[k];
-        _inverse_step_sizes[k] = 1.0 / _step_sizes[k];
+        // In a degenerated direction, e.g. z for a flat mesh at z = 0, the
+        // step size can underflow such that the inverse is infinite.
+        _inverse_step_sizes[k] = dim[k] ? 1.0 / _step_sizes[k] : 0.0;
     }
 
     _elements_in_grid_box.resize(_n_steps[0]*_n_steps[1]*_n_steps[2]);
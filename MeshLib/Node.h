@@ -18,6 +18,7 @@
 #include <limits>
 #include <vector>
 
+#include "BaseLib/ArrayView.h"
 #include "MathLib/Point3dWithID.h"
 #include "MathLib/Vector3.h"
 
@@ -32,6 +33,9 @@ class Element;
 
 /**
  * A mesh node with coordinates in 3D space.
+ *
+ * The connected elements and nodes are not stored in the node itself but in
+ * the mesh the node belongs to. The node only keeps views of them.
  */
 class Node final : public MathLib::Point3dWithID
 {
@@ -56,13 +60,16 @@ public:
     Node(const Node &node);
 
     /// Return all the nodes connected to this one
-    const std::vector<MeshLib::Node*>& getConnectedNodes() const { return _connected_nodes; }
+    BaseLib::ArrayView<Node* const> getConnectedNodes() const
+    {
+        return _connected_nodes;
+    }
 
     /// Get an element the node is part of.
     const Element* getElement(std::size_t idx) const { return _elements[idx]; }
 
     /// Get all elements the node is part of.
-    const std::vector<Element*>& getElements() const { return _elements; }
+    BaseLib::ArrayView<Element* const> getElements() const { return _elements; }
 
     /// Get number of elements the node is part of.
     std::size_t getNumberOfElements() const { return _elements.size(); }
@@ -78,19 +85,17 @@ protected:
     /// This method automatically also updates the areas/volumes of all connected elements.
     void updateCoordinates(double x, double y, double z);
 
-    /**
-     * Add an element the node is part of.
-     * This method is called by Mesh::addElement(Element*), see friend definition.
-     */
-    void addElement(Element* elem) { _elements.push_back(elem); }
-
-    /// clear stored elements connecting to this node
-    void clearElements() { _elements.clear(); }
+    /// Sets the elements the node is part of. The elements are stored by the
+    /// mesh, see Mesh::setElementsConnectedToNodes().
+    void setElements(BaseLib::ArrayView<Element* const> const elements)
+    {
+        _elements = elements;
+    }
 
     /// Resets the connected nodes of this node. The connected nodes are
-    /// generated by Mesh::setNodesConnectedByEdges() and
+    /// generated and stored by Mesh::setNodesConnectedByEdges() and
     /// Mesh::setNodesConnectedByElements().
-    void setConnectedNodes(std::vector<Node*> &connected_nodes)
+    void setConnectedNodes(BaseLib::ArrayView<Node* const> const connected_nodes)
     {
         _connected_nodes = connected_nodes;
     }
@@ -98,8 +103,8 @@ protected:
     /// Sets the ID of a node to the given value.
     void setID(std::size_t id) { _id = id; }
 
-    std::vector<Node*> _connected_nodes;
-    std::vector<Element*> _elements;
+    BaseLib::ArrayView<Node* const> _connected_nodes;
+    BaseLib::ArrayView<Element* const> _elements;
 }; /* class */
 
 /// Returns true if the given node is a base node of a (first) element, or if it
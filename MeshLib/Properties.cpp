@@ -118,6 +118,10 @@ Properties& Properties::operator=(Properties const& properties)
         return *this;
     }
 
+    for (auto name_vector_pair : _properties)
+    {
+        delete name_vector_pair.second;
+    }
     _properties = properties._properties;
     std::vector<std::size_t> exclude_positions;
     for (auto& name_vector_pair : _properties)
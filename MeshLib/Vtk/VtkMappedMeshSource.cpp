@@ -126,7 +126,8 @@ int VtkMappedMeshSource::RequestData(vtkInformation*,
     }
 
     // Arrays
-    MeshLib::Properties const& properties = _mesh->getProperties();
+    MeshLib::Properties const& properties =
+        _properties ? *_properties : _mesh->getProperties();
     std::vector<std::string> const& propertyNames =
         properties.getPropertyVectorNames();
 
@@ -58,6 +58,14 @@ public:
     /// Returns the mesh.
     const MeshLib::Mesh* GetMesh() const { return _mesh; }
 
+    /// Sets the properties mapped instead of the mesh's own properties, e.g.,
+    /// a snapshot of them taken at output time. Calling is optional.
+    void SetProperties(MeshLib::Properties const* properties)
+    {
+        this->_properties = properties;
+        this->Modified();
+    }
+
 protected:
     VtkMappedMeshSource();
 
@@ -82,6 +90,7 @@ private:
                      std::string const& prop_name) const;
 
     const MeshLib::Mesh* _mesh;
+    MeshLib::Properties const* _properties = nullptr;
 
     int NumberOfDimensions;
     int NumberOfNodes;
@@ -0,0 +1,191 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "SerialExecutor.h"
+
+namespace NumLib
+{
+/// Executor running the calls of executeMemberDereferenced() and
+/// executeIndexed() concurrently using OpenMP threads.
+///
+/// The loop iterations are distributed round-robin among the threads and each
+/// call may contain a section passed to executeOrdered(). Those sections are
+/// run one after another in the order of the container elements. That way the
+/// expensive element-local work is done in parallel while the scatter into the
+/// global matrices and vectors happens exactly in the same order as with the
+/// SerialExecutor, i.e., the results are bitwise reproducible independent of
+/// the number of threads.
+///
+/// All other methods are inherited from the SerialExecutor and run serially.
+///
+/// An exception thrown by a callback is caught inside the parallel region. The
+/// remaining iterations are skipped and the exception is rethrown after the
+/// loop.
+///
+/// \note The callbacks passed to executeMemberDereferenced() and
+/// executeIndexed() must be safe to be called concurrently for different
+/// container elements outside of the executeOrdered() sections.
+struct OpenMPExecutor : public SerialExecutor
+{
+    /// Sets the number of threads used by the parallel loops. A value of zero
+    /// restores the OpenMP default, i.e., \c omp_get_max_threads().
+    static void setNumberOfThreads(int const number_of_threads)
+    {
+        numberOfThreads() = number_of_threads;
+    }
+
+    /// Returns the number of threads used by the parallel loops.
+    static int getNumberOfThreads()
+    {
+        if (numberOfThreads() > 0)
+        {
+            return numberOfThreads();
+        }
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    /// Executes the given \c method of the given \c object for each element
+    /// from the input \c container in parallel.
+    ///
+    /// \see SerialExecutor::executeMemberDereferenced()
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    static void executeMemberDereferenced(Object& object, Method method,
+                                          Container const& container,
+                                          Args&&... args)
+    {
+        // OpenMP 2.0 (MSVC) requires a signed loop variable.
+        auto const size = static_cast<std::ptrdiff_t>(container.size());
+        int const number_of_threads = getNumberOfThreads();
+        (void)number_of_threads;  // unused if compiled without OpenMP.
+
+        std::atomic<bool> failed{false};
+        std::exception_ptr exception;
+#pragma omp parallel for ordered schedule(static, 1) \
+    num_threads(number_of_threads)
+        for (std::ptrdiff_t i = 0; i < size; i++)
+        {
+            if (failed)
+            {
+                continue;
+            }
+            try
+            {
+                (object.*method)(static_cast<std::size_t>(i), *container[i],
+                                 args...);
+            }
+            catch (...)
+            {
+                storeException(failed, exception);
+            }
+        }
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /// Executes \c f for each index from zero to \c size - 1 in parallel.
+    ///
+    /// \see SerialExecutor::executeIndexed()
+    template <typename F>
+    static void executeIndexed(std::size_t const size, F const& f)
+    {
+        auto const signed_size = static_cast<std::ptrdiff_t>(size);
+        int const number_of_threads = getNumberOfThreads();
+        (void)number_of_threads;  // unused if compiled without OpenMP.
+
+        std::atomic<bool> failed{false};
+        std::exception_ptr exception;
+#pragma omp parallel for ordered schedule(static, 1) \
+    num_threads(number_of_threads)
+        for (std::ptrdiff_t i = 0; i < signed_size; i++)
+        {
+            if (failed)
+            {
+                continue;
+            }
+            try
+            {
+                f(static_cast<std::size_t>(i));
+            }
+            catch (...)
+            {
+                storeException(failed, exception);
+            }
+        }
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /// Runs \c f in the order of the loop iterations of the enclosing
+    /// executeMemberDereferenced() or executeIndexed() call.
+    ///
+    /// An exception must not leave the ordered section. It is caught there
+    /// and rethrown afterwards.
+    template <typename F>
+    static void executeOrdered(F const& f)
+    {
+        std::exception_ptr exception;
+#pragma omp ordered
+        {
+            try
+            {
+                f();
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+        }
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    /// Keeps the first exception thrown in a parallel loop.
+    static void storeException(std::atomic<bool>& failed,
+                               std::exception_ptr& exception)
+    {
+#pragma omp critical(OpenMPExecutor_exception)
+        {
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+        failed = true;
+    }
+
+    static int& numberOfThreads()
+    {
+        static int number_of_threads = 0;
+        return number_of_threads;
+    }
+};
+
+}  // namespace NumLib
@@ -127,6 +127,29 @@ struct SerialExecutor
         for (std::size_t i = 0; i < c.size(); i++)
             f(i, *c[i], data[i], std::forward<Args_>(args)...);
     }
+
+    /// Executes \c f for each index from zero to \c size - 1.
+    ///
+    /// \param size number of loop iterations.
+    /// \param f    a function accepting the index as argument.
+    template <typename F>
+    static void executeIndexed(std::size_t const size, F const& f)
+    {
+        for (std::size_t i = 0; i < size; i++)
+            f(i);
+    }
+
+    /// Runs \c f immediately.
+    ///
+    /// Parallel executors run \c f in the order of the loop iterations of the
+    /// enclosing executeMemberDereferenced() or executeIndexed() call. It is
+    /// used to guard code which must not run concurrently, e.g., adding local
+    /// matrices to the global ones.
+    template <typename F>
+    static void executeOrdered(F const& f)
+    {
+        f();
+    }
 };
 
 }   // namespace NumLib
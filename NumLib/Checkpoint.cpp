@@ -0,0 +1,54 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Checkpoint.h"
+
+#include <numeric>
+
+#include "MathLib/LinAlg/LinAlg.h"
+
+namespace NumLib
+{
+void writeCheckpointVector(std::ostream& os, GlobalVector const& x)
+{
+    std::vector<GlobalIndexType> indices(x.getRangeEnd() - x.getRangeBegin());
+    std::iota(indices.begin(), indices.end(), x.getRangeBegin());
+
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+    std::vector<double> values;
+    x.get(indices, values);
+
+    writeCheckpointValue(os, values);
+}
+
+void readCheckpointVector(std::istream& is, GlobalVector& x)
+{
+    std::vector<double> values;
+    readCheckpointValue(is, values);
+
+    auto const range_begin = x.getRangeBegin();
+    if (values.size() !=
+        static_cast<std::size_t>(x.getRangeEnd() - range_begin))
+    {
+        OGS_FATAL(
+            "The checkpoint contains %zu entries of a global vector, but %zu "
+            "entries were expected. Restarts are only possible with the same "
+            "mesh, processes and number of MPI ranks.",
+            values.size(),
+            static_cast<std::size_t>(x.getRangeEnd() - range_begin));
+    }
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        x.set(range_begin + static_cast<GlobalIndexType>(i), values[i]);
+    }
+    MathLib::LinAlg::finalizeAssembly(x);
+}
+
+}  // namespace NumLib
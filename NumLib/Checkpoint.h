@@ -0,0 +1,115 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "BaseLib/Error.h"
+#include "NumLib/NumericsConfig.h"
+
+namespace NumLib
+{
+//! \name Binary serialization of the simulation state for checkpoints.
+//! The data are written in the native byte order without any padding, i.e.,
+//! a checkpoint can only be read on the same platform and by the same build
+//! configuration that has written it.
+//! @{
+
+template <typename T>
+void writeCheckpointValue(std::ostream& os, T const& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable types can be written directly.");
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <typename T>
+void readCheckpointValue(std::istream& is, T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable types can be read directly.");
+    if (!is.read(reinterpret_cast<char*>(&value), sizeof(T)))
+    {
+        OGS_FATAL("The checkpoint is truncated or corrupt.");
+    }
+}
+
+//! Writes the size of the vector followed by its entries.
+template <typename T>
+void writeCheckpointValue(std::ostream& os, std::vector<T> const& values)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable types can be written directly.");
+    writeCheckpointValue(os, values.size());
+    os.write(reinterpret_cast<char const*>(values.data()),
+             values.size() * sizeof(T));
+}
+
+template <typename T>
+void readCheckpointValue(std::istream& is, std::vector<T>& values)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable types can be read directly.");
+    std::size_t size;
+    readCheckpointValue(is, size);
+    values.resize(size);
+    if (!is.read(reinterpret_cast<char*>(values.data()), size * sizeof(T)))
+    {
+        OGS_FATAL("The checkpoint is truncated or corrupt.");
+    }
+}
+
+//! Writes the entries of a dense Eigen matrix or vector.
+template <typename Derived>
+void writeCheckpointMatrix(std::ostream& os,
+                           Eigen::MatrixBase<Derived> const& m)
+{
+    writeCheckpointValue(os, static_cast<std::size_t>(m.size()));
+    for (Eigen::Index i = 0; i < m.size(); ++i)
+    {
+        writeCheckpointValue(os, m(i));
+    }
+}
+
+//! Reads the entries of a dense Eigen matrix or vector, whose size must be the
+//! one of the written matrix.
+template <typename Derived>
+void readCheckpointMatrix(std::istream& is, Eigen::MatrixBase<Derived>& m)
+{
+    std::size_t size;
+    readCheckpointValue(is, size);
+    if (size != static_cast<std::size_t>(m.size()))
+    {
+        OGS_FATAL(
+            "The checkpoint contains a matrix of size %zu, but a matrix of size "
+            "%zu was expected.",
+            size, static_cast<std::size_t>(m.size()));
+    }
+    for (Eigen::Index i = 0; i < m.size(); ++i)
+    {
+        readCheckpointValue(is, m(i));
+    }
+}
+
+//! Writes the entries of \c x owned by this process.
+void writeCheckpointVector(std::ostream& os, GlobalVector const& x);
+
+//! Reads the entries written by writeCheckpointVector() into \c x, which must
+//! have the same parallel layout as the written vector.
+void readCheckpointVector(std::istream& is, GlobalVector& x);
+
+//! @}
+}  // namespace NumLib
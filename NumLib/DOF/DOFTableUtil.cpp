@@ -9,6 +9,7 @@
 
 #include "DOFTableUtil.h"
 #include <cassert>
+#include <Eigen/Core>
 
 namespace NumLib
 {
@@ -122,19 +123,25 @@ std::vector<GlobalIndexType> getIndices(
     std::size_t const mesh_item_id,
     NumLib::LocalToGlobalIndexMap const& dof_table)
 {
-    assert(dof_table.size() > mesh_item_id);
     std::vector<GlobalIndexType> indices;
+    getIndices(mesh_item_id, dof_table, indices);
+    return indices;
+}
+
+void getIndices(std::size_t const mesh_item_id,
+                NumLib::LocalToGlobalIndexMap const& dof_table,
+                std::vector<GlobalIndexType>& indices)
+{
+    assert(dof_table.size() > mesh_item_id);
+    indices.clear();
 
     // Local matrices and vectors will always be ordered by component
     // no matter what the order of the global matrix is.
     for (int c = 0; c < dof_table.getNumberOfComponents(); ++c)
     {
         auto const& idcs = dof_table(mesh_item_id, c).rows;
-        indices.reserve(indices.size() + idcs.size());
         indices.insert(indices.end(), idcs.begin(), idcs.end());
     }
-
-    return indices;
 }
 
 NumLib::LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
@@ -174,4 +181,93 @@ double norm(GlobalVector const& x, unsigned const global_component,
     }
 }
 
+NonGhostNodalIndices getNonGhostNodalIndices(
+    LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
+{
+    NonGhostNodalIndices nodal_indices;
+    auto& indices = nodal_indices.indices;
+    auto& offsets = nodal_indices.offsets;
+
+    auto const number_of_components = dof_table.getNumberOfComponents();
+    offsets.reserve(number_of_components + 1);
+    offsets.push_back(0);
+    for (int c = 0; c < number_of_components; ++c)
+    {
+        auto const& ms = dof_table.getMeshSubset(c);
+        assert(ms.getMeshID() == mesh.getID());
+        indices.reserve(indices.size() + ms.getNumberOfNodes());
+
+        for (MeshLib::Node const* node : ms.getNodes())
+        {
+            MeshLib::Location const l{mesh.getID(),
+                                      MeshLib::MeshItemType::Node,
+                                      node->getID()};
+            auto const index = dof_table.getGlobalIndex(l, c);
+            assert(index != NumLib::MeshComponentMap::nop);
+
+            if (index < 0)  // ghost node values do not contribute
+                continue;
+            indices.push_back(index);
+        }
+        offsets.push_back(indices.size());
+    }
+
+    return nodal_indices;
+}
+
+std::vector<double> norms(GlobalVector const& x,
+                          NonGhostNodalIndices const& nodal_indices,
+                          MathLib::VecNormType norm_type)
+{
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+
+    // Gather the values of all components at once. Afterwards each component
+    // is a contiguous segment, which Eigen reduces with vectorized kernels.
+    std::vector<double> values;
+    x.get(nodal_indices.indices, values);
+    Eigen::Map<const Eigen::VectorXd> const all_values(
+        values.data(), static_cast<Eigen::Index>(values.size()));
+
+    auto const& offsets = nodal_indices.offsets;
+    auto const number_of_components = offsets.size() - 1;
+    std::vector<double> result(number_of_components, 0.0);
+    for (std::size_t c = 0; c < number_of_components; ++c)
+    {
+        auto const size = static_cast<Eigen::Index>(offsets[c + 1] - offsets[c]);
+        if (size == 0)
+            continue;
+        auto const component_values = all_values.segment(offsets[c], size);
+
+        switch (norm_type)
+        {
+            case MathLib::VecNormType::NORM1:
+                result[c] = component_values.lpNorm<1>();
+                break;
+            case MathLib::VecNormType::NORM2:
+                result[c] = component_values.squaredNorm();
+                break;
+            case MathLib::VecNormType::INFINITY_N:
+                result[c] = component_values.lpNorm<Eigen::Infinity>();
+                break;
+            default:
+                OGS_FATAL("An invalid norm type has been passed.");
+        }
+    }
+
+#ifdef USE_PETSC
+    MPI_Allreduce(MPI_IN_PLACE, result.data(),
+                  static_cast<int>(number_of_components), MPI_DOUBLE,
+                  norm_type == MathLib::VecNormType::INFINITY_N ? MPI_MAX
+                                                                : MPI_SUM,
+                  PETSC_COMM_WORLD);
+#endif
+
+    if (norm_type == MathLib::VecNormType::NORM2)
+    {
+        for (auto& r : result)
+            r = std::sqrt(r);
+    }
+    return result;
+}
+
 }  // namespace NumLib
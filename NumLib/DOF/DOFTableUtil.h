@@ -35,6 +35,13 @@ std::vector<GlobalIndexType> getIndices(
     std::size_t const mesh_item_id,
     NumLib::LocalToGlobalIndexMap const& dof_table);
 
+//! Stores the nodal indices for the item identified by \c mesh_item_id from
+//! the given \c dof_table in \c indices. The storage of \c indices is reused
+//! if it is large enough.
+void getIndices(std::size_t const mesh_item_id,
+                NumLib::LocalToGlobalIndexMap const& dof_table,
+                std::vector<GlobalIndexType>& indices);
+
 //! Returns row/column indices for the item identified by \c id from the
 //! given \c dof_table.
 LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
@@ -50,6 +57,28 @@ double norm(GlobalVector const& x, unsigned const global_component,
             MathLib::VecNormType norm_type,
             LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
 
+//! Global indices of the non-ghost nodal d.o.f. of all global components of a
+//! d.o.f. table, stored contiguously component by component.
+struct NonGhostNodalIndices
+{
+    std::vector<GlobalIndexType> indices;
+    //! The indices of global component \c c are stored in the range
+    //! [offsets[c], offsets[c+1]) of \c indices.
+    std::vector<std::size_t> offsets;
+};
+
+//! Collects the global indices of the non-ghost nodal d.o.f. of all global
+//! components of the given \c dof_table.
+NonGhostNodalIndices getNonGhostNodalIndices(
+    LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
+
+//! Computes the specified norm of each global component of the given vector x
+//! in a single pass. The result is the same as calling norm() for each
+//! component, but the d.o.f. table is not searched.
+std::vector<double> norms(GlobalVector const& x,
+                          NonGhostNodalIndices const& nodal_indices,
+                          MathLib::VecNormType norm_type);
+
 /// Copies part of a global vector for the given variable into output_vector
 /// while applying a function to each value.
 ///
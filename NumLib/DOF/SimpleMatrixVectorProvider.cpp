@@ -9,6 +9,7 @@
 
 #include "SimpleMatrixVectorProvider.h"
 
+#include <algorithm>
 #include <cassert>
 #include <logog/include/logog.hpp>
 
@@ -20,36 +21,54 @@ namespace LinAlg = MathLib::LinAlg;
 
 namespace detail
 {
+// Estimates of the memory occupied by the given matrix/vector on this rank.
+#ifdef USE_PETSC
+std::size_t estimateMemory(GlobalVector const& x)
+{
+    if (x.getRawVector() == nullptr)
+        return 0;
+    PetscInt size;
+    VecGetLocalSize(x.getRawVector(), &size);
+    return (size + x.getGhostSize()) * sizeof(PetscScalar);
+}
 
-template<typename MatVec>
-MatVec*
-transfer(std::map<std::size_t, MatVec*>& from_unused,
-         std::map<MatVec*, std::size_t>& to_used,
-         typename std::map<std::size_t, MatVec*>::iterator it)
+std::size_t estimateMemory(GlobalMatrix const& A)
+{
+    if (A.getRawMatrix() == nullptr)
+        return 0;
+    MatInfo info;
+    MatGetInfo(A.getRawMatrix(), MAT_LOCAL, &info);
+    return static_cast<std::size_t>(info.memory);
+}
+#else
+std::size_t estimateMemory(GlobalVector const& x)
 {
-    auto const id = it->first;
-    auto& ptr = it->second;
+    return x.size() * sizeof(double);
+}
 
-    auto res = to_used.emplace(ptr, id);
-    assert(res.second && "Emplacement failed.");
-    from_unused.erase(it);
-    return res.first->first;
+std::size_t estimateMemory(GlobalMatrix const& A)
+{
+    auto const& mat = A.getRawMatrix();
+    using StorageIndex = GlobalMatrix::RawMatrixType::StorageIndex;
+    return mat.data().allocatedSize() *
+               (sizeof(double) + sizeof(StorageIndex)) +
+           (mat.outerSize() + 1) * sizeof(StorageIndex);
 }
+#endif
 
-template<typename MatVec>
-void
-transfer(std::map<MatVec*, std::size_t>& from_used,
-         std::map<std::size_t, MatVec*>& to_unused,
-         typename std::map<MatVec*, std::size_t>::iterator it)
+// Clears all data of a matrix/vector depending on the user it has been
+// handed out to before.
+template <typename MatVec>
+void prepareForReuse(MatVec& /*mat_vec*/)
 {
-    auto& ptr = it->first;
-    auto const id = it->second;
+}
 
-    auto res = to_unused.emplace(id, ptr);
-    assert(res.second && "Emplacement failed.");
-    (void) res; // res unused if NDEBUG
-    from_used.erase(it);
+#ifndef USE_PETSC
+void prepareForReuse(GlobalMatrix& A)
+{
+    A.clearValueOffsets();
 }
+#endif
 
 } // detail
 
@@ -57,13 +76,41 @@ transfer(std::map<MatVec*, std::size_t>& from_used,
 namespace NumLib
 {
 
+template <typename MatVec>
+SimpleMatrixVectorProvider::SizeClass SimpleMatrixVectorProvider::getSizeClass(
+    Storage<MatVec> const& /*storage*/) const
+{
+    return {};
+}
+
+template <typename MatVec>
+SimpleMatrixVectorProvider::SizeClass SimpleMatrixVectorProvider::getSizeClass(
+    Storage<MatVec> const& storage, MatVec const& source) const
+{
+    auto const it = storage.infos.find(&source);
+    if (it == storage.infos.end())  // not managed here, the layout is unknown
+        return {};
+    return it->second.size_class;
+}
+
+template <typename MatVec>
+SimpleMatrixVectorProvider::SizeClass SimpleMatrixVectorProvider::getSizeClass(
+    Storage<MatVec> const& /*storage*/,
+    MathLib::MatrixSpecifications const& ms) const
+{
+    SizeClass size_class;
+    size_class.is_known = true;
+    size_class.nrows = ms.nrows;
+    size_class.ncols = ms.ncols;
+    size_class.ghost_indices = ms.ghost_indices;
+    size_class.sparsity_pattern = ms.sparsity_pattern;
+    return size_class;
+}
+
 template<bool do_search, typename MatVec, typename... Args>
 std::pair<MatVec*, bool>
 SimpleMatrixVectorProvider::
-get_(std::size_t& id,
-     std::map<std::size_t, MatVec*>& unused_map,
-     std::map<MatVec*, std::size_t>& used_map,
-     Args&&... args)
+get_(std::size_t& id, Storage<MatVec>& storage, Args&&... args)
 {
     if (id >= _next_id) {
         OGS_FATAL("An obviously uninitialized id argument has been passed."
@@ -74,26 +121,106 @@ get_(std::size_t& id,
 
     if (do_search)
     {
-        auto it = unused_map.find(id);
-        if (it != unused_map.end()) // unused matrix/vector found
-            return { ::detail::transfer(unused_map, used_map, it), false };
+        auto it = storage.unused.find(id);
+        if (it != storage.unused.end()) // unused matrix/vector found
+        {
+            auto* const ptr = it->second;
+            storage.unused.erase(it);
+            storage.used.emplace(ptr, id);
+            ++_statistics.number_of_reuses;
+            updateStatistics(storage, *ptr, true);
+            return {ptr, false};
+        }
+    }
+
+    // Take an unused matrix/vector of the same size class.
+    auto const size_class = getSizeClass(storage, args...);
+    auto const it = std::find_if(
+        storage.unused.begin(), storage.unused.end(),
+        [&](std::pair<std::size_t const, MatVec*> const& id_ptr) {
+            return storage.infos.at(id_ptr.second)
+                .size_class.matches(size_class);
+        });
+    if (it != storage.unused.end())
+    {
+        auto* const ptr = it->second;
+        storage.unused.erase(it);
+        id = _next_id++;
+        storage.used.emplace(ptr, id);
+        ::detail::prepareForReuse(*ptr);
+        ++_statistics.number_of_reuses;
+        updateStatistics(storage, *ptr, true);
+        return {ptr, false};
     }
 
-    // not searched or not found, so create a new one
+    // not found, so create a new one
     id = _next_id++;
-    auto res = used_map.emplace(
-        MathLib::MatrixVectorTraits<MatVec>::newInstance(std::forward<Args>(args)...).release(),
-        id);
+    auto* const ptr = MathLib::MatrixVectorTraits<MatVec>::newInstance(
+                          std::forward<Args>(args)...)
+                          .release();
+    auto res = storage.used.emplace(ptr, id);
     assert(res.second && "Emplacement failed.");
-    return { res.first->first, true };
+    (void) res; // res unused if NDEBUG
+    storage.infos.emplace(ptr, ObjectInfo{size_class, 0, false});
+    ++_statistics.number_of_allocations;
+    updateStatistics(storage, *ptr, true);
+    return {ptr, true};
 }
 
-template<bool do_search, typename... Args>
-std::pair<GlobalMatrix*, bool>
-SimpleMatrixVectorProvider::
-getMatrix_(std::size_t& id, Args&&... args)
+template <bool do_search, typename MatVec>
+MatVec& SimpleMatrixVectorProvider::getCopy_(std::size_t& id,
+                                             Storage<MatVec>& storage,
+                                             MatVec const& source)
+{
+    auto const& res = get_<do_search>(id, storage, source);
+    if (!res.second) // no new object has been created
+    {
+        LinAlg::copy(source, *res.first);
+        updateStatistics(storage, *res.first, true);
+    }
+    return *res.first;
+}
+
+template <typename MatVec>
+void SimpleMatrixVectorProvider::release_(Storage<MatVec>& storage,
+                                          MatVec const& mat_vec)
+{
+    auto it = storage.used.find(const_cast<MatVec*>(&mat_vec));
+    if (it == storage.used.end()) {
+        OGS_FATAL(
+            "The given matrix/vector has not been found. Cannot release it. "
+            "Aborting.");
+    }
+
+    updateStatistics(storage, mat_vec, false);
+    auto res = storage.unused.emplace(it->second, it->first);
+    assert(res.second && "Emplacement failed.");
+    (void) res; // res unused if NDEBUG
+    storage.used.erase(it);
+}
+
+template <typename MatVec>
+void SimpleMatrixVectorProvider::updateStatistics(Storage<MatVec>& storage,
+                                                  MatVec const& mat_vec,
+                                                  bool const is_used)
 {
-    return get_<do_search>(id, _unused_matrices, _used_matrices, std::forward<Args>(args)...);
+    auto& info = storage.infos.at(&mat_vec);
+    auto& s = _statistics;
+
+    s.allocated_bytes -= info.bytes;
+    if (info.is_used)
+        s.used_bytes -= info.bytes;
+
+    info.bytes = ::detail::estimateMemory(mat_vec);
+    info.is_used = is_used;
+
+    s.allocated_bytes += info.bytes;
+    if (info.is_used)
+        s.used_bytes += info.bytes;
+
+    s.peak_allocated_bytes =
+        std::max(s.peak_allocated_bytes, s.allocated_bytes);
+    s.peak_used_bytes = std::max(s.peak_used_bytes, s.used_bytes);
 }
 
 
@@ -102,14 +229,14 @@ SimpleMatrixVectorProvider::
 getMatrix()
 {
     std::size_t id = 0u;
-    return *getMatrix_<false>(id).first;
+    return *get_<false>(id, _matrices).first;
 }
 
 GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(std::size_t& id)
 {
-    return *getMatrix_<true>(id).first;
+    return *get_<true>(id, _matrices).first;
 }
 
 GlobalMatrix&
@@ -117,7 +244,7 @@ SimpleMatrixVectorProvider::
 getMatrix(MathLib::MatrixSpecifications const& ms)
 {
     std::size_t id = 0u;
-    return *getMatrix_<false>(id, ms).first;
+    return *get_<false>(id, _matrices, ms).first;
     // TODO assert that the returned object always is of the right size
 }
 
@@ -125,7 +252,7 @@ GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(MathLib::MatrixSpecifications const& ms, std::size_t& id)
 {
-    return *getMatrix_<true>(id, ms).first;
+    return *get_<true>(id, _matrices, ms).first;
     // TODO assert that the returned object always is of the right size
 }
 
@@ -134,56 +261,36 @@ SimpleMatrixVectorProvider::
 getMatrix(GlobalMatrix const& A)
 {
     std::size_t id = 0u;
-    auto const& res = getMatrix_<false>(id, A);
-    if (!res.second) // no new object has been created
-        LinAlg::copy(A, *res.first);
-    return *res.first;
+    return getCopy_<false>(id, _matrices, A);
 }
 
 GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(GlobalMatrix const& A, std::size_t& id)
 {
-    auto const& res = getMatrix_<true>(id, A);
-    if (!res.second) // no new object has been created
-        LinAlg::copy(A, *res.first);
-    return *res.first;
+    return getCopy_<true>(id, _matrices, A);
 }
 
 void
 SimpleMatrixVectorProvider::
 releaseMatrix(GlobalMatrix const& A)
 {
-    auto it = _used_matrices.find(const_cast<GlobalMatrix*>(&A));
-    if (it == _used_matrices.end()) {
-        OGS_FATAL("The given matrix has not been found. Cannot release it. Aborting.");
-    } else {
-        ::detail::transfer(_used_matrices, _unused_matrices, it);
-    }
-}
-
-template<bool do_search, typename... Args>
-std::pair<GlobalVector*, bool>
-SimpleMatrixVectorProvider::
-getVector_(std::size_t& id, Args&&... args)
-{
-    return get_<do_search>(id, _unused_vectors, _used_vectors, std::forward<Args>(args)...);
+    release_(_matrices, A);
 }
 
-
 GlobalVector&
 SimpleMatrixVectorProvider::
 getVector()
 {
     std::size_t id = 0u;
-    return *getVector_<false>(id).first;
+    return *get_<false>(id, _vectors).first;
 }
 
 GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(std::size_t& id)
 {
-    return *getVector_<true>(id).first;
+    return *get_<true>(id, _vectors).first;
 }
 
 GlobalVector&
@@ -191,7 +298,7 @@ SimpleMatrixVectorProvider::
 getVector(MathLib::MatrixSpecifications const& ms)
 {
     std::size_t id = 0u;
-    return *getVector_<false>(id, ms).first;
+    return *get_<false>(id, _vectors, ms).first;
     // TODO assert that the returned object always is of the right size
 }
 
@@ -199,7 +306,7 @@ GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(MathLib::MatrixSpecifications const& ms, std::size_t& id)
 {
-    return *getVector_<true>(id, ms).first;
+    return *get_<true>(id, _vectors, ms).first;
     // TODO assert that the returned object always is of the right size
 }
 
@@ -208,52 +315,51 @@ SimpleMatrixVectorProvider::
 getVector(GlobalVector const& x)
 {
     std::size_t id = 0u;
-    auto const& res = getVector_<false>(id, x);
-    if (!res.second) // no new object has been created
-        LinAlg::copy(x, *res.first);
-    return *res.first;
+    return getCopy_<false>(id, _vectors, x);
 }
 
 GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(GlobalVector const& x, std::size_t& id)
 {
-    auto const& res = getVector_<true>(id, x);
-    if (!res.second) // no new object has been created
-        LinAlg::copy(x, *res.first);
-    return *res.first;
+    return getCopy_<true>(id, _vectors, x);
 }
 
 void
 SimpleMatrixVectorProvider::
 releaseVector(GlobalVector const& x)
 {
-    auto it = _used_vectors.find(const_cast<GlobalVector*>(&x));
-    if (it == _used_vectors.end()) {
-        OGS_FATAL("The given vector has not been found. Cannot release it. Aborting.");
-    } else {
-        ::detail::transfer(_used_vectors, _unused_vectors, it);
-    }
+    release_(_vectors, x);
 }
 
 SimpleMatrixVectorProvider::
 ~SimpleMatrixVectorProvider()
 {
-    if ((!_used_matrices.empty()) || (!_used_vectors.empty())) {
+    if ((!_matrices.used.empty()) || (!_vectors.used.empty())) {
         WARN("There are still some matrices and vectors in use."
              " This might be an indicator of a possible waste of memory.");
     }
 
-    for (auto& id_ptr : _unused_matrices)
+    if (_statistics.number_of_allocations > 0)
+    {
+        INFO(
+            "Matrices and vectors: %zu allocations, %zu reuses, peak memory "
+            "%.3g MB allocated, %.3g MB in use.",
+            _statistics.number_of_allocations, _statistics.number_of_reuses,
+            _statistics.peak_allocated_bytes / 1e6,
+            _statistics.peak_used_bytes / 1e6);
+    }
+
+    for (auto& id_ptr : _matrices.unused)
         delete id_ptr.second;
 
-    for (auto& ptr_id : _used_matrices)
+    for (auto& ptr_id : _matrices.used)
         delete ptr_id.first;
 
-    for (auto& id_ptr : _unused_vectors)
+    for (auto& id_ptr : _vectors.unused)
         delete id_ptr.second;
 
-    for (auto& ptr_id : _used_vectors)
+    for (auto& ptr_id : _vectors.used)
         delete ptr_id.first;
 }
 
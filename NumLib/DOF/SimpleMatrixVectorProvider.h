@@ -21,14 +21,35 @@ namespace NumLib
  *
  * This is a simple implementation of the MatrixProvider and VectorProvider interfaces.
  *
- * It is simple insofar it does not reuse released matrices/vectors, but keeps them in
- * memory until they are acquired again by the user.
+ * Released matrices/vectors are kept in memory. They are handed out again to
+ * the user holding their \c id or, if they belong to the requested size
+ * class, to any other user requesting a matrix/vector of that size class,
+ * such that the number of simultaneously allocated objects is kept small.
+ * The size class of an object is given by the MathLib::MatrixSpecifications
+ * it has been created from or, for copies, by the size class of the copied
+ * object. Objects requested without specifications are only reused by
+ * \c id.
  */
 class SimpleMatrixVectorProvider final
         : public MatrixProvider
         , public VectorProvider
 {
 public:
+    /// Counters of the allocations and of the (estimated) memory used by the
+    /// matrices and vectors.
+    struct Statistics
+    {
+        std::size_t number_of_allocations = 0;
+        /// Number of objects handed out again after they had been released.
+        std::size_t number_of_reuses = 0;
+        /// Memory of the objects currently acquired by users.
+        std::size_t used_bytes = 0;
+        std::size_t peak_used_bytes = 0;
+        /// Memory of all objects including the released ones.
+        std::size_t allocated_bytes = 0;
+        std::size_t peak_allocated_bytes = 0;
+    };
+
     SimpleMatrixVectorProvider() = default;
 
     // no copies
@@ -57,31 +78,82 @@ public:
 
     void releaseMatrix(GlobalMatrix const& A) override;
 
+    Statistics const& getStatistics() const { return _statistics; }
+
     ~SimpleMatrixVectorProvider() override;
 
 private:
-    template<bool do_search, typename... Args>
-    std::pair<GlobalMatrix*, bool> getMatrix_(std::size_t& id, Args&&... args);
-
-    template<bool do_search, typename... Args>
-    std::pair<GlobalVector*, bool> getVector_(std::size_t& id, Args&&... args);
+    /// Identifies matrices/vectors which can replace each other. The
+    /// pointers are only compared, never dereferenced. Objects of unknown
+    /// layout, e.g. requested without specifications, are not shared.
+    struct SizeClass
+    {
+        bool is_known = false;
+        std::size_t nrows = 0;
+        std::size_t ncols = 0;
+        void const* ghost_indices = nullptr;
+        void const* sparsity_pattern = nullptr;
+
+        bool matches(SizeClass const& other) const
+        {
+            return is_known && other.is_known && nrows == other.nrows &&
+                   ncols == other.ncols &&
+                   ghost_indices == other.ghost_indices &&
+                   sparsity_pattern == other.sparsity_pattern;
+        }
+    };
+
+    struct ObjectInfo
+    {
+        SizeClass size_class;
+        /// Estimated memory and state as accounted for in the statistics.
+        std::size_t bytes;
+        bool is_used;
+    };
+
+    template <typename MatVec>
+    struct Storage
+    {
+        std::map<std::size_t, MatVec*> unused;
+        std::map<MatVec*, std::size_t> used;
+        std::map<MatVec const*, ObjectInfo> infos;
+    };
+
+    template <typename MatVec>
+    SizeClass getSizeClass(Storage<MatVec> const& storage) const;
+    template <typename MatVec>
+    SizeClass getSizeClass(Storage<MatVec> const& storage,
+                           MatVec const& source) const;
+    template <typename MatVec>
+    SizeClass getSizeClass(Storage<MatVec> const& storage,
+                           MathLib::MatrixSpecifications const& ms) const;
 
     // returns a pair with the pointer to the matrix/vector and
     // a boolean indicating if a new object has been built (then true else false)
     template<bool do_search, typename MatVec, typename... Args>
     std::pair<MatVec*, bool>
-    get_(std::size_t& id,
-         std::map<std::size_t, MatVec*>& unused_map,
-         std::map<MatVec*, std::size_t>& used_map,
-         Args&&... args);
+    get_(std::size_t& id, Storage<MatVec>& storage, Args&&... args);
+
+    /// Gets a matrix/vector and copies \c source into it.
+    template <bool do_search, typename MatVec>
+    MatVec& getCopy_(std::size_t& id, Storage<MatVec>& storage,
+                     MatVec const& source);
+
+    template <typename MatVec>
+    void release_(Storage<MatVec>& storage, MatVec const& mat_vec);
+
+    /// Updates the memory statistics after the given object has been
+    /// acquired (\c is_used is true) or released.
+    template <typename MatVec>
+    void updateStatistics(Storage<MatVec>& storage, MatVec const& mat_vec,
+                          bool const is_used);
 
     std::size_t _next_id = 1;
 
-    std::map<std::size_t, GlobalMatrix*> _unused_matrices;
-    std::map<GlobalMatrix*, std::size_t> _used_matrices;
+    Storage<GlobalMatrix> _matrices;
+    Storage<GlobalVector> _vectors;
 
-    std::map<std::size_t, GlobalVector*> _unused_vectors;
-    std::map<GlobalVector*, std::size_t> _used_vectors;
+    Statistics _statistics;
 };
 
 
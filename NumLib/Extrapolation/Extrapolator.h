@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <Eigen/Eigen>
@@ -32,6 +33,26 @@ public:
         GlobalVector const& current_solution,
         LocalToGlobalIndexMap const& dof_table) = 0;
 
+    /*! Extrapolates several properties in a single pass over the elements.
+     *
+     * \param num_components  the number of components of each property.
+     * \param extrapolatables the properties to be extrapolated.
+     * \param nodal_values    the extrapolated nodal values, one vector per
+     *                        property. The vectors are (re)allocated if
+     *                        necessary.
+     *
+     * \note getNodalValues() and calculateResiduals() refer to the last call of
+     * the single property version of extrapolate() only.
+     */
+    virtual void extrapolate(
+        std::vector<unsigned> const& num_components,
+        std::vector<ExtrapolatableElementCollection const*> const&
+            extrapolatables,
+        const double t,
+        GlobalVector const& current_solution,
+        LocalToGlobalIndexMap const& dof_table,
+        std::vector<std::unique_ptr<GlobalVector>>& nodal_values) = 0;
+
     /*! Computes residuals from the extrapolation of the given \c property.
      *
      * The residuals are computed as element values.
@@ -15,8 +15,8 @@
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
-#include "NumLib/Assembler/SerialExecutor.h"
 #include "NumLib/Function/Interpolation.h"
+#include "NumLib/NumericsConfig.h"
 #include "ExtrapolatableElementCollection.h"
 
 namespace NumLib
@@ -44,10 +44,170 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
     const double t,
     GlobalVector const& current_solution,
     LocalToGlobalIndexMap const& dof_table)
+{
+    std::vector<std::unique_ptr<GlobalVector>> nodal_values(1);
+    nodal_values[0] = std::move(_nodal_values);
+
+    extrapolate({num_components}, {&extrapolatables}, t, current_solution,
+                dof_table, nodal_values);
+
+    _nodal_values = std::move(nodal_values[0]);
+}
+
+void LocalLinearLeastSquaresExtrapolator::extrapolate(
+    std::vector<unsigned> const& num_components,
+    std::vector<ExtrapolatableElementCollection const*> const& extrapolatables,
+    const double t,
+    GlobalVector const& current_solution,
+    LocalToGlobalIndexMap const& dof_table,
+    std::vector<std::unique_ptr<GlobalVector>>& nodal_values)
+{
+    auto const num_properties = extrapolatables.size();
+    assert(num_components.size() == num_properties);
+    if (num_properties == 0)
+    {
+        return;
+    }
+
+    auto const num_elements = extrapolatables.front()->size();
+    for (auto const* e : extrapolatables)
+    {
+        if (e->size() != num_elements)
+        {
+            OGS_FATAL(
+                "All extrapolated properties must be defined on the same "
+                "elements.");
+        }
+    }
+
+    nodal_values.resize(num_properties);
+    for (std::size_t p = 0; p < num_properties; ++p)
+    {
+        nodal_values[p] = createNodalValuesVector(num_components[p],
+                                                  std::move(nodal_values[p]));
+        nodal_values[p]->setZero();
+    }
+
+    // counts the writes to each nodal value, i.e., the summands in order to
+    // compute the average afterwards. The counts only depend on the number of
+    // components, so properties with the same number of components share them.
+    std::map<unsigned, std::unique_ptr<GlobalVector>> counts;
+    for (std::size_t p = 0; p < num_properties; ++p)
+    {
+        auto& c = counts[num_components[p]];
+        if (c)
+        {
+            continue;
+        }
+        c = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
+            *nodal_values[p]);
+        c->setZero();
+
+        std::vector<GlobalIndexType> indices;
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            getLocationWiseIndices(i, num_components[p], indices);
+            c->add(indices, std::vector<double>(indices.size(), 1.0));
+        }
+    }
+
+    // The elements are processed serially: the getIntegrationPointValues()
+    // callbacks of the local assemblers are not safe to be called
+    // concurrently, e.g., because of Parameter::operator().
+    std::vector<double> integration_point_values_cache;
+    std::vector<Eigen::MatrixXd> element_nodal_values(num_properties);
+    std::vector<GlobalIndexType> indices;
+    for (std::size_t element_index = 0; element_index < num_elements;
+         ++element_index)
+    {
+        auto const num_nodes = static_cast<unsigned>(
+            extrapolatables.front()->getShapeMatrix(element_index, 0).cols());
+
+        CachedData const* cached_data = nullptr;
+        unsigned cached_num_int_pts = 0;
+
+        for (std::size_t p = 0; p < num_properties; ++p)
+        {
+            auto const& integration_point_values =
+                extrapolatables[p]->getIntegrationPointValues(
+                    element_index, t, current_solution, dof_table,
+                    integration_point_values_cache);
+
+            auto const num_values =
+                static_cast<unsigned>(integration_point_values.size());
+
+            if (num_values % num_components[p] != 0)
+                OGS_FATAL(
+                    "The number of computed integration point values is not "
+                    "divisable by the number of num_components. Maybe the "
+                    "computed property is not a %d-component vector for each "
+                    "integration point.",
+                    num_components[p]);
+
+            // number of integration points in the element
+            const auto num_int_pts = num_values / num_components[p];
+
+            if (num_int_pts < num_nodes)
+                OGS_FATAL(
+                    "Least squares is not possible if there are more nodes "
+                    "than integration points.");
+
+            // All properties usually share the integration points.
+            if (cached_data == nullptr || num_int_pts != cached_num_int_pts)
+            {
+                cached_data =
+                    &getCachedData(element_index, *extrapolatables[p],
+                                   num_nodes, num_int_pts);
+                cached_num_int_pts = num_int_pts;
+            }
+
+            auto const integration_point_values_mat = MathLib::toMatrix(
+                integration_point_values, num_components[p], num_int_pts);
+
+            // Apply the pre-computed pseudo-inverse. The result is ordered
+            // component-wise.
+            element_nodal_values[p].noalias() =
+                cached_data->A_pinv * integration_point_values_mat.transpose();
+
+            getLocationWiseIndices(element_index, num_components[p], indices);
+
+            // TODO does that give rise to PETSc problems? E.g., writing to
+            // ghost nodes? Furthermore: Is ghost nodes communication
+            // necessary for PETSc?
+            // Nodal_values are passed as a raw pointer, because
+            // PETScVector and EigenVector implementations differ slightly.
+            nodal_values[p]->add(indices, element_nodal_values[p].data());
+        }
+    }
+
+    for (std::size_t p = 0; p < num_properties; ++p)
+    {
+        MathLib::LinAlg::finalizeAssembly(*nodal_values[p]);
+        MathLib::LinAlg::componentwiseDivide(*nodal_values[p],
+                                             *nodal_values[p],
+                                             *counts[num_components[p]]);
+    }
+}
+
+std::unique_ptr<GlobalVector>
+LocalLinearLeastSquaresExtrapolator::createNodalValuesVector(
+    unsigned const num_components,
+    std::unique_ptr<GlobalVector>&& nodal_values) const
 {
     auto const num_nodal_dof_result =
         _dof_table_single_component.dofSizeWithoutGhosts() * num_components;
 
+    if (nodal_values &&
+#ifdef USE_PETSC
+        nodal_values->getLocalSize() + nodal_values->getGhostSize()
+#else
+        nodal_values->size()
+#endif
+            == static_cast<GlobalIndexType>(num_nodal_dof_result))
+    {
+        return std::move(nodal_values);
+    }
+
     std::vector<GlobalIndexType> ghost_indices;
     {  // Create num_components times version of ghost_indices arranged by
        // location. For example for 3 components and ghost_indices {5,6,10} we
@@ -68,105 +228,37 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
         }
     }
 
-    if (!_nodal_values ||
-#ifdef USE_PETSC
-        _nodal_values->getLocalSize() + _nodal_values->getGhostSize()
-#else
-        _nodal_values->size()
-#endif
-            != static_cast<GlobalIndexType>(num_nodal_dof_result))
-    {
-        _nodal_values = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
-            {num_nodal_dof_result, num_nodal_dof_result, &ghost_indices,
-             nullptr});
-    }
-    _nodal_values->setZero();
-
-    // counts the writes to each nodal value, i.e., the summands in order to
-    // compute the average afterwards
-    auto counts =
-        MathLib::MatrixVectorTraits<GlobalVector>::newInstance(*_nodal_values);
-    counts->setZero();
-
-    auto const size = extrapolatables.size();
-    for (std::size_t i = 0; i < size; ++i)
-    {
-        extrapolateElement(i, num_components, extrapolatables, t,
-                           current_solution, dof_table, *counts);
-    }
-    MathLib::LinAlg::finalizeAssembly(*_nodal_values);
-
-    MathLib::LinAlg::componentwiseDivide(*_nodal_values, *_nodal_values,
-                                         *counts);
+    return MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
+        {num_nodal_dof_result, num_nodal_dof_result, &ghost_indices, nullptr});
 }
 
-void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
-    const unsigned num_components,
-    ExtrapolatableElementCollection const& extrapolatables,
-    const double t,
-    GlobalVector const& current_solution,
-    LocalToGlobalIndexMap const& dof_table)
+void LocalLinearLeastSquaresExtrapolator::getLocationWiseIndices(
+    std::size_t const element_index, unsigned const num_components,
+    std::vector<GlobalIndexType>& indices) const
 {
-    auto const num_element_dof_result = static_cast<GlobalIndexType>(
-        _dof_table_single_component.size() * num_components);
-
-    if (!_residuals || _residuals->size() != num_element_dof_result)
-    {
-#ifndef USE_PETSC
-        _residuals.reset(new GlobalVector{num_element_dof_result});
-#else
-        _residuals.reset(new GlobalVector{num_element_dof_result, false});
-#endif
-    }
+    auto const& global_indices =
+        _dof_table_single_component(element_index, 0).rows;
 
-    if (static_cast<std::size_t>(num_element_dof_result) !=
-        extrapolatables.size() * num_components)
-    {
-        OGS_FATAL("mismatch in number of D.o.F.");
-    }
+    indices.clear();
+    indices.reserve(num_components * global_indices.size());
 
-    auto const size = extrapolatables.size();
-    for (std::size_t i = 0; i < size; ++i)
+    // the nodal values are ordered location-wise
+    for (unsigned comp = 0; comp < num_components; ++comp)
     {
-        calculateResidualElement(i, num_components, extrapolatables, t,
-                                 current_solution, dof_table);
+        for (auto i : global_indices)
+        {
+            indices.push_back(num_components * i + comp);
+        }
     }
-    MathLib::LinAlg::finalizeAssembly(*_residuals);
 }
 
-void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
+LocalLinearLeastSquaresExtrapolator::CachedData const&
+LocalLinearLeastSquaresExtrapolator::getCachedData(
     std::size_t const element_index,
-    const unsigned num_components,
     ExtrapolatableElementCollection const& extrapolatables,
-    const double t,
-    GlobalVector const& current_solution,
-    LocalToGlobalIndexMap const& dof_table,
-    GlobalVector& counts)
+    unsigned const num_nodes, unsigned const num_int_pts)
 {
-    auto const& integration_point_values =
-        extrapolatables.getIntegrationPointValues(
-            element_index, t, current_solution, dof_table,
-            _integration_point_values_cache);
-
     auto const& N_0 = extrapolatables.getShapeMatrix(element_index, 0);
-    auto const num_nodes = static_cast<unsigned>(N_0.cols());
-    auto const num_values =
-        static_cast<unsigned>(integration_point_values.size());
-
-    if (num_values % num_components != 0)
-        OGS_FATAL(
-            "The number of computed integration point values is not divisable "
-            "by the number of num_components. Maybe the computed property is "
-            "not a %d-component vector for each integration point.",
-            num_components);
-
-    // number of integration points in the element
-    const auto num_int_pts = num_values / num_components;
-
-    if (num_int_pts < num_nodes)
-        OGS_FATAL(
-            "Least squares is not possible if there are more nodes than"
-            "integration points.");
 
     auto const pair_it_inserted = _qr_decomposition_cache.emplace(
         std::make_pair(num_nodes, num_int_pts), CachedData{});
@@ -220,50 +312,41 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
         OGS_FATAL("The cached and the passed shapematrices differ.");
     }
 
-    auto const& global_indices =
-        _dof_table_single_component(element_index, 0).rows;
+    return cached_data;
+}
 
-    if (num_components == 1)
+void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
+    const unsigned num_components,
+    ExtrapolatableElementCollection const& extrapolatables,
+    const double t,
+    GlobalVector const& current_solution,
+    LocalToGlobalIndexMap const& dof_table)
+{
+    auto const num_element_dof_result = static_cast<GlobalIndexType>(
+        _dof_table_single_component.size() * num_components);
+
+    if (!_residuals || _residuals->size() != num_element_dof_result)
     {
-        auto const integration_point_values_vec =
-            MathLib::toVector(integration_point_values);
-
-        // Apply the pre-computed pseudo-inverse.
-        Eigen::VectorXd const nodal_values =
-            cached_data.A_pinv * integration_point_values_vec;
-
-        // TODO does that give rise to PETSc problems? E.g., writing to ghost
-        // nodes? Furthermore: Is ghost nodes communication necessary for PETSc?
-        _nodal_values->add(global_indices, nodal_values);
-        counts.add(global_indices,
-                   std::vector<double>(global_indices.size(), 1.0));
+#ifndef USE_PETSC
+        _residuals.reset(new GlobalVector{num_element_dof_result});
+#else
+        _residuals.reset(new GlobalVector{num_element_dof_result, false});
+#endif
     }
-    else
-    {
-        auto const integration_point_values_mat = MathLib::toMatrix(
-            integration_point_values, num_components, num_int_pts);
-
-        // Apply the pre-computed pseudo-inverse.
-        Eigen::MatrixXd const nodal_values =
-            cached_data.A_pinv * integration_point_values_mat.transpose();
 
-        std::vector<GlobalIndexType> indices;
-        indices.reserve(num_components * global_indices.size());
-
-        // _nodal_values is ordered location-wise
-        for (unsigned comp = 0; comp < num_components; ++comp)
-        {
-            for (auto i : global_indices)
-            {
-                indices.push_back(num_components * i + comp);
-            }
-        }
+    if (static_cast<std::size_t>(num_element_dof_result) !=
+        extrapolatables.size() * num_components)
+    {
+        OGS_FATAL("mismatch in number of D.o.F.");
+    }
 
-        // Nodal_values are passed as a raw pointer, because PETScVector and
-        // EigenVector implementations differ slightly.
-        _nodal_values->add(indices, nodal_values.data());
-        counts.add(indices, std::vector<double>(indices.size(), 1.0));
+    auto const size = extrapolatables.size();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        calculateResidualElement(i, num_components, extrapolatables, t,
+                                 current_solution, dof_table);
     }
+    MathLib::LinAlg::finalizeAssembly(*_residuals);
 }
 
 void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
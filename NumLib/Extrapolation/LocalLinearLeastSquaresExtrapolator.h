@@ -10,7 +10,6 @@
 #pragma once
 
 #include <map>
-
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "Extrapolator.h"
@@ -52,6 +51,20 @@ public:
                      GlobalVector const& current_solution,
                      LocalToGlobalIndexMap const& dof_table) override;
 
+    /*! Extrapolates several properties in a single pass over the elements.
+     *
+     * For each element the pseudo-inverse is looked up only once and applied
+     * to the integration point values of all properties.
+     */
+    void extrapolate(
+        std::vector<unsigned> const& num_components,
+        std::vector<ExtrapolatableElementCollection const*> const&
+            extrapolatables,
+        const double t,
+        GlobalVector const& current_solution,
+        LocalToGlobalIndexMap const& dof_table,
+        std::vector<std::unique_ptr<GlobalVector>>& nodal_values) override;
+
     /*! \copydoc Extrapolator::calculateResiduals()
      *
      * The computed residuals are root-mean-square of the difference between
@@ -77,12 +90,35 @@ public:
     }
 
 private:
-    //! Extrapolate one element.
-    void extrapolateElement(
-        std::size_t const element_index, const unsigned num_components,
-        ExtrapolatableElementCollection const& extrapolatables, const double t,
-        GlobalVector const& current_solution,
-        LocalToGlobalIndexMap const& dof_table, GlobalVector& counts);
+    //! Stores a matrix and its Moore-Penrose pseudo-inverse.
+    struct CachedData
+    {
+        //! The matrix A.
+        Eigen::MatrixXd A;
+
+        //! Moore-Penrose pseudo-inverse of A.
+        Eigen::MatrixXd A_pinv;
+    };
+
+    //! Returns a vector for the nodal values of a property with the given
+    //! number of components, reusing \c nodal_values if possible.
+    std::unique_ptr<GlobalVector> createNodalValuesVector(
+        unsigned const num_components,
+        std::unique_ptr<GlobalVector>&& nodal_values) const;
+
+    //! Returns the global indices of the nodal values of the given element
+    //! for a property with the given number of components, ordered
+    //! component-wise.
+    void getLocationWiseIndices(std::size_t const element_index,
+                                unsigned const num_components,
+                                std::vector<GlobalIndexType>& indices) const;
+
+    //! Returns the cached pseudo-inverse for the given element, computing it
+    //! first if necessary. Can be called concurrently.
+    CachedData const& getCachedData(
+        std::size_t const element_index,
+        ExtrapolatableElementCollection const& extrapolatables,
+        unsigned const num_nodes, unsigned const num_int_pts);
 
     //! Compute the residuals for one element
     void calculateResidualElement(
@@ -102,16 +138,6 @@ private:
     //! Avoids frequent reallocations.
     std::vector<double> _integration_point_values_cache;
 
-    //! Stores a matrix and its Moore-Penrose pseudo-inverse.
-    struct CachedData
-    {
-        //! The matrix A.
-        Eigen::MatrixXd A;
-
-        //! Moore-Penrose pseudo-inverse of A.
-        Eigen::MatrixXd A_pinv;
-    };
-
     /*! Maps (\#nodes, \#int_pts) to (N_0, QR decomposition),
      * where N_0 is the shape matrix of the first integration point.
      *
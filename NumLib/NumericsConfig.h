@@ -19,5 +19,10 @@
 //
 // Global executor
 //
+#ifdef OGS_USE_OPENMP_ASSEMBLY
+#include "NumLib/Assembler/OpenMPExecutor.h"
+using GlobalExecutor = NumLib::OpenMPExecutor;
+#else
 #include "NumLib/Assembler/SerialExecutor.h"
 using GlobalExecutor = NumLib::SerialExecutor;
+#endif
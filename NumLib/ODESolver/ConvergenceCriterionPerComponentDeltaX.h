@@ -10,6 +10,7 @@
 #pragma once
 
 #include "MathLib/LinAlg/LinAlgEnums.h"
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "ConvergenceCriterionPerComponent.h"
 
 namespace NumLib
@@ -46,8 +47,8 @@ public:
 private:
     const std::vector<double> _abstols;
     const std::vector<double> _reltols;
-    LocalToGlobalIndexMap const* _dof_table = nullptr;
-    MeshLib::Mesh const* _mesh = nullptr;
+    //! Set by setDOFTable().
+    NonGhostNodalIndices _nodal_indices;
 };
 
 std::unique_ptr<ConvergenceCriterionPerComponentDeltaX>
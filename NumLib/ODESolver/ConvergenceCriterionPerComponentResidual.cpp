@@ -39,22 +39,22 @@ ConvergenceCriterionPerComponentResidual::
 void ConvergenceCriterionPerComponentResidual::checkDeltaX(
     const GlobalVector& minus_delta_x, GlobalVector const& x)
 {
-    if ((!_dof_table) || (!_mesh))
+    if (_nodal_indices.offsets.empty())
         OGS_FATAL("D.o.f. table or mesh have not been set.");
 
+    auto const errors_dx = norms(minus_delta_x, _nodal_indices, _norm_type);
+    auto const norms_x = norms(x, _nodal_indices, _norm_type);
+
     for (unsigned global_component = 0; global_component < _abstols.size();
          ++global_component)
     {
-        // TODO short cut if tol <= 0.0
-        auto error_dx = norm(minus_delta_x, global_component, _norm_type,
-                             *_dof_table, *_mesh);
-        auto norm_x =
-            norm(x, global_component, _norm_type, *_dof_table, *_mesh);
+        auto const error_dx = errors_dx[global_component];
+        auto const norm_x = norms_x[global_component];
 
         INFO(
             "Convergence criterion, component %u: |dx|=%.4e, |x|=%.4e, "
             "|dx|/|x|=%.4e",
-            error_dx, global_component, norm_x,
+            global_component, error_dx, norm_x,
             (norm_x == 0. ? std::numeric_limits<double>::quiet_NaN()
                           : (error_dx / norm_x)));
     }
@@ -64,7 +64,7 @@ void ConvergenceCriterionPerComponentResidual::checkDeltaX(
 void ConvergenceCriterionPerComponentResidual::checkResidual(
     const GlobalVector& residual)
 {
-    if ((!_dof_table) || (!_mesh))
+    if (_nodal_indices.offsets.empty())
         OGS_FATAL("D.o.f. table or mesh have not been set.");
 
     bool satisfied_abs = true;
@@ -72,12 +72,12 @@ void ConvergenceCriterionPerComponentResidual::checkResidual(
     // not satisfied.
     bool satisfied_rel = !_is_first_iteration;
 
+    auto const norms_res = norms(residual, _nodal_indices, _norm_type);
+
     for (unsigned global_component = 0; global_component < _abstols.size();
          ++global_component)
     {
-        // TODO short cut if tol <= 0.0
-        auto norm_res = norm(residual, global_component, _norm_type,
-                             *_dof_table, *_mesh);
+        auto const norm_res = norms_res[global_component];
 
         if (_is_first_iteration) {
             INFO("Convergence criterion, component %u: |r0|=%.4e", global_component, norm_res);
@@ -105,14 +105,13 @@ void ConvergenceCriterionPerComponentResidual::checkResidual(
 void ConvergenceCriterionPerComponentResidual::setDOFTable(
     const LocalToGlobalIndexMap& dof_table, MeshLib::Mesh const& mesh)
 {
-    _dof_table = &dof_table;
-    _mesh = &mesh;
-
-    if (_dof_table->getNumberOfComponents() !=
+    if (dof_table.getNumberOfComponents() !=
         static_cast<int>(_abstols.size()))
         OGS_FATAL(
             "The number of components in the DOF table and the number of "
             "tolerances given do not match.");
+
+    _nodal_indices = getNonGhostNodalIndices(dof_table, mesh);
 }
 
 std::unique_ptr<ConvergenceCriterionPerComponentResidual>
@@ -11,6 +11,7 @@
 
 #include <vector>
 #include "MathLib/LinAlg/LinAlgEnums.h"
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "ConvergenceCriterionPerComponent.h"
 
 namespace NumLib
@@ -47,8 +48,8 @@ public:
 private:
     const std::vector<double> _abstols;
     const std::vector<double> _reltols;
-    LocalToGlobalIndexMap const* _dof_table = nullptr;
-    MeshLib::Mesh const* _mesh = nullptr;
+    //! Set by setDOFTable().
+    NonGhostNodalIndices _nodal_indices;
     std::vector<double> _residual_norms_0;
 };
 
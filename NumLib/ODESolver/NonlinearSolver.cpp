@@ -9,10 +9,13 @@
 
 #include "NonlinearSolver.h"
 
+#include <algorithm>
+
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
+#include "BaseLib/Profiler.h"
 #include "BaseLib/RunTime.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "NumLib/DOF/GlobalMatrixProviders.h"
@@ -31,6 +34,7 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
     std::function<void(unsigned, GlobalVector const&)> const& postIterationCallback)
 {
     namespace LinAlg = MathLib::LinAlg;
+    BaseLib::ProfilingScope const profiling_scope("nonlinear_solver");
     auto& sys = *_equation_system;
 
     auto& A =
@@ -56,25 +60,35 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         time_iteration.start();
 
         timer_dirichlet.start();
-        sys.computeKnownSolutions(x_new);
-        sys.applyKnownSolutions(x_new);
+        {
+            BaseLib::ProfilingScope const profiling_scope("dirichlet_bcs");
+            sys.computeKnownSolutions(x_new);
+            sys.applyKnownSolutions(x_new);
+        }
         time_dirichlet += timer_dirichlet.elapsed();
 
         sys.preIteration(iteration, x_new);
 
         BaseLib::RunTime time_assembly;
         time_assembly.start();
-        sys.assemble(x_new);
-        sys.getA(A);
-        sys.getRhs(rhs);
+        {
+            BaseLib::ProfilingScope const profiling_scope("assembly");
+            sys.assemble(x_new);
+            sys.getA(A);
+            sys.getRhs(rhs);
+        }
         INFO("[time] Assembly took %g s.", time_assembly.elapsed());
 
         timer_dirichlet.start();
-        sys.applyKnownSolutionsPicard(A, rhs, x_new);
+        {
+            BaseLib::ProfilingScope const profiling_scope("dirichlet_bcs");
+            sys.applyKnownSolutionsPicard(A, rhs, x_new);
+        }
         time_dirichlet += timer_dirichlet.elapsed();
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet);
 
         if (!sys.isLinear() && _convergence_criterion->hasResidualCheck()) {
+            BaseLib::ProfilingScope const profiling_scope("convergence_check");
             GlobalVector res;
             LinAlg::matMult(A, x_new, res);  // res = A * x_new
             LinAlg::axpy(res, -1.0, rhs);   // res -= rhs
@@ -83,7 +97,11 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
 
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(A, rhs, x_new);
+        bool iteration_succeeded;
+        {
+            BaseLib::ProfilingScope const profiling_scope("linear_solver");
+            iteration_succeeded = _linear_solver.solve(A, rhs, x_new);
+        }
         INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
 
         if (!iteration_succeeded)
@@ -129,6 +147,7 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         if (sys.isLinear()) {
             error_norms_met = true;
         } else {
+            BaseLib::ProfilingScope const profiling_scope("convergence_check");
             if (_convergence_criterion->hasDeltaXCheck()) {
                 GlobalVector minus_delta_x(x);
                 LinAlg::axpy(minus_delta_x, -1.0,
@@ -149,6 +168,9 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
             break;
     }
 
+    BaseLib::Profiler::instance().addToCounter(
+        "iterations", std::min(iteration, _maxiter));
+
     if (iteration > _maxiter)
     {
         ERR("Picard: Could not solve the given nonlinear system within %u "
@@ -177,14 +199,15 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
     std::function<void(unsigned, GlobalVector const&)> const& postIterationCallback)
 {
     namespace LinAlg = MathLib::LinAlg;
+    BaseLib::ProfilingScope const profiling_scope("nonlinear_solver");
     auto& sys = *_equation_system;
 
-    auto& res = NumLib::GlobalVectorProvider::provider.getVector(
+    auto& res_storage = NumLib::GlobalVectorProvider::provider.getVector(
         _res_id);
     auto& minus_delta_x =
         NumLib::GlobalVectorProvider::provider.getVector(
             _minus_delta_x_id);
-    auto& J =
+    auto& J_storage =
         NumLib::GlobalMatrixProvider::provider.getMatrix(_J_id);
 
     bool error_norms_met = false;
@@ -206,32 +229,52 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
         time_iteration.start();
 
         timer_dirichlet.start();
-        sys.computeKnownSolutions(x);
-        sys.applyKnownSolutions(x);
+        {
+            BaseLib::ProfilingScope const profiling_scope("dirichlet_bcs");
+            sys.computeKnownSolutions(x);
+            sys.applyKnownSolutions(x);
+        }
         time_dirichlet += timer_dirichlet.elapsed();
 
         sys.preIteration(iteration, x);
 
+        // The equation system might redirect these to its own storage.
+        GlobalVector* res_ptr = &res_storage;
+        GlobalMatrix* J_ptr = &J_storage;
+
         BaseLib::RunTime time_assembly;
         time_assembly.start();
-        sys.assemble(x);
-        sys.getResidual(x, res);
-        sys.getJacobian(J);
+        {
+            BaseLib::ProfilingScope const profiling_scope("assembly");
+            sys.assembleResidualAndJacobian(x, res_ptr, J_ptr);
+        }
+        auto& res = *res_ptr;
+        auto& J = *J_ptr;
         INFO("[time] Assembly took %g s.", time_assembly.elapsed());
 
         minus_delta_x.setZero();
 
         timer_dirichlet.start();
-        sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+        {
+            BaseLib::ProfilingScope const profiling_scope("dirichlet_bcs");
+            sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+        }
         time_dirichlet += timer_dirichlet.elapsed();
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet);
 
         if (!sys.isLinear() && _convergence_criterion->hasResidualCheck())
+        {
+            BaseLib::ProfilingScope const profiling_scope("convergence_check");
             _convergence_criterion->checkResidual(res);
+        }
 
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
+        bool iteration_succeeded;
+        {
+            BaseLib::ProfilingScope const profiling_scope("linear_solver");
+            iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
+        }
         INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
 
         if (!iteration_succeeded)
@@ -283,6 +326,7 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
         if (sys.isLinear()) {
             error_norms_met = true;
         } else {
+            BaseLib::ProfilingScope const profiling_scope("convergence_check");
             if (_convergence_criterion->hasDeltaXCheck()) {
                 // Note: x contains the new solution!
                 _convergence_criterion->checkDeltaX(minus_delta_x, x);
@@ -298,6 +342,9 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             break;
     }
 
+    BaseLib::Profiler::instance().addToCounter(
+        "iterations", std::min(iteration, _maxiter));
+
     if (iteration > _maxiter)
     {
         ERR("Newton: Could not solve the given nonlinear system within %u "
@@ -305,8 +352,8 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             _maxiter);
     }
 
-    NumLib::GlobalMatrixProvider::provider.releaseMatrix(J);
-    NumLib::GlobalVectorProvider::provider.releaseVector(res);
+    NumLib::GlobalMatrixProvider::provider.releaseMatrix(J_storage);
+    NumLib::GlobalVectorProvider::provider.releaseVector(res_storage);
     NumLib::GlobalVectorProvider::provider.releaseVector(
         minus_delta_x);
 
@@ -53,6 +53,24 @@ public:
      */
     virtual void getJacobian(GlobalMatrix& Jac) const = 0;
 
+    /*! Assembles the residual and its Jacobian at the point \c x.
+     *
+     * By default the residual and the Jacobian are written to \c *res and
+     * \c *Jac using assemble(), getResidual() and getJacobian().
+     * Implementations which assemble them directly into internal storage may
+     * redirect \c res and \c Jac to that storage instead of copying. The
+     * caller may modify the pointed-to objects until the next call of this
+     * method.
+     */
+    virtual void assembleResidualAndJacobian(GlobalVector const& x,
+                                             GlobalVector*& res,
+                                             GlobalMatrix*& Jac)
+    {
+        assemble(x);
+        getResidual(x, *res);
+        getJacobian(*Jac);
+    }
+
     //! Pre-compute known solutions and possibly store them internally.
     virtual void computeKnownSolutions(GlobalVector const& x) = 0;
 
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 #include "NumLib/IndexValueVector.h"
 
@@ -52,6 +53,26 @@ public:
                           GlobalMatrix& M, GlobalMatrix& K,
                           GlobalVector& b) = 0;
 
+    /*! Assemble \c b at the provided state (\c t, \c x) for a linear ODE
+     * whose matrices \c M and \c K do not change in time.
+     *
+     * If \c assemble_matrices is set, this method does the same as
+     * assemble(). Otherwise \c M and \c K are left untouched, and the parts of
+     * \c b which have been computed together with the matrices are reused from
+     * the last call with \c assemble_matrices set.
+     */
+    virtual void assembleLinearTimeInvariant(const double /*t*/,
+                                             GlobalVector const& /*x*/,
+                                             GlobalMatrix& /*M*/,
+                                             GlobalMatrix& /*K*/,
+                                             GlobalVector& /*b*/,
+                                             bool const /*assemble_matrices*/)
+    {
+        OGS_FATAL(
+            "The assembly of time-invariant matrices is not implemented for "
+            "this ODE system.");
+    }
+
     using Index = MathLib::MatrixVectorTraits<GlobalMatrix>::Index;
 
     //! Provides known solutions (Dirichlet boundary conditions) vector for
@@ -129,6 +150,23 @@ public:
                                       const double dxdot_dx, const double dx_dx,
                                       GlobalMatrix& M, GlobalMatrix& K,
                                       GlobalVector& b, GlobalMatrix& Jac) = 0;
+
+    /*! Assemble the residual \f$ r = M \cdot \hat x + K \cdot x_C - b \f$
+     * and its Jacobian \c Jac at the provided state (\c t, \c x) without
+     * forming the global matrices \c M and \c K.
+     *
+     * The parameters have the same meaning as for assembleWithJacobian();
+     * \c res and \c Jac are expected to be zeroed.
+     */
+    virtual void assembleResidualWithJacobian(
+        const double /*t*/, GlobalVector const& /*x*/,
+        GlobalVector const& /*xdot*/, const double /*dxdot_dx*/,
+        const double /*dx_dx*/, GlobalVector& /*res*/, GlobalMatrix& /*Jac*/)
+    {
+        OGS_FATAL(
+            "The fused assembly of the residual and the Jacobian is not "
+            "implemented for this ODE system.");
+    }
 };
 
 //! @}
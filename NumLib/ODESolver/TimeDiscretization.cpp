@@ -12,6 +12,7 @@
 #include "TimeDiscretization.h"
 
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "NumLib/Checkpoint.h"
 
 namespace NumLib
 {
@@ -72,6 +73,96 @@ double BackwardDifferentiationFormula::getRelativeChangeFromPreviousTimestep(
         x, *_xs_old[_offset], norm_type);
 }
 
+void BackwardEuler::writeCheckpoint(std::ostream& os) const
+{
+    writeCheckpointValue(os, _t);
+    writeCheckpointValue(os, _delta_t);
+    writeCheckpointVector(os, _x_old);
+}
+
+void BackwardEuler::readCheckpoint(std::istream& is)
+{
+    readCheckpointValue(is, _t);
+    readCheckpointValue(is, _delta_t);
+    readCheckpointVector(is, _x_old);
+}
+
+void ForwardEuler::writeCheckpoint(std::ostream& os) const
+{
+    writeCheckpointValue(os, _t);
+    writeCheckpointValue(os, _t_old);
+    writeCheckpointValue(os, _delta_t);
+    writeCheckpointVector(os, _x_old);
+}
+
+void ForwardEuler::readCheckpoint(std::istream& is)
+{
+    readCheckpointValue(is, _t);
+    readCheckpointValue(is, _t_old);
+    readCheckpointValue(is, _delta_t);
+    readCheckpointVector(is, _x_old);
+}
+
+void CrankNicolson::writeCheckpoint(std::ostream& os) const
+{
+    writeCheckpointValue(os, _t);
+    writeCheckpointValue(os, _delta_t);
+    writeCheckpointVector(os, _x_old);
+}
+
+void CrankNicolson::readCheckpoint(std::istream& is)
+{
+    readCheckpointValue(is, _t);
+    readCheckpointValue(is, _delta_t);
+    readCheckpointVector(is, _x_old);
+}
+
+void BackwardDifferentiationFormula::writeCheckpoint(std::ostream& os) const
+{
+    writeCheckpointValue(os, _t);
+    writeCheckpointValue(os, _delta_t);
+    writeCheckpointValue(os, _offset);
+    writeCheckpointValue(os, _xs_old.size());
+    for (auto const* x : _xs_old)
+    {
+        writeCheckpointVector(os, *x);
+    }
+}
+
+void BackwardDifferentiationFormula::readCheckpoint(std::istream& is)
+{
+    assert(!_xs_old.empty());  // setInitialState() has been called.
+
+    readCheckpointValue(is, _t);
+    readCheckpointValue(is, _delta_t);
+    readCheckpointValue(is, _offset);
+    std::size_t number_of_old_solutions;
+    readCheckpointValue(is, number_of_old_solutions);
+    if (number_of_old_solutions == 0 || number_of_old_solutions > _num_steps ||
+        _offset >= number_of_old_solutions)
+    {
+        OGS_FATAL(
+            "The checkpoint contains %zu solutions of preceding timesteps with "
+            "offset %u, which is invalid for a BDF of order %u.",
+            number_of_old_solutions, _offset, _num_steps);
+    }
+
+    while (_xs_old.size() > number_of_old_solutions)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_xs_old.back());
+        _xs_old.pop_back();
+    }
+    while (_xs_old.size() < number_of_old_solutions)
+    {
+        _xs_old.push_back(
+            &NumLib::GlobalVectorProvider::provider.getVector(*_xs_old[0]));
+    }
+    for (auto* x : _xs_old)
+    {
+        readCheckpointVector(is, *x);
+    }
+}
+
 void BackwardDifferentiationFormula::pushState(const double,
                                                GlobalVector const& x,
                                                InternalMatrixStorage const&)
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <vector>
 
 #include "MathLib/LinAlg/LinAlg.h"
@@ -185,6 +186,14 @@ public:
     //! Returns \f$ x_O \f$.
     virtual void getWeightedOldX(GlobalVector& y) const = 0;  // = x_old
 
+    //! Writes the solution history and the times stored by this scheme, s.t.
+    //! the time integration can be continued from a checkpoint.
+    virtual void writeCheckpoint(std::ostream& os) const = 0;
+
+    //! Restores the state written by writeCheckpoint(). The scheme must have
+    //! been initialized by setInitialState() before.
+    virtual void readCheckpoint(std::istream& is) = 0;
+
     virtual ~TimeDiscretization() = default;
 
     //! \name Extended Interface
@@ -296,6 +305,9 @@ public:
         LinAlg::scale(y, 1.0 / _delta_t);
     }
 
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     double _t;        //!< \f$ t_C \f$
     double _delta_t;  //!< the timestep size
@@ -368,6 +380,10 @@ public:
     double getDxDx() const override { return 0.0; }
     //! Returns the solution from the preceding timestep.
     GlobalVector const& getXOld() const { return _x_old; }
+
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     double _t;        //!< \f$ t_C \f$
     double _t_old;    //!< the time of the preceding timestep
@@ -441,6 +457,15 @@ public:
     double getTheta() const { return _theta; }
     //! Returns the solution from the preceding timestep.
     GlobalVector const& getXOld() const { return _x_old; }
+
+    //! \copydoc TimeDiscretization::writeCheckpoint()
+    //!
+    //! The matrices \f$ \bar M \f$ and \f$ \bar b \f$ of the
+    //! MatrixTranslatorCrankNicolson are not written. They are recomputed by
+    //! the preload assembly after the restart.
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     const double _theta;  //!< the implicitness parameter \f$ \theta \f$
     double _t;            //!< \f$ t_C \f$
@@ -507,6 +532,9 @@ public:
 
     void getWeightedOldX(GlobalVector& y) const override;
 
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     std::size_t eff_num_steps() const { return _xs_old.size(); }
     const unsigned _num_steps;  //!< The order of the BDF method
@@ -44,26 +44,58 @@ TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
                              TimeDisc& time_discretization)
     : _ode(ode),
       _time_disc(time_discretization),
+      _process_id(process_id),
       _mat_trans(createMatrixTranslator<ODETag>(time_discretization))
 {
-    _Jac = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _Jac_id);
-    _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _M_id);
-    _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _K_id);
-    _b = &NumLib::GlobalVectorProvider::provider.getVector(
-        _ode.getMatrixSpecifications(process_id), _b_id);
 }
 
 TimeDiscretizedODESystem<
     ODESystemTag::FirstOrderImplicitQuasilinear,
     NonlinearSolverTag::Newton>::~TimeDiscretizedODESystem()
 {
-    NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_Jac);
-    NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_M);
-    NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K);
-    NumLib::GlobalVectorProvider::provider.releaseVector(*_b);
+    if (_Jac)
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_Jac);
+    if (_M)
+    {
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_M);
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K);
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_b);
+    }
+    if (_res)
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_res);
+}
+
+void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                              NonlinearSolverTag::Newton>::getMatrices()
+{
+    if (!_Jac)
+    {
+        _Jac = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(_process_id), _Jac_id);
+    }
+    if (!_M)
+    {
+        _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(_process_id), _M_id);
+        _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(_process_id), _K_id);
+        _b = &NumLib::GlobalVectorProvider::provider.getVector(
+            _ode.getMatrixSpecifications(_process_id), _b_id);
+    }
+}
+
+void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                              NonlinearSolverTag::Newton>::
+    setFusedAssembly(bool const fused_assembly)
+{
+    if (fused_assembly && _time_disc.needsPreload())
+    {
+        OGS_FATAL(
+            "The fused assembly of the residual and the Jacobian cannot be "
+            "used with a time discretization that needs the matrices of the "
+            "previous timestep.");
+    }
+    _fused_assembly = fused_assembly;
 }
 
 void TimeDiscretizedODESystem<
@@ -80,6 +112,7 @@ void TimeDiscretizedODESystem<
     auto& xdot = NumLib::GlobalVectorProvider::provider.getVector(_xdot_id);
     _time_disc.getXdot(x_new_timestep, xdot);
 
+    getMatrices();
     _M->setZero();
     _K->setZero();
     _b->setZero();
@@ -120,6 +153,57 @@ void TimeDiscretizedODESystem<
     _mat_trans->computeJacobian(*_Jac, Jac);
 }
 
+void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                              NonlinearSolverTag::Newton>::
+    assembleResidualAndJacobian(GlobalVector const& x_new_timestep,
+                                GlobalVector*& res, GlobalMatrix*& Jac)
+{
+    if (!_fused_assembly)
+    {
+        assemble(x_new_timestep);
+        getResidual(x_new_timestep, *res);
+        getJacobian(*Jac);
+        return;
+    }
+
+    namespace LinAlg = MathLib::LinAlg;
+
+    auto const t = _time_disc.getCurrentTime();
+    auto const& x_curr = _time_disc.getCurrentX(x_new_timestep);
+    auto const dxdot_dx = _time_disc.getNewXWeight();
+    auto const dx_dx = _time_disc.getDxDx();
+
+    auto& xdot = NumLib::GlobalVectorProvider::provider.getVector(_xdot_id);
+    _time_disc.getXdot(x_new_timestep, xdot);
+
+    if (!_Jac)
+    {
+        _Jac = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(_process_id), _Jac_id);
+    }
+    if (!_res)
+    {
+        _res = &NumLib::GlobalVectorProvider::provider.getVector(
+            _ode.getMatrixSpecifications(_process_id), _res_id);
+    }
+    _res->setZero();
+    _Jac->setZero();
+
+    _ode.preAssemble(t, x_curr);
+    _ode.assembleResidualWithJacobian(t, x_curr, xdot, dxdot_dx, dx_dx,
+                                      *_res, *_Jac);
+
+    LinAlg::finalizeAssembly(*_res);
+    LinAlg::finalizeAssembly(*_Jac);
+
+    NumLib::GlobalVectorProvider::provider.releaseVector(xdot);
+
+    // The caller works on the assembled objects directly; they are
+    // overwritten by the next assembly anyway.
+    res = _res;
+    Jac = _Jac;
+}
+
 void TimeDiscretizedODESystem<
     ODESystemTag::FirstOrderImplicitQuasilinear,
     NonlinearSolverTag::Newton>::computeKnownSolutions(GlobalVector const& x)
@@ -188,6 +272,30 @@ void TimeDiscretizedODESystem<
     auto const t = _time_disc.getCurrentTime();
     auto const& x_curr = _time_disc.getCurrentX(x_new_timestep);
 
+    if (_time_invariant_matrices)
+    {
+        bool const assemble_matrices = !_matrices_assembled;
+        if (assemble_matrices)
+        {
+            _M->setZero();
+            _K->setZero();
+        }
+        _b->setZero();
+
+        _ode.preAssemble(t, x_curr);
+        _ode.assembleLinearTimeInvariant(t, x_curr, *_M, *_K, *_b,
+                                         assemble_matrices);
+
+        if (assemble_matrices)
+        {
+            LinAlg::finalizeAssembly(*_M);
+            LinAlg::finalizeAssembly(*_K);
+            _matrices_assembled = true;
+        }
+        LinAlg::finalizeAssembly(*_b);
+        return;
+    }
+
     _M->setZero();
     _K->setZero();
     _b->setZero();
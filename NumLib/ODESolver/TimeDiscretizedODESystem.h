@@ -89,6 +89,17 @@ public:
 
     void getJacobian(GlobalMatrix& Jac) const override;
 
+    void assembleResidualAndJacobian(GlobalVector const& x_new_timestep,
+                                     GlobalVector*& res,
+                                     GlobalMatrix*& Jac) override;
+
+    /// If set, the residual and the Jacobian are assembled directly into one
+    /// global vector and one global matrix by
+    /// ODESystem::assembleResidualWithJacobian(), and the global matrices
+    /// \c M and \c K are not formed. Time discretizations which need the
+    /// matrices of the previous timestep cannot be used then.
+    void setFusedAssembly(bool const fused_assembly);
+
     void computeKnownSolutions(GlobalVector const& x) override;
 
     void applyKnownSolutions(GlobalVector& x) const override;
@@ -113,7 +124,8 @@ public:
 
     void pushMatrices() const override
     {
-        _mat_trans->pushMatrices(*_M, *_K, *_b);
+        if (_M)  // the matrices are not formed in the fused assembly
+            _mat_trans->pushMatrices(*_M, *_K, *_b);
     }
 
     TimeDisc& getTimeDiscretization() override { return _time_disc; }
@@ -124,8 +136,13 @@ public:
     }
 
 private:
-    ODE& _ode;             //!< ode the ODE being wrapped
-    TimeDisc& _time_disc;  //!< the time discretization to being used
+    //! Gets \c _M, \c _K, \c _b and \c _Jac from the matrix provider on
+    //! first use.
+    void getMatrices();
+
+    ODE& _ode;              //!< ode the ODE being wrapped
+    TimeDisc& _time_disc;   //!< the time discretization to being used
+    int const _process_id;  //!< ID of the ODE being wrapped
 
     //! the object used to compute the matrix/vector for the nonlinear solver
     std::unique_ptr<MatTrans> _mat_trans;
@@ -134,15 +151,20 @@ private:
     std::vector<NumLib::IndexValueVector<Index>> const* _known_solutions =
         nullptr;  //!< stores precomputed values for known solutions
 
-    GlobalMatrix* _Jac;  //!< the Jacobian of the residual
-    GlobalMatrix* _M;    //!< Matrix \f$ M \f$.
-    GlobalMatrix* _K;    //!< Matrix \f$ K \f$.
-    GlobalVector* _b;    //!< Matrix \f$ b \f$.
+    GlobalMatrix* _Jac = nullptr;  //!< the Jacobian of the residual
+    GlobalMatrix* _M = nullptr;    //!< Matrix \f$ M \f$.
+    GlobalMatrix* _K = nullptr;    //!< Matrix \f$ K \f$.
+    GlobalVector* _b = nullptr;    //!< Matrix \f$ b \f$.
+    GlobalVector* _res = nullptr;  //!< the residual in the fused assembly
 
     std::size_t _Jac_id = 0u;  //!< ID of the \c _Jac matrix.
     std::size_t _M_id = 0u;    //!< ID of the \c _M matrix.
     std::size_t _K_id = 0u;    //!< ID of the \c _K matrix.
     std::size_t _b_id = 0u;    //!< ID of the \c _b vector.
+    std::size_t _res_id = 0u;  //!< ID of the \c _res vector.
+
+    //! \see setFusedAssembly()
+    bool _fused_assembly = false;
 
     //! ID of the vector storing xdot in intermediate computations.
     mutable std::size_t _xdot_id = 0u;
@@ -180,6 +202,15 @@ public:
 
     void assemble(const GlobalVector& x_new_timestep) override;
 
+    /// Declares that the ODE is linear and its matrices \c M and \c K do
+    /// not change in time. Then the matrices are assembled only once, and
+    /// subsequent assemble() calls only rebuild \c b.
+    void setTimeInvariantMatrices(bool const time_invariant)
+    {
+        _time_invariant_matrices = time_invariant;
+        _matrices_assembled = false;
+    }
+
     void getA(GlobalMatrix& A) const override
     {
         _mat_trans->computeA(*_M, *_K, A);
@@ -242,6 +273,11 @@ private:
     std::size_t _M_id = 0u;  //!< ID of the \c _M matrix.
     std::size_t _K_id = 0u;  //!< ID of the \c _K matrix.
     std::size_t _b_id = 0u;  //!< ID of the \c _b vector.
+
+    //! \see setTimeInvariantMatrices()
+    bool _time_invariant_matrices = false;
+    //! Set after the first assembly of time-invariant matrices.
+    bool _matrices_assembled = false;
 };
 
 //! @}
@@ -17,6 +17,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/Algorithm.h"
+#include "NumLib/Checkpoint.h"
 
 namespace NumLib
 {
@@ -166,4 +167,23 @@ void EvolutionaryPIDcontroller::addFixedOutputTimes(
     // Remove possible duplicated elements and sort in descending order.
     BaseLib::makeVectorUnique(_fixed_output_times, std::greater<double>());
 }
+
+void EvolutionaryPIDcontroller::writeCheckpoint(std::ostream& os) const
+{
+    TimeStepAlgorithm::writeCheckpoint(os);
+    writeCheckpointValue(os, _e_n_minus1);
+    writeCheckpointValue(os, _e_n_minus2);
+    writeCheckpointValue(os, _is_accepted);
+    // The times already reached have been removed.
+    writeCheckpointValue(os, _fixed_output_times);
+}
+
+void EvolutionaryPIDcontroller::readCheckpoint(std::istream& is)
+{
+    TimeStepAlgorithm::readCheckpoint(is);
+    readCheckpointValue(is, _e_n_minus1);
+    readCheckpointValue(is, _e_n_minus2);
+    readCheckpointValue(is, _is_accepted);
+    readCheckpointValue(is, _fixed_output_times);
+}
 }  // end of namespace NumLib
@@ -96,6 +96,9 @@ public:
     void addFixedOutputTimes(
         std::vector<double> const& extra_fixed_output_times) override;
 
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     const double _kP = 0.075;  ///< Parameter. \see EvolutionaryPIDcontroller
     const double _kI = 0.175;  ///< Parameter. \see EvolutionaryPIDcontroller
@@ -17,6 +17,8 @@
 #include <limits>
 #include <utility>
 
+#include "NumLib/Checkpoint.h"
+
 namespace NumLib
 {
 IterationNumberBasedAdaptiveTimeStepping::
@@ -105,4 +107,19 @@ bool IterationNumberBasedAdaptiveTimeStepping::accepted() const
     return (_iter_times <= _max_iter);
 }
 
+void IterationNumberBasedAdaptiveTimeStepping::writeCheckpoint(
+    std::ostream& os) const
+{
+    TimeStepAlgorithm::writeCheckpoint(os);
+    writeCheckpointValue(os, _iter_times);
+    writeCheckpointValue(os, _n_rejected_steps);
+}
+
+void IterationNumberBasedAdaptiveTimeStepping::readCheckpoint(std::istream& is)
+{
+    TimeStepAlgorithm::readCheckpoint(is);
+    readCheckpointValue(is, _iter_times);
+    readCheckpointValue(is, _n_rejected_steps);
+}
+
 }  // NumLib
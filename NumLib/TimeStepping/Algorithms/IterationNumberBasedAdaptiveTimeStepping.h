@@ -108,6 +108,9 @@ public:
         return this->_n_rejected_steps;
     }
 
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     /// calculate the next time step size
     double getNextTimeStepSize() const;
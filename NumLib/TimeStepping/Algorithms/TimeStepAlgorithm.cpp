@@ -0,0 +1,53 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TimeStepAlgorithm.h"
+
+#include "NumLib/Checkpoint.h"
+
+namespace
+{
+void writeTimeStep(std::ostream& os, NumLib::TimeStep const& ts)
+{
+    NumLib::writeCheckpointValue(os, ts.previous());
+    NumLib::writeCheckpointValue(os, ts.current());
+    NumLib::writeCheckpointValue(os, ts.dt());
+    NumLib::writeCheckpointValue(os, ts.steps());
+}
+
+NumLib::TimeStep readTimeStep(std::istream& is)
+{
+    double previous;
+    double current;
+    double dt;
+    std::size_t steps;
+    NumLib::readCheckpointValue(is, previous);
+    NumLib::readCheckpointValue(is, current);
+    NumLib::readCheckpointValue(is, dt);
+    NumLib::readCheckpointValue(is, steps);
+    return NumLib::TimeStep(previous, current, dt, steps);
+}
+}  // namespace
+
+namespace NumLib
+{
+void TimeStepAlgorithm::writeCheckpoint(std::ostream& os) const
+{
+    writeTimeStep(os, _ts_prev);
+    writeTimeStep(os, _ts_current);
+    writeCheckpointValue(os, _dt_vector);
+}
+
+void TimeStepAlgorithm::readCheckpoint(std::istream& is)
+{
+    _ts_prev = readTimeStep(is);
+    _ts_current = readTimeStep(is);
+    readCheckpointValue(is, _dt_vector);
+}
+}  // namespace NumLib
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <cmath>
+#include <iosfwd>
 #include <vector>
 
 #include "BaseLib/Error.h"
@@ -122,6 +123,13 @@ public:
     {
     }
 
+    /// Writes the state of the time stepping, s.t. it can be continued from a
+    /// checkpoint. Derived classes having additional state extend this.
+    virtual void writeCheckpoint(std::ostream& os) const;
+
+    /// Restores the state written by writeCheckpoint().
+    virtual void readCheckpoint(std::istream& is);
+
 protected:
     /// initial time
     const double _t_initial;
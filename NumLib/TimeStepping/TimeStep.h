@@ -52,6 +52,23 @@ public:
     {
     }
 
+    /**
+     * Initialize a time step whose step size is not exactly the difference of
+     * the given times due to round-off, e.g. when restoring a checkpoint.
+     * @param previous_time    previous time
+     * @param current_time     current time
+     * @param dt               time step size
+     * @param n                the number of time steps
+     */
+    TimeStep(double previous_time, double current_time, double dt,
+             std::size_t n)
+        : _previous(previous_time),
+          _current(current_time),
+          _dt(dt),
+          _steps(n)
+    {
+    }
+
     /// copy a time step
     TimeStep(const TimeStep& src)
         : _previous(src._previous),
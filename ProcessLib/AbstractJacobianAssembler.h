@@ -46,6 +46,11 @@ public:
         OGS_FATAL("not implemented.");
     }
 
+    //! Returns true if assembleWithJacobian() can be called concurrently for
+    //! different local assemblers, i.e., the Jacobian assembler itself does
+    //! not hold any mutable state.
+    virtual bool isThreadSafe() const { return false; }
+
     virtual ~AbstractJacobianAssembler() = default;
 };
 
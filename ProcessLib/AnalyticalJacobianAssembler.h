@@ -45,6 +45,8 @@ public:
         std::vector<double>& local_M_data, std::vector<double>& local_K_data,
         std::vector<double>& local_b_data, std::vector<double>& local_Jac_data,
         LocalCoupledSolutions const& local_coupled_solutions) override;
+
+    bool isThreadSafe() const override { return true; }
 };
 
 }  // ProcessLib
@@ -74,6 +74,18 @@ PythonBoundaryCondition::PythonBoundaryCondition(
         shapefunction_order, _local_assemblers,
         _bc_data.boundary_mesh.isAxiallySymmetric(), integration_order,
         _bc_data);
+
+    _boundary_node_ids.reserve(bc_nodes.size());
+    _boundary_node_coords.resize(bc_nodes.size(), 3);
+    for (std::size_t i = 0; i < bc_nodes.size(); ++i)
+    {
+        _boundary_node_ids.push_back(bc_nodes[i]->getID());
+        auto const* xs = bc_nodes[i]->getCoords();  // TODO DDC problems?
+        for (int d = 0; d < 3; ++d)
+        {
+            _boundary_node_coords(i, d) = xs[d];
+        }
+    }
 }
 
 void PythonBoundaryCondition::getEssentialBCValues(
@@ -83,8 +95,6 @@ void PythonBoundaryCondition::getEssentialBCValues(
     FlushStdoutGuard guard(_flush_stdout);
     (void)guard;
 
-    auto const nodes = _bc_data.boundary_mesh.getNodes();
-
     auto const& bulk_node_ids_map =
         *_bc_data.boundary_mesh.getProperties().getPropertyVector<std::size_t>(
             "bulk_node_ids");
@@ -92,19 +102,17 @@ void PythonBoundaryCondition::getEssentialBCValues(
     bc_values.ids.clear();
     bc_values.values.clear();
 
-    bc_values.ids.reserve(_bc_data.boundary_mesh.getNumberOfNodes());
-    bc_values.values.reserve(_bc_data.boundary_mesh.getNumberOfNodes());
+    auto const num_nodes = _boundary_node_ids.size();
 
-    std::vector<double> primary_variables;
-
-    for (auto const* node : _bc_data.boundary_mesh.getNodes())
+    // gather primary variable values
+    RowMajorMatrix primary_variables(
+        num_nodes, _dof_table_boundary->getNumberOfComponents());
+    auto const num_var = _dof_table_boundary->getNumberOfVariables();
+    for (std::size_t i = 0; i < num_nodes; ++i)
     {
-        auto const boundary_node_id = node->getID();
-        auto const bulk_node_id = bulk_node_ids_map[boundary_node_id];
+        auto const bulk_node_id = bulk_node_ids_map[_boundary_node_ids[i]];
 
-        // gather primary variable values
-        primary_variables.clear();
-        auto const num_var = _dof_table_boundary->getNumberOfVariables();
+        int column = 0;
         for (int var = 0; var < num_var; ++var)
         {
             auto const num_comp =
@@ -129,24 +137,59 @@ void PythonBoundaryCondition::getEssentialBCValues(
                         bulk_node_id, var, comp);
                 }
 
-                primary_variables.push_back(x[dof_idx]);
+                primary_variables(i, column++) = x[dof_idx];
             }
         }
+    }
+
+    auto const* const bc_object = _bc_data.bc_object;
+    std::vector<bool> is_dirichlet;
+    std::vector<double> values;
 
-        auto* xs = nodes[boundary_node_id]->getCoords();  // TODO DDC problems?
-        auto pair_flag_value = _bc_data.bc_object->getDirichletBCValue(
-            t, {xs[0], xs[1], xs[2]}, boundary_node_id, primary_variables);
-        if (!_bc_data.bc_object->isOverriddenEssential())
+    if (bc_object->isOverriddenEssentialBatch())
+    {
+        bc_object->getDirichletBCValues(t, _boundary_node_coords,
+                                        _boundary_node_ids, primary_variables,
+                                        is_dirichlet, values);
+    }
+    if (!bc_object->isOverriddenEssentialBatch())
+    {
+        // Fall back to one Python call per node.
+        is_dirichlet.resize(num_nodes);
+        values.resize(num_nodes);
+        std::vector<double> node_primary_variables;
+        for (std::size_t i = 0; i < num_nodes; ++i)
         {
-            DBUG(
-                "Method `getDirichletBCValue' not overridden in Python "
-                "script.");
-            return;
+            auto const row = primary_variables.row(i);
+            node_primary_variables.assign(row.data(), row.data() + row.size());
+
+            auto pair_flag_value = bc_object->getDirichletBCValue(
+                t,
+                {_boundary_node_coords(i, 0), _boundary_node_coords(i, 1),
+                 _boundary_node_coords(i, 2)},
+                _boundary_node_ids[i], node_primary_variables);
+            if (!bc_object->isOverriddenEssential())
+            {
+                DBUG(
+                    "Method `getDirichletBCValue' not overridden in Python "
+                    "script.");
+                return;
+            }
+
+            is_dirichlet[i] = pair_flag_value.first;
+            values[i] = pair_flag_value.second;
         }
+    }
 
-        if (!pair_flag_value.first)
+    bc_values.ids.reserve(num_nodes);
+    bc_values.values.reserve(num_nodes);
+
+    for (std::size_t i = 0; i < num_nodes; ++i)
+    {
+        if (!is_dirichlet[i])
             continue;
 
+        auto const bulk_node_id = bulk_node_ids_map[_boundary_node_ids[i]];
         MeshLib::Location l(_bc_data.bulk_mesh_id, MeshLib::MeshItemType::Node,
                             bulk_node_id);
         const auto dof_idx = _bc_data.dof_table_bulk.getGlobalIndex(
@@ -166,7 +209,7 @@ void PythonBoundaryCondition::getEssentialBCValues(
         if (dof_idx >= 0)
         {
             bc_values.ids.emplace_back(dof_idx);
-            bc_values.values.emplace_back(pair_flag_value.second);
+            bc_values.values.emplace_back(values[i]);
         }
     }
 }
@@ -178,10 +221,16 @@ void PythonBoundaryCondition::applyNaturalBC(const double t,
 {
     FlushStdoutGuard guard(_flush_stdout);
 
+    if (_bc_data.bc_object->isOverriddenNaturalBatch() &&
+        applyNaturalBCBatch(t, x, b, Jac))
+    {
+        return;
+    }
+
     try
     {
         GlobalExecutor::executeMemberOnDereferenced(
-            &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
+            &PythonBoundaryConditionLocalAssemblerInterface::assemble,
             _local_assemblers, *_dof_table_boundary, t, x, K, b, Jac);
     }
     catch (MethodNotOverriddenInDerivedClassException const& /*e*/)
@@ -190,6 +239,60 @@ void PythonBoundaryCondition::applyNaturalBC(const double t,
     }
 }
 
+bool PythonBoundaryCondition::applyNaturalBCBatch(const double t,
+                                                  const GlobalVector& x,
+                                                  GlobalVector& b,
+                                                  GlobalMatrix* Jac)
+{
+    auto const num_elements = _local_assemblers.size();
+
+    if (_integration_point_offsets.empty())
+    {
+        _integration_point_offsets.resize(num_elements + 1, 0);
+        for (std::size_t e = 0; e < num_elements; ++e)
+        {
+            _integration_point_offsets[e + 1] =
+                _integration_point_offsets[e] +
+                _local_assemblers[e]->getNumberOfIntegrationPoints();
+        }
+
+        _integration_point_coords.resize(_integration_point_offsets.back(), 3);
+        for (std::size_t e = 0; e < num_elements; ++e)
+        {
+            _local_assemblers[e]->getIntegrationPointCoordinates(
+                _integration_point_coords, _integration_point_offsets[e]);
+        }
+    }
+
+    _integration_point_primary_variables.resize(
+        _integration_point_offsets.back(),
+        _bc_data.dof_table_bulk.getNumberOfComponents());
+    for (std::size_t e = 0; e < num_elements; ++e)
+    {
+        _local_assemblers[e]->interpolatePrimaryVariables(
+            *_dof_table_boundary, x, _integration_point_primary_variables,
+            _integration_point_offsets[e]);
+    }
+
+    _bc_data.bc_object->getFluxes(t, _integration_point_coords,
+                                  _integration_point_primary_variables,
+                                  _is_natural, _fluxes, _flux_jacobians);
+    if (!_bc_data.bc_object->isOverriddenNaturalBatch())
+    {
+        DBUG("Method `getFluxes' not overridden in Python script.");
+        return false;
+    }
+
+    for (std::size_t e = 0; e < num_elements; ++e)
+    {
+        _local_assemblers[e]->assembleWithFluxes(
+            e, *_dof_table_boundary, _is_natural, _fluxes, _flux_jacobians,
+            _integration_point_offsets[e], b, Jac);
+    }
+
+    return true;
+}
+
 std::unique_ptr<PythonBoundaryCondition> createPythonBoundaryCondition(
     BaseLib::ConfigTree const& config, MeshLib::Mesh const& boundary_mesh,
     NumLib::LocalToGlobalIndexMap const& dof_table, std::size_t bulk_mesh_id,
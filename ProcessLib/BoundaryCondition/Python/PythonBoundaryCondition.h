@@ -12,8 +12,8 @@
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/IndexValueVector.h"
 #include "ProcessLib/BoundaryCondition/BoundaryCondition.h"
-#include "ProcessLib/BoundaryCondition/GenericNaturalBoundaryConditionLocalAssembler.h"
 
+#include "PythonBoundaryConditionLocalAssemblerInterface.h"
 #include "PythonBoundaryConditionPythonSideInterface.h"
 
 namespace ProcessLib
@@ -57,6 +57,16 @@ public:
                         GlobalVector& b, GlobalMatrix* Jac) override;
 
 private:
+    using RowMajorMatrix =
+        PythonBoundaryConditionPythonSideInterface::RowMajorMatrix;
+
+    //! Assembles the natural BC using a single call of the batch method
+    //! PythonBoundaryConditionPythonSideInterface::getFluxes().
+    //!
+    //! \return false if the batch method is not overridden in Python.
+    bool applyNaturalBCBatch(const double t, const GlobalVector& x,
+                             GlobalVector& b, GlobalMatrix* Jac);
+
     //! Auxiliary data.
     PythonBoundaryConditionData _bc_data;
 
@@ -65,9 +75,26 @@ private:
 
     //! Local assemblers for all elements of the boundary mesh.
     std::vector<
-        std::unique_ptr<GenericNaturalBoundaryConditionLocalAssemblerInterface>>
+        std::unique_ptr<PythonBoundaryConditionLocalAssemblerInterface>>
         _local_assemblers;
 
+    //! Ids of the boundary nodes passed to the batch method
+    //! PythonBoundaryConditionPythonSideInterface::getDirichletBCValues().
+    std::vector<std::size_t> _boundary_node_ids;
+    //! Coordinates of the boundary nodes, one row per node.
+    RowMajorMatrix _boundary_node_coords;
+
+    //! Row of the first integration point of each boundary element in the
+    //! matrices below. Set up on the first use of the batch flux evaluation.
+    std::vector<Eigen::Index> _integration_point_offsets;
+    //! Coordinates of all integration points of the boundary.
+    RowMajorMatrix _integration_point_coords;
+    //! Buffers for the arguments and results of the batch flux evaluation.
+    RowMajorMatrix _integration_point_primary_variables;
+    std::vector<bool> _is_natural;
+    std::vector<double> _fluxes;
+    RowMajorMatrix _flux_jacobians;
+
     //! Whether or not to flush standard output before and after each call to
     //! Python code. Ensures right order of output messages and therefore
     //! simplifies debugging.
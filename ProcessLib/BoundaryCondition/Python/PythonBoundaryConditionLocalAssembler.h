@@ -13,9 +13,9 @@
 
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "NumLib/DOF/DOFTableUtil.h"
-#include "ProcessLib/BoundaryCondition/GenericNaturalBoundaryConditionLocalAssembler.h"
+#include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 
-#include "PythonBoundaryConditionPythonSideInterface.h"
+#include "PythonBoundaryConditionLocalAssemblerInterface.h"
 
 namespace ProcessLib
 {
@@ -28,11 +28,11 @@ struct MethodNotOverriddenInDerivedClassException
 template <typename ShapeFunction, typename IntegrationMethod,
           unsigned GlobalDim>
 class PythonBoundaryConditionLocalAssembler final
-    : public GenericNaturalBoundaryConditionLocalAssembler<
-          ShapeFunction, IntegrationMethod, GlobalDim>
+    : public PythonBoundaryConditionLocalAssemblerInterface
 {
-    using Base = GenericNaturalBoundaryConditionLocalAssembler<
-        ShapeFunction, IntegrationMethod, GlobalDim>;
+    using ShapeMatricesType = ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
+    using FemType =
+        NumLib::TemplateIsoparametric<ShapeFunction, ShapeMatricesType>;
 
 public:
     PythonBoundaryConditionLocalAssembler(
@@ -41,7 +41,10 @@ public:
         bool is_axially_symmetric,
         unsigned const integration_order,
         PythonBoundaryConditionData const& data)
-        : Base(e, is_axially_symmetric, integration_order),
+        : _integration_method(integration_order),
+          _shape_matrices(initShapeMatrices<ShapeFunction, ShapeMatricesType,
+                                            IntegrationMethod, GlobalDim>(
+              e, is_axially_symmetric, _integration_method)),
           _data(data),
           _element(e)
     {
@@ -52,15 +55,106 @@ public:
                   double const t, const GlobalVector& x, GlobalMatrix& /*K*/,
                   GlobalVector& b, GlobalMatrix* Jac) override
     {
-        using ShapeMatricesType =
-            ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
-        using FemType =
-            NumLib::TemplateIsoparametric<ShapeFunction, ShapeMatricesType>;
         FemType fe(*static_cast<const typename ShapeFunction::MeshElement*>(
             &_element));
 
+        auto const primary_variables_mat =
+            gatherPrimaryVariables(dof_table_boundary, x);
+
+        std::vector<double> prim_vars_data(primary_variables_mat.cols());
+        auto prim_vars = MathLib::toVector(prim_vars_data);
+
+        assembleImpl(
+            boundary_element_id, dof_table_boundary, b, Jac,
+            [&](unsigned const /*ip*/,
+                typename ShapeMatricesType::ShapeMatrices const& sm) {
+                auto const coords = fe.interpolateCoordinates(sm.N);
+                prim_vars =
+                    sm.N *
+                    primary_variables_mat;  // Assumption: all primary
+                                            // variables have same shape
+                                            // functions.
+                auto flag_flux_dFlux =
+                    _data.bc_object->getFlux(t, coords, prim_vars_data);
+                if (!_data.bc_object->isOverriddenNatural())
+                {
+                    // getFlux() is not overridden in Python, so we can skip
+                    // the whole BC assembly (i.e., for all boundary
+                    // elements).
+                    throw MethodNotOverriddenInDerivedClassException{};
+                }
+                return flag_flux_dFlux;
+            });
+    }
+
+    unsigned getNumberOfIntegrationPoints() const override
+    {
+        return _integration_method.getNumberOfPoints();
+    }
+
+    void getIntegrationPointCoordinates(
+        RowMajorMatrix& coords, Eigen::Index const first_row) const override
+    {
+        FemType fe(*static_cast<const typename ShapeFunction::MeshElement*>(
+            &_element));
+
+        unsigned const num_integration_points =
+            _integration_method.getNumberOfPoints();
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            auto const ip_coords =
+                fe.interpolateCoordinates(_shape_matrices[ip].N);
+            for (int d = 0; d < 3; ++d)
+            {
+                coords(first_row + ip, d) = ip_coords[d];
+            }
+        }
+    }
+
+    void interpolatePrimaryVariables(
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        GlobalVector const& x, RowMajorMatrix& primary_variables,
+        Eigen::Index const first_row) const override
+    {
+        auto const primary_variables_mat =
+            gatherPrimaryVariables(dof_table_boundary, x);
+
         unsigned const num_integration_points =
-            Base::_integration_method.getNumberOfPoints();
+            _integration_method.getNumberOfPoints();
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            // Assumption: all primary variables have same shape functions.
+            primary_variables.row(first_row + ip).noalias() =
+                _shape_matrices[ip].N * primary_variables_mat;
+        }
+    }
+
+    void assembleWithFluxes(std::size_t const boundary_element_id,
+                            NumLib::LocalToGlobalIndexMap const&
+                                dof_table_boundary,
+                            std::vector<bool> const& is_natural,
+                            std::vector<double> const& fluxes,
+                            RowMajorMatrix const& flux_jacobians,
+                            Eigen::Index const first_row, GlobalVector& b,
+                            GlobalMatrix* Jac) override
+    {
+        assembleImpl(
+            boundary_element_id, dof_table_boundary, b, Jac,
+            [&](unsigned const ip,
+                typename ShapeMatricesType::ShapeMatrices const& /*sm*/) {
+                auto const row = first_row + ip;
+                return std::make_tuple(static_cast<bool>(is_natural[row]),
+                                       fluxes[row], flux_jacobians.row(row));
+            });
+    }
+
+private:
+    //! Returns the primary variables at the element's nodes; one row per node
+    //! and one column per global component.
+    Eigen::MatrixXd gatherPrimaryVariables(
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        GlobalVector const& x) const
+    {
         auto const num_var = _data.dof_table_bulk.getNumberOfVariables();
         auto const num_nodes = _element.getNumberOfNodes();
         auto const num_comp_total =
@@ -70,7 +164,6 @@ public:
             *_data.boundary_mesh.getProperties()
                  .template getPropertyVector<std::size_t>("bulk_node_ids");
 
-        // gather primary variables
         Eigen::MatrixXd primary_variables_mat(num_nodes, num_comp_total);
         for (int var = 0; var < num_var; ++var)
         {
@@ -110,28 +203,33 @@ public:
             }
         }
 
+        return primary_variables_mat;
+    }
+
+    //! Assembles the element given the flux at each integration point.
+    //!
+    //! \param get_flux function returning a tuple (is_natural, flux,
+    //! flux_jacobian) for the given integration point and shape matrices.
+    template <typename GetFlux>
+    void assembleImpl(std::size_t const boundary_element_id,
+                      NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+                      GlobalVector& b, GlobalMatrix* Jac,
+                      GetFlux const& get_flux)
+    {
+        unsigned const num_integration_points =
+            _integration_method.getNumberOfPoints();
+        auto const num_nodes = _element.getNumberOfNodes();
+        auto const num_comp_total =
+            _data.dof_table_bulk.getNumberOfComponents();
+
         Eigen::VectorXd local_rhs = Eigen::VectorXd::Zero(num_nodes);
         Eigen::MatrixXd local_Jac =
             Eigen::MatrixXd::Zero(num_nodes, num_nodes * num_comp_total);
-        std::vector<double> prim_vars_data(num_comp_total);
-        auto prim_vars = MathLib::toVector(prim_vars_data);
 
         for (unsigned ip = 0; ip < num_integration_points; ip++)
         {
-            auto const& sm = Base::_shape_matrices[ip];
-            auto const coords = fe.interpolateCoordinates(sm.N);
-            prim_vars =
-                sm.N *
-                primary_variables_mat;  // Assumption: all primary variables
-                                        // have same shape functions.
-            auto const flag_flux_dFlux =
-                _data.bc_object->getFlux(t, coords, prim_vars_data);
-            if (!_data.bc_object->isOverriddenNatural())
-            {
-                // getFlux() is not overridden in Python, so we can skip the
-                // whole BC assembly (i.e., for all boundary elements).
-                throw MethodNotOverriddenInDerivedClassException{};
-            }
+            auto const& sm = _shape_matrices[ip];
+            auto const flag_flux_dFlux = get_flux(ip, sm);
 
             if (!std::get<0>(flag_flux_dFlux))
             {
@@ -142,7 +240,7 @@ public:
             auto const flux = std::get<1>(flag_flux_dFlux);
             auto const& dFlux = std::get<2>(flag_flux_dFlux);
 
-            auto const& wp = Base::_integration_method.getWeightedPoint(ip);
+            auto const& wp = _integration_method.getWeightedPoint(ip);
             auto const w = sm.detJ * wp.getWeight() * sm.integralMeasure;
             local_rhs.noalias() += sm.N * (flux * w);
 
@@ -190,7 +288,12 @@ public:
         }
     }
 
-private:
+    IntegrationMethod const _integration_method;
+    std::vector<typename ShapeMatricesType::ShapeMatrices,
+                Eigen::aligned_allocator<
+                    typename ShapeMatricesType::ShapeMatrices>> const
+        _shape_matrices;
+
     PythonBoundaryConditionData const& _data;
     MeshLib::Element const& _element;
 };
@@ -0,0 +1,59 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "ProcessLib/BoundaryCondition/GenericNaturalBoundaryConditionLocalAssembler.h"
+
+#include "PythonBoundaryConditionPythonSideInterface.h"
+
+namespace ProcessLib
+{
+//! Local assembler interface of the Python BC. In addition to the per
+//! integration point assembly of the base class, it supports evaluating the
+//! fluxes of all integration points of the boundary in a single Python call.
+//!
+//! The data of all integration points of the boundary are stored in the rows
+//! of common matrices; \c first_row is the row of the first integration point
+//! of the element.
+class PythonBoundaryConditionLocalAssemblerInterface
+    : public GenericNaturalBoundaryConditionLocalAssemblerInterface
+{
+public:
+    using RowMajorMatrix =
+        PythonBoundaryConditionPythonSideInterface::RowMajorMatrix;
+
+    virtual unsigned getNumberOfIntegrationPoints() const = 0;
+
+    //! Writes the coordinates of the integration points of the element to the
+    //! rows of \c coords starting at \c first_row.
+    virtual void getIntegrationPointCoordinates(
+        RowMajorMatrix& coords, Eigen::Index const first_row) const = 0;
+
+    //! Writes the primary variables interpolated to the integration points of
+    //! the element to the rows of \c primary_variables starting at
+    //! \c first_row.
+    virtual void interpolatePrimaryVariables(
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        GlobalVector const& x, RowMajorMatrix& primary_variables,
+        Eigen::Index const first_row) const = 0;
+
+    //! Assembles the element using the fluxes computed beforehand for all
+    //! integration points of the boundary.
+    virtual void assembleWithFluxes(
+        std::size_t const id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        std::vector<bool> const& is_natural, std::vector<double> const& fluxes,
+        RowMajorMatrix const& flux_jacobians, Eigen::Index const first_row,
+        GlobalVector& b, GlobalMatrix* Jac) = 0;
+};
+
+}  // namespace ProcessLib
@@ -9,10 +9,58 @@
 
 #include "PythonBoundaryConditionModule.h"
 
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
+#include "BaseLib/Error.h"
+
 #include "PythonBoundaryConditionPythonSideInterface.h"
 
+namespace
+{
+namespace py = pybind11;
+
+using RowMajorMatrix =
+    ProcessLib::PythonBoundaryConditionPythonSideInterface::RowMajorMatrix;
+
+//! Arrays returned from Python are converted to C-contiguous arrays of the
+//! requested type if necessary.
+template <typename T>
+using InputArray = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+//! Creates a read-only NumPy array referencing the given data without copying
+//! them.
+template <typename T>
+py::array_t<T> makeReadOnlyArrayView(std::vector<py::ssize_t> shape,
+                                     T const* const data)
+{
+    // Passing a base object prevents pybind11 from copying the data. The
+    // memory remains owned by OGS.
+    py::capsule const base(data, [](void*) {});
+    py::array_t<T> array(std::move(shape), data, base);
+    array.attr("setflags")(false);
+    return array;
+}
+
+py::array_t<double> makeReadOnlyArrayView(RowMajorMatrix const& matrix)
+{
+    return makeReadOnlyArrayView<double>({matrix.rows(), matrix.cols()},
+                                         matrix.data());
+}
+
+template <typename T>
+void copyArray(InputArray<T> const& array, py::ssize_t const expected_size,
+               char const* const what, std::vector<T>& result)
+{
+    if (array.ndim() != 1 || array.shape(0) != expected_size)
+    {
+        OGS_FATAL("Expected %d %s from Python, got an array of size %d.",
+                  expected_size, what, array.size());
+    }
+    result.assign(array.data(), array.data() + expected_size);
+}
+}  // namespace
+
 namespace ProcessLib
 {
 //! Trampoline class allowing methods of class
@@ -43,6 +91,77 @@ public:
         PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
                           getFlux, t, x, primary_variables);
     }
+
+    void getDirichletBCValues(double t, RowMajorMatrix const& coords,
+                              std::vector<std::size_t> const& node_ids,
+                              RowMajorMatrix const& primary_variables,
+                              std::vector<bool>& is_dirichlet,
+                              std::vector<double>& values) const override
+    {
+        py::gil_scoped_acquire gil;
+        py::function overload = py::get_overload(
+            static_cast<PythonBoundaryConditionPythonSideInterface const*>(
+                this),
+            "getDirichletBCValues");
+        if (!overload)
+        {
+            PythonBoundaryConditionPythonSideInterface::getDirichletBCValues(
+                t, coords, node_ids, primary_variables, is_dirichlet, values);
+            return;
+        }
+
+        auto const n = static_cast<py::ssize_t>(node_ids.size());
+        auto const result =
+            overload(t, makeReadOnlyArrayView(coords),
+                     makeReadOnlyArrayView<std::size_t>({n}, node_ids.data()),
+                     makeReadOnlyArrayView(primary_variables))
+                .cast<std::pair<InputArray<bool>, InputArray<double>>>();
+
+        copyArray(result.first, n, "Dirichlet flags", is_dirichlet);
+        copyArray(result.second, n, "Dirichlet values", values);
+    }
+
+    void getFluxes(double t, RowMajorMatrix const& coords,
+                   RowMajorMatrix const& primary_variables,
+                   std::vector<bool>& is_natural, std::vector<double>& fluxes,
+                   RowMajorMatrix& flux_jacobians) const override
+    {
+        py::gil_scoped_acquire gil;
+        py::function overload = py::get_overload(
+            static_cast<PythonBoundaryConditionPythonSideInterface const*>(
+                this),
+            "getFluxes");
+        if (!overload)
+        {
+            PythonBoundaryConditionPythonSideInterface::getFluxes(
+                t, coords, primary_variables, is_natural, fluxes,
+                flux_jacobians);
+            return;
+        }
+
+        auto const m = static_cast<py::ssize_t>(coords.rows());
+        auto const result =
+            overload(t, makeReadOnlyArrayView(coords),
+                     makeReadOnlyArrayView(primary_variables))
+                .cast<std::tuple<InputArray<bool>, InputArray<double>,
+                                 InputArray<double>>>();
+
+        copyArray(std::get<0>(result), m, "flux flags", is_natural);
+        copyArray(std::get<1>(result), m, "fluxes", fluxes);
+
+        auto const& jacobians = std::get<2>(result);
+        auto const num_components = primary_variables.cols();
+        if (jacobians.ndim() != 2 || jacobians.shape(0) != m ||
+            jacobians.shape(1) != num_components)
+        {
+            OGS_FATAL(
+                "The Python BC must return the derivatives of the fluxes "
+                "w.r.t. each primary variable as an array of shape (%d, %d).",
+                m, num_components);
+        }
+        flux_jacobians = Eigen::Map<RowMajorMatrix const>(jacobians.data(), m,
+                                                          num_components);
+    }
 };
 
 void pythonBindBoundaryCondition(pybind11::module& m)
@@ -9,6 +9,14 @@
 
 #pragma once
 
+#include <array>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
 namespace ProcessLib
 {
 //! Base class for boundary conditions.
@@ -17,6 +25,9 @@ namespace ProcessLib
 class PythonBoundaryConditionPythonSideInterface
 {
 public:
+    using RowMajorMatrix =
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
     /*!
      * Computes Dirichlet boundary condition values for the provided arguments
      * (time, position of the node, node id, primary variables at the node).
@@ -51,6 +62,58 @@ public:
             false, std::numeric_limits<double>::quiet_NaN(), {}};
     }
 
+    /*!
+     * Batch version of getDirichletBCValue() computing the Dirichlet boundary
+     * condition values for all \c n nodes of the boundary at once.
+     *
+     * On the Python side the method has the signature
+     * <tt>getDirichletBCValues(t, coords, node_ids, primary_vars)</tt>, where
+     * \c coords, \c node_ids and \c primary_vars are read-only NumPy arrays
+     * of the shapes (n, 3), (n,) and (n, number of components), respectively.
+     * The arrays share their memory with OGS; they are only valid during the
+     * call. The method must return a pair (is_dirichlet, values) of arrays of
+     * length \c n.
+     *
+     * \param is_dirichlet  (output) tells for each node if a Dirichlet BC
+     *                      shall be set.
+     * \param values        (output) the Dirichlet BC values.
+     */
+    virtual void getDirichletBCValues(
+        double /*t*/, RowMajorMatrix const& /*coords*/,
+        std::vector<std::size_t> const& /*node_ids*/,
+        RowMajorMatrix const& /*primary_variables*/,
+        std::vector<bool>& /*is_dirichlet*/,
+        std::vector<double>& /*values*/) const
+    {
+        _overridden_essential_batch = false;
+    }
+
+    /*!
+     * Batch version of getFlux() computing the fluxes at all \c m integration
+     * points of the boundary at once.
+     *
+     * On the Python side the method has the signature
+     * <tt>getFluxes(t, coords, primary_vars)</tt>, where \c coords and
+     * \c primary_vars are read-only NumPy arrays of the shapes (m, 3) and (m,
+     * number of components), respectively, which are only valid during the
+     * call. The method must return a tuple (is_natural, fluxes, flux_jacobians)
+     * of arrays of the shapes (m,), (m,) and (m, number of components).
+     *
+     * \param is_natural     (output) tells for each integration point if a
+     *                       natural BC shall be set.
+     * \param fluxes         (output) the fluxes.
+     * \param flux_jacobians (output) the derivatives of the fluxes w.r.t. all
+     *                       primary variables, one row per integration point.
+     */
+    virtual void getFluxes(double /*t*/, RowMajorMatrix const& /*coords*/,
+                           RowMajorMatrix const& /*primary_variables*/,
+                           std::vector<bool>& /*is_natural*/,
+                           std::vector<double>& /*fluxes*/,
+                           RowMajorMatrix& /*flux_jacobians*/) const
+    {
+        _overridden_natural_batch = false;
+    }
+
     //! Tells if getDirichletBCValue() has been overridden in the derived class
     //! in Python.
     //!
@@ -58,11 +121,25 @@ public:
     //! once.
     bool isOverriddenEssential() const { return _overridden_essential; }
 
+    //! Tells if getDirichletBCValues() has been overridden in the derived
+    //! class in Python.
+    //!
+    //! \pre getDirichletBCValues() must already have been called once.
+    bool isOverriddenEssentialBatch() const
+    {
+        return _overridden_essential_batch;
+    }
+
     //! Tells if getFlux() has been overridden in the derived class in Python.
     //!
     //! \pre getFlux() must already have been called once.
     bool isOverriddenNatural() const { return _overridden_natural; }
 
+    //! Tells if getFluxes() has been overridden in the derived class in Python.
+    //!
+    //! \pre getFluxes() must already have been called once.
+    bool isOverriddenNaturalBatch() const { return _overridden_natural_batch; }
+
     virtual ~PythonBoundaryConditionPythonSideInterface() = default;
 
 private:
@@ -71,5 +148,11 @@ private:
     mutable bool _overridden_essential = true;
     //! Tells if getFlux() has been overridden in the derived class in Python.
     mutable bool _overridden_natural = true;
+    //! Tells if getDirichletBCValues() has been overridden in the derived
+    //! class in Python.
+    mutable bool _overridden_essential_batch = true;
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python.
+    mutable bool _overridden_natural_batch = true;
 };
 }  // namespace ProcessLib
@@ -10,6 +10,7 @@
 #include "NumLib/ODESolver/TimeDiscretizationBuilder.h"
 #include "NumLib/TimeStepping/CreateTimeStepper.h"
 #include "ProcessLib/Output/CreateProcessOutput.h"
+#include "ProcessLib/Process.h"
 
 #include "CreateProcessData.h"
 
@@ -87,9 +88,50 @@ std::vector<std::unique_ptr<ProcessData>> createPerProcessData(
             //! \ogs_file_param{prj__time_loop__processes__process__output}
             createProcessOutput(pcs_config.getConfigSubtree("output"));
 
+        auto const time_invariant_matrices =
+            //! \ogs_file_param{prj__time_loop__processes__process__linear_time_invariant}
+            pcs_config.getConfigParameter<bool>("linear_time_invariant", false);
+
+        auto const fused_newton_assembly =
+            //! \ogs_file_param{prj__time_loop__processes__process__fused_newton_assembly}
+            pcs_config.getConfigParameter<bool>("fused_newton_assembly", false);
+
         per_process_data.emplace_back(makeProcessData(
             std::move(timestepper), nl_slv, pcs, std::move(time_disc),
             std::move(conv_crit), std::move(process_output)));
+
+        if (time_invariant_matrices)
+        {
+            if (!pcs.isLinear())
+            {
+                OGS_FATAL(
+                    "The process `%s' is declared linear time-invariant, but "
+                    "its equations are nonlinear.",
+                    pcs_name.c_str());
+            }
+            if (per_process_data.back()->nonlinear_solver_tag !=
+                NumLib::NonlinearSolverTag::Picard)
+            {
+                OGS_FATAL(
+                    "The linear time-invariant process `%s' has to be solved "
+                    "with the Picard nonlinear solver.",
+                    pcs_name.c_str());
+            }
+            per_process_data.back()->time_invariant_matrices = true;
+        }
+
+        if (fused_newton_assembly)
+        {
+            if (per_process_data.back()->nonlinear_solver_tag !=
+                NumLib::NonlinearSolverTag::Newton)
+            {
+                OGS_FATAL(
+                    "The fused Newton assembly of the process `%s' requires "
+                    "the Newton-Raphson nonlinear solver.",
+                    pcs_name.c_str());
+            }
+            per_process_data.back()->fused_newton_assembly = true;
+        }
     }
 
     if (per_process_data.size() != processes.size())
@@ -96,6 +96,12 @@ private:
         const double dxdot_dx, const double dx_dx, GlobalMatrix& M,
         GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac) override;
 
+    // The process has no history dependent data besides the solution.
+    void writeCheckpointConcreteProcess(std::ostream& /*os*/) const override
+    {
+    }
+    void readCheckpointConcreteProcess(std::istream& /*is*/) override {}
+
     void preTimestepConcreteProcess(GlobalVector const& x, double const t,
                                     double const dt,
                                     const int process_id) override;
@@ -107,17 +107,26 @@ public:
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
-        SpatialPosition pos;
-        pos.setElementID(_element.getID());
+        // The scalar parameters are evaluated for all integration points at
+        // once.
+        std::vector<double> parameter_values(3 * n_integration_points);
+        double* const ks = parameter_values.data();
+        double* const heat_capacities = ks + n_integration_points;
+        double* const densities = heat_capacities + n_integration_points;
+        _process_data.thermal_conductivity.getIntegrationPointValuesOnElement(
+            _element, n_integration_points, t, ks);
+        _process_data.heat_capacity.getIntegrationPointValuesOnElement(
+            _element, n_integration_points, t, heat_capacities);
+        _process_data.density.getIntegrationPointValuesOnElement(
+            _element, n_integration_points, t, densities);
 
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
             auto const& wp = _integration_method.getWeightedPoint(ip);
-            auto const k = _process_data.thermal_conductivity(t, pos)[0];
-            auto const heat_capacity = _process_data.heat_capacity(t, pos)[0];
-            auto const density = _process_data.density(t, pos)[0];
+            auto const k = ks[ip];
+            auto const heat_capacity = heat_capacities[ip];
+            auto const density = densities[ip];
 
             local_K.noalias() += sm.dNdx.transpose() * k * sm.dNdx * sm.detJ *
                                  wp.getWeight() * sm.integralMeasure;
@@ -32,6 +32,9 @@ HeatConductionProcess::HeatConductionProcess(
               std::move(secondary_variables), std::move(named_function_caller)),
       _process_data(std::move(process_data))
 {
+    // The local assemblers evaluate the parameters through the thread-safe
+    // getIntegrationPointValuesOnElement().
+    _global_assembler.setConcurrentLocalAssembly(true);
 }
 
 void HeatConductionProcess::initializeConcreteProcess(
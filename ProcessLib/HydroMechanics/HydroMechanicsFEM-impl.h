@@ -41,7 +41,15 @@ HydroMechanicsLocalAssembler<ShapeFunctionDisplacement, ShapeFunctionPressure,
         _integration_method.getNumberOfPoints();
 
     _ip_data.reserve(n_integration_points);
-    _secondary_data.N_u.resize(n_integration_points);
+
+    auto const& reference_shape_matrices_u =
+        getReferenceShapeMatrices<ShapeFunctionDisplacement,
+                                  ShapeMatricesTypeDisplacement>(
+            _integration_method);
+    auto const& reference_shape_matrices_p =
+        getReferenceShapeMatrices<ShapeFunctionPressure,
+                                  ShapeMatricesTypePressure>(
+            _integration_method);
 
     auto const shape_matrices_u =
         initShapeMatrices<ShapeFunctionDisplacement,
@@ -61,7 +69,9 @@ HydroMechanicsLocalAssembler<ShapeFunctionDisplacement, ShapeFunctionPressure,
 
     for (unsigned ip = 0; ip < n_integration_points; ip++)
     {
-        _ip_data.emplace_back(solid_material);
+        _ip_data.emplace_back(solid_material,
+                              reference_shape_matrices_u.N[ip],
+                              reference_shape_matrices_p.N[ip]);
         auto& ip_data = _ip_data[ip];
         auto const& sm_u = shape_matrices_u[ip];
         _ip_data[ip].integration_weight =
@@ -79,22 +89,8 @@ HydroMechanicsLocalAssembler<ShapeFunctionDisplacement, ShapeFunctionPressure,
         ip_data.eps_prev.resize(kelvin_vector_size);
         ip_data.sigma_eff_prev.resize(kelvin_vector_size);
 
-        ip_data.N_u_op = ShapeMatricesTypeDisplacement::template MatrixType<
-            DisplacementDim, displacement_size>::Zero(DisplacementDim,
-                                                      displacement_size);
-        for (int i = 0; i < DisplacementDim; ++i)
-            ip_data.N_u_op
-                .template block<1, displacement_size / DisplacementDim>(
-                    i, i * displacement_size / DisplacementDim)
-                .noalias() = sm_u.N;
-
-        ip_data.N_u = sm_u.N;
         ip_data.dNdx_u = sm_u.dNdx;
-
-        ip_data.N_p = shape_matrices_p[ip].N;
         ip_data.dNdx_p = shape_matrices_p[ip].dNdx;
-
-        _secondary_data.N_u[ip] = shape_matrices_u[ip].N;
     }
 }
 
@@ -168,9 +164,8 @@ void HydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
         x_position.setIntegrationPoint(ip);
         auto const& w = _ip_data[ip].integration_weight;
 
-        auto const& N_u_op = _ip_data[ip].N_u_op;
-
         auto const& N_u = _ip_data[ip].N_u;
+        auto const N_u_op = computeNuOp(N_u);
         auto const& dNdx_u = _ip_data[ip].dNdx_u;
 
         auto const& N_p = _ip_data[ip].N_p;
@@ -463,9 +458,8 @@ void HydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
         x_position.setIntegrationPoint(ip);
         auto const& w = _ip_data[ip].integration_weight;
 
-        auto const& N_u_op = _ip_data[ip].N_u_op;
-
         auto const& N_u = _ip_data[ip].N_u;
+        auto const N_u_op = computeNuOp(N_u);
         auto const& dNdx_u = _ip_data[ip].dNdx_u;
 
         auto const& N_p = _ip_data[ip].N_p;
@@ -16,6 +16,7 @@
 #include "MaterialLib/SolidModels/LinearElasticIsotropic.h"
 #include "MathLib/KelvinVector.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "NumLib/Checkpoint.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "ProcessLib/Deformation/BMatrixPolicy.h"
@@ -35,25 +36,28 @@ template <typename BMatricesType, typename ShapeMatrixTypeDisplacement,
           typename ShapeMatricesTypePressure, int DisplacementDim, int NPoints>
 struct IntegrationPointData final
 {
-    explicit IntegrationPointData(
+    IntegrationPointData(
         MaterialLib::Solids::MechanicsBase<DisplacementDim> const&
-            solid_material)
-        : solid_material(solid_material),
+            solid_material,
+        typename ShapeMatrixTypeDisplacement::NodalRowVectorType const& N_u_,
+        typename ShapeMatricesTypePressure::NodalRowVectorType const& N_p_)
+        : N_u(N_u_),
+          N_p(N_p_),
+          solid_material(solid_material),
           material_state_variables(
               solid_material.createMaterialStateVariables())
     {
     }
 
-    typename ShapeMatrixTypeDisplacement::template MatrixType<
-        DisplacementDim, NPoints * DisplacementDim>
-        N_u_op;
     typename BMatricesType::KelvinVectorType sigma_eff, sigma_eff_prev;
     typename BMatricesType::KelvinVectorType eps, eps_prev;
 
-    typename ShapeMatrixTypeDisplacement::NodalRowVectorType N_u;
+    /// The shape functions are shared by all elements of the same type, see
+    /// getReferenceShapeMatrices().
+    typename ShapeMatrixTypeDisplacement::NodalRowVectorType const& N_u;
     typename ShapeMatrixTypeDisplacement::GlobalDimNodalMatrixType dNdx_u;
 
-    typename ShapeMatricesTypePressure::NodalRowVectorType N_p;
+    typename ShapeMatricesTypePressure::NodalRowVectorType const& N_p;
     typename ShapeMatricesTypePressure::GlobalDimNodalMatrixType dNdx_p;
 
     MaterialLib::Solids::MechanicsBase<DisplacementDim> const& solid_material;
@@ -69,6 +73,24 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
+    void writeCheckpoint(std::ostream& os) const
+    {
+        NumLib::writeCheckpointMatrix(os, sigma_eff);
+        NumLib::writeCheckpointMatrix(os, sigma_eff_prev);
+        NumLib::writeCheckpointMatrix(os, eps);
+        NumLib::writeCheckpointMatrix(os, eps_prev);
+        material_state_variables->writeCheckpoint(os);
+    }
+
+    void readCheckpoint(std::istream& is)
+    {
+        NumLib::readCheckpointMatrix(is, sigma_eff);
+        NumLib::readCheckpointMatrix(is, sigma_eff_prev);
+        NumLib::readCheckpointMatrix(is, eps);
+        NumLib::readCheckpointMatrix(is, eps_prev);
+        material_state_variables->readCheckpoint(is);
+    }
+
     template <typename DisplacementVectorType>
     typename BMatricesType::KelvinMatrixType updateConstitutiveRelation(
         double const t,
@@ -93,14 +115,6 @@ struct IntegrationPointData final
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
-/// Used by for extrapolation of the integration point values. It is ordered
-/// (and stored) by integration points.
-template <typename ShapeMatrixType>
-struct SecondaryData
-{
-    std::vector<ShapeMatrixType, Eigen::aligned_allocator<ShapeMatrixType>> N_u;
-};
-
 template <typename ShapeFunctionDisplacement, typename ShapeFunctionPressure,
           typename IntegrationMethod, int DisplacementDim>
 class HydroMechanicsLocalAssembler : public LocalAssemblerInterface
@@ -166,6 +180,22 @@ public:
         }
     }
 
+    void writeCheckpoint(std::ostream& os) const override
+    {
+        for (auto const& ip_data : _ip_data)
+        {
+            ip_data.writeCheckpoint(os);
+        }
+    }
+
+    void readCheckpoint(std::istream& is) override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.readCheckpoint(is);
+        }
+    }
+
     void computeSecondaryVariableConcrete(
         double const t, std::vector<double> const& local_x) override;
     void postNonLinearSolverConcrete(std::vector<double> const& local_x,
@@ -175,7 +205,7 @@ public:
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
-        auto const& N_u = _secondary_data.N_u[integration_point];
+        auto const& N_u = _ip_data[integration_point].N_u;
 
         // assumes N is stored contiguously in memory
         return Eigen::Map<const Eigen::RowVectorXd>(N_u.data(), N_u.size());
@@ -399,6 +429,30 @@ private:
         LocalCoupledSolutions const& local_coupled_solutions);
 
 private:
+    /// Returns the matrix interpolating the displacement vector from its nodal
+    /// values, i.e., the shape functions repeated for each component.
+    static typename ShapeMatricesTypeDisplacement::template MatrixType<
+        DisplacementDim, ShapeFunctionDisplacement::NPOINTS * DisplacementDim>
+    computeNuOp(
+        typename ShapeMatricesTypeDisplacement::NodalRowVectorType const& N_u)
+    {
+        using NuOpType = typename ShapeMatricesTypeDisplacement::
+            template MatrixType<DisplacementDim,
+                                ShapeFunctionDisplacement::NPOINTS *
+                                    DisplacementDim>;
+        NuOpType N_u_op = NuOpType::Zero(
+            DisplacementDim,
+            ShapeFunctionDisplacement::NPOINTS * DisplacementDim);
+        for (int i = 0; i < DisplacementDim; ++i)
+        {
+            N_u_op
+                .template block<1, ShapeFunctionDisplacement::NPOINTS>(
+                    i, i * ShapeFunctionDisplacement::NPOINTS)
+                .noalias() = N_u;
+        }
+        return N_u_op;
+    }
+
     HydroMechanicsProcessData<DisplacementDim>& _process_data;
 
     using BMatricesType =
@@ -412,9 +466,6 @@ private:
     IntegrationMethod _integration_method;
     MeshLib::Element const& _element;
     bool const _is_axially_symmetric;
-    SecondaryData<
-        typename ShapeMatricesTypeDisplacement::ShapeMatrices::ShapeType>
-        _secondary_data;
 
     static const int pressure_index = 0;
     static const int pressure_size = ShapeFunctionPressure::NPOINTS;
@@ -358,6 +358,26 @@ void HydroMechanicsProcess<DisplacementDim>::preTimestepConcreteProcess(
             *_local_to_global_index_map, x, t, dt);
 }
 
+template <int DisplacementDim>
+void HydroMechanicsProcess<DisplacementDim>::writeCheckpointConcreteProcess(
+    std::ostream& os) const
+{
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        local_assembler->writeCheckpoint(os);
+    }
+}
+
+template <int DisplacementDim>
+void HydroMechanicsProcess<DisplacementDim>::readCheckpointConcreteProcess(
+    std::istream& is)
+{
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->readCheckpoint(is);
+    }
+}
+
 template <int DisplacementDim>
 void HydroMechanicsProcess<DisplacementDim>::postTimestepConcreteProcess(
     GlobalVector const& x, const double /*t*/, const double /*delta_t*/,
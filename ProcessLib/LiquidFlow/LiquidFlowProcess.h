@@ -97,6 +97,12 @@ private:
         const double dxdot_dx, const double dx_dx, GlobalMatrix& M,
         GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac) override;
 
+    // The process has no history dependent data besides the solution.
+    void writeCheckpointConcreteProcess(std::ostream& /*os*/) const override
+    {
+    }
+    void readCheckpointConcreteProcess(std::istream& /*is*/) override {}
+
     const int _gravitational_axis_id;
     const double _gravitational_acceleration;
     const double _reference_temperature;
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <iosfwd>
+
 #include <Eigen/Dense>
 
 #include "NumLib/NumericsConfig.h"
@@ -85,6 +87,13 @@ public:
                              GlobalVector const& x, double const t,
                              bool const use_monolithic_scheme);
 
+    /// Writes the state stored at the integration points, e.g., stresses and
+    /// material state variables, for a checkpoint.
+    virtual void writeCheckpoint(std::ostream& /*os*/) const {}
+
+    /// Restores the state written by writeCheckpoint().
+    virtual void readCheckpoint(std::istream& /*is*/) {}
+
     /// Computes the flux in the point \c p_local_coords that is given in local
     /// coordinates using the values from \c local_x.
     virtual Eigen::Vector3d getFlux(
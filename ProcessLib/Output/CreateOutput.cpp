@@ -89,8 +89,22 @@ std::unique_ptr<Output> createOutput(const BaseLib::ConfigTree& config,
         //! \ogs_file_param{prj__time_loop__output__output_iteration_results}
         config.getConfigParameter<bool>("output_iteration_results", false);
 
+    bool async_output =
+        //! \ogs_file_param{prj__time_loop__output__async_output}
+        config.getConfigParameter<bool>("async_output", false);
+#ifdef USE_PETSC
+    if (async_output)
+    {
+        WARN(
+            "Asynchronous output is not supported with PETSc. The output will "
+            "be written synchronously.");
+        async_output = false;
+    }
+#endif
+
     return std::make_unique<Output>(output_directory, prefix, compress_output,
                                     data_mode, output_iteration_results,
+                                    async_output,
                                     std::move(repeats_each_steps),
                                     std::move(fixed_output_times));
 }
@@ -17,7 +17,9 @@
 
 #include "Applications/InSituLib/Adaptor.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/Profiler.h"
 #include "BaseLib/RunTime.h"
+#include "MeshLib/Mesh.h"
 #include "ProcessLib/Process.h"
 
 namespace
@@ -84,6 +86,7 @@ bool Output::shallDoOutput(unsigned timestep, double const t)
 Output::Output(std::string output_directory, std::string prefix,
                bool const compress_output, std::string const& data_mode,
                bool const output_nonlinear_iteration_results,
+               bool const async_output,
                std::vector<PairRepeatEachSteps> repeats_each_steps,
                std::vector<double>&& fixed_output_times)
     : _output_directory(std::move(output_directory)),
@@ -94,6 +97,75 @@ Output::Output(std::string output_directory, std::string prefix,
       _repeats_each_steps(std::move(repeats_each_steps)),
       _fixed_output_times(std::move(fixed_output_times))
 {
+    if (async_output)
+    {
+        // At most two buffers are queued; the time loop waits otherwise.
+        _async_writer = std::make_unique<BaseLib::AsyncTaskQueue>(2);
+    }
+}
+
+Output::~Output()
+{
+    try
+    {
+        waitForPendingOutput();
+    }
+    catch (std::exception const& e)
+    {
+        ERR("Writing output failed: %s", e.what());
+    }
+}
+
+void Output::waitForPendingOutput()
+{
+    if (!_async_writer)
+    {
+        return;
+    }
+
+    _async_writer->waitForAll();
+    for (auto& process_data : _process_to_process_data)
+    {
+        for (auto& buffer : process_data.second.output_buffers)
+        {
+            if (buffer.pending_write.valid())
+            {
+                buffer.pending_write.get();
+            }
+        }
+    }
+}
+
+void Output::queueOutput(ProcessData& process_data, MeshLib::Mesh const& mesh,
+                         std::string const& output_file_path,
+                         std::string const& vtu_file_name, double const t)
+{
+    auto& buffer = process_data.output_buffers[process_data.next_output_buffer];
+    process_data.next_output_buffer =
+        (process_data.next_output_buffer + 1) %
+        process_data.output_buffers.size();
+
+    // Wait until the buffer has been written; rethrows errors of that write.
+    if (buffer.pending_write.valid())
+    {
+        buffer.pending_write.get();
+    }
+
+    buffer.properties = mesh.getProperties();
+
+    auto const& buffered_properties = buffer.properties;
+    auto& pvd_file = process_data.pvd_file;
+    bool const compress_output = _output_file_compression;
+    int const data_mode = _output_file_data_mode;
+    buffer.pending_write = _async_writer->push([=, &mesh, &buffered_properties,
+                                                &pvd_file]() {
+        makeOutput(output_file_path, mesh, buffered_properties,
+                   compress_output, data_mode);
+        if (!vtu_file_name.empty())
+        {
+            pvd_file.addVTUFile(vtu_file_name, t);
+        }
+    });
 }
 
 void Output::addProcess(ProcessLib::Process const& process,
@@ -102,9 +174,17 @@ void Output::addProcess(ProcessLib::Process const& process,
     auto const filename = BaseLib::joinPaths(
         _output_directory,
         _output_file_prefix + "_pcs_" + std::to_string(process_id) + ".pvd");
-    _process_to_process_data.emplace(std::piecewise_construct,
-                                     std::forward_as_tuple(&process),
-                                     std::forward_as_tuple(filename));
+    _process_to_process_data.emplace(
+        std::piecewise_construct, std::forward_as_tuple(&process),
+        std::forward_as_tuple(filename));
+}
+
+void Output::continueExistingOutput(double const restart_time)
+{
+    for (auto& process_data : _process_to_process_data)
+    {
+        process_data.second.pvd_file.continueExisting(restart_time);
+    }
 }
 
 // TODO return a reference.
@@ -140,6 +220,7 @@ void Output::doOutputAlways(Process const& process,
                             const double t,
                             GlobalVector const& x)
 {
+    BaseLib::ProfilingScope const profiling_scope("output");
     BaseLib::RunTime time_output;
     time_output.start();
 
@@ -166,6 +247,15 @@ void Output::doOutputAlways(Process const& process,
     DBUG("output to %s", output_file_path.c_str());
 
     ProcessData* process_data = findProcessData(process, process_id);
+    if (_async_writer)
+    {
+        queueOutput(*process_data, process.getMesh(), output_file_path,
+                    output_file_name, t);
+        INFO("[time] Output of timestep %d took %g s.", timestep,
+             time_output.elapsed());
+        return;
+    }
+
     process_data->pvd_file.addVTUFile(output_file_name, t);
     INFO("[time] Output of timestep %d took %g s.", timestep,
          time_output.elapsed());
@@ -220,6 +310,7 @@ void Output::doOutputNonlinearIteration(Process const& process,
         return;
     }
 
+    BaseLib::ProfilingScope const profiling_scope("output");
     BaseLib::RunTime time_output;
     time_output.start();
 
@@ -237,8 +328,7 @@ void Output::doOutputNonlinearIteration(Process const& process,
           process.isMonolithicSchemeUsed()))
         return;
 
-    // Only check whether a process data is available for output.
-    findProcessData(process, process_id);
+    ProcessData* process_data = findProcessData(process, process_id);
 
     std::string const output_file_name =
         _output_file_prefix + "_pcs_" + std::to_string(process_id) + "_ts_" +
@@ -249,6 +339,13 @@ void Output::doOutputNonlinearIteration(Process const& process,
 
     DBUG("output iteration results to %s", output_file_path.c_str());
 
+    if (_async_writer)
+    {
+        queueOutput(*process_data, process.getMesh(), output_file_path, "", t);
+        INFO("[time] Output took %g s.", time_output.elapsed());
+        return;
+    }
+
     INFO("[time] Output took %g s.", time_output.elapsed());
 
     makeOutput(output_file_path, process.getMesh(), _output_file_compression,
@@ -9,10 +9,15 @@
 
 #pragma once
 
+#include <array>
+#include <future>
 #include <map>
+#include <memory>
 #include <utility>
 
+#include "BaseLib/AsyncTaskQueue.h"
 #include "MeshLib/IO/VtkIO/PVDFile.h"
+#include "MeshLib/Properties.h"
 #include "ProcessOutput.h"
 
 namespace ProcessLib
@@ -23,6 +28,10 @@ class Process;
  *
  * This class decides at which timesteps output is written
  * and initiates the writing process.
+ *
+ * In the asynchronous mode the output data of a process are copied into one of
+ * two buffers, and the VTU files are written by a background thread. The time
+ * loop only waits if both buffers of a process are still being written.
  */
 class Output
 {
@@ -42,9 +51,18 @@ public:
     Output(std::string output_directory, std::string prefix,
            bool const compress_output, std::string const& data_mode,
            bool const output_nonlinear_iteration_results,
+           bool const async_output,
            std::vector<PairRepeatEachSteps> repeats_each_steps,
            std::vector<double>&& fixed_output_times);
 
+    //! Waits for pending asynchronous writes.
+    ~Output();
+
+    //! Appends the results to existing PVD files instead of overwriting them
+    //! when a simulation is restarted at the given time. Must be called after
+    //! addProcess() and before any output is written.
+    void continueExistingOutput(double const restart_time);
+
     //! TODO doc. Opens a PVD file for each process.
     void addProcess(ProcessLib::Process const& process, const int process_id);
 
@@ -80,12 +98,32 @@ public:
 
     std::vector<double> getFixedOutputTimes() {return _fixed_output_times;}
 
+    //! Blocks until all pending asynchronous writes have finished. Errors
+    //! which occurred during writing are rethrown.
+    //! Does nothing if the output is written synchronously.
+    void waitForPendingOutput();
+
 private:
     struct ProcessData
     {
-        ProcessData(std::string const& filename) : pvd_file(filename) {}
+        explicit ProcessData(std::string const& filename) : pvd_file(filename)
+        {
+        }
 
         MeshLib::IO::PVDFile pvd_file;
+
+        //! A copy of the process' mesh properties taken at output time and
+        //! the state of its asynchronous write. The mesh topology is not
+        //! copied; it does not change during the simulation.
+        struct OutputBuffer
+        {
+            MeshLib::Properties properties;
+            std::future<void> pending_write;
+        };
+
+        //! Double buffer used in the asynchronous output mode.
+        std::array<OutputBuffer, 2> output_buffers;
+        std::size_t next_output_buffer = 0;
     };
 
     std::string const _output_directory;
@@ -118,6 +156,20 @@ private:
 
     //! Determines if there should be output at the given \c timestep or \c t.
     bool shallDoOutput(unsigned timestep, double const t);
+
+    //! Copies the properties of the \c mesh into the next output buffer of the
+    //! process and queues writing the buffer to \c output_file_path.
+    //! If \c vtu_file_name is not empty, it is added to the PVD file after
+    //! the VTU file has been written.
+    void queueOutput(ProcessData& process_data, MeshLib::Mesh const& mesh,
+                     std::string const& output_file_path,
+                     std::string const& vtu_file_name, double const t);
+
+    //! Writes the output buffers in the background. Null if the output is
+    //! written synchronously.
+    //! Declared last, s.t. the writer thread is stopped before the other
+    //! members are destroyed.
+    std::unique_ptr<BaseLib::AsyncTaskQueue> _async_writer;
 };
 
 
@@ -9,10 +9,14 @@
 
 #include "ProcessOutput.h"
 
+#include <map>
+
 #include "BaseLib/BuildInfo.h"
+#include "BaseLib/Profiler.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/NumericsConfig.h"
 
 #include "IntegrationPointWriter.h"
 
@@ -28,16 +32,12 @@ static void addOgsVersion(MeshLib::Mesh& mesh)
                              BaseLib::BuildInfo::ogs_version.end());
 }
 
-static void addSecondaryVariableNodes(
-    double const t,
-    GlobalVector const& x,
-    NumLib::LocalToGlobalIndexMap const& dof_table,
+static void copySecondaryVariableNodes(
+    GlobalVector const& nodal_values,
     ProcessLib::SecondaryVariable const& var,
     std::string const& output_name,
     MeshLib::Mesh& mesh)
 {
-    DBUG("  secondary variable %s", output_name.c_str());
-
     auto& nodal_values_mesh = *MeshLib::getOrCreateMeshProperty<double>(
         mesh, output_name, MeshLib::MeshItemType::Node,
         var.fcts.num_components);
@@ -52,9 +52,6 @@ static void addSecondaryVariableNodes(
             nodal_values_mesh.size());
     }
 
-    std::unique_ptr<GlobalVector> result_cache;
-    auto const& nodal_values =
-        var.fcts.eval_field(t, x, dof_table, result_cache);
 #ifdef USE_PETSC
     std::size_t const global_vector_size =
         nodal_values.getLocalSize() + nodal_values.getGhostSize();
@@ -73,6 +70,57 @@ static void addSecondaryVariableNodes(
     nodal_values.copyValues(nodal_values_mesh);
 }
 
+static void addSecondaryVariableNodes(
+    double const t,
+    GlobalVector const& x,
+    NumLib::LocalToGlobalIndexMap const& dof_table,
+    ProcessLib::SecondaryVariable const& var,
+    std::string const& output_name,
+    MeshLib::Mesh& mesh)
+{
+    DBUG("  secondary variable %s", output_name.c_str());
+
+    std::unique_ptr<GlobalVector> result_cache;
+    auto const& nodal_values =
+        var.fcts.eval_field(t, x, dof_table, result_cache);
+    copySecondaryVariableNodes(nodal_values, var, output_name, mesh);
+}
+
+/// Extrapolates all given secondary variables, which share the same
+/// extrapolator, in a single pass over the elements.
+static void addExtrapolatedSecondaryVariablesNodes(
+    double const t,
+    GlobalVector const& x,
+    NumLib::LocalToGlobalIndexMap const& dof_table,
+    NumLib::Extrapolator& extrapolator,
+    std::vector<std::pair<ProcessLib::SecondaryVariable const*,
+                          std::string>> const& variables,
+    MeshLib::Mesh& mesh)
+{
+    std::vector<unsigned> num_components;
+    std::vector<std::unique_ptr<NumLib::ExtrapolatableElementCollection>>
+        extrapolatables;
+    std::vector<NumLib::ExtrapolatableElementCollection const*>
+        extrapolatables_ptrs;
+    for (auto const& var_name : variables)
+    {
+        DBUG("  secondary variable %s", var_name.second.c_str());
+        num_components.push_back(var_name.first->fcts.num_components);
+        extrapolatables.push_back(var_name.first->fcts.make_extrapolatables());
+        extrapolatables_ptrs.push_back(extrapolatables.back().get());
+    }
+
+    std::vector<std::unique_ptr<GlobalVector>> nodal_values;
+    extrapolator.extrapolate(num_components, extrapolatables_ptrs, t, x,
+                             dof_table, nodal_values);
+
+    for (std::size_t i = 0; i < variables.size(); ++i)
+    {
+        copySecondaryVariableNodes(*nodal_values[i], *variables[i].first,
+                                   variables[i].second, mesh);
+    }
+}
+
 static void addSecondaryVariableResiduals(
     double const t,
     GlobalVector const& x,
@@ -194,23 +242,36 @@ void processOutputData(
             auto const& mesh_subset =
                 dof_table.getMeshSubset(sub_meshset_id, component_id);
             auto const mesh_id = mesh_subset.getMeshID();
-            for (auto const* node : mesh_subset.getNodes())
-            {
-                MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
-                                          node->getID());
-
-                auto const global_component_id =
-                    global_component_offset + component_id;
-                auto const index = dof_table.getLocalIndex(
-                    l, global_component_id, x.getRangeBegin(), x.getRangeEnd());
-
-                output_data[node->getID() * n_components + component_id] =
-                    x_copy[index];
-            }
+            auto const& nodes = mesh_subset.getNodes();
+            // The lookups of the indices are independent for each node.
+            GlobalExecutor::executeIndexed(
+                nodes.size(), [&](std::size_t const i) {
+                    auto const node_id = nodes[i]->getID();
+                    MeshLib::Location const l(
+                        mesh_id, MeshLib::MeshItemType::Node, node_id);
+
+                    auto const global_component_id =
+                        global_component_offset + component_id;
+                    auto const index =
+                        dof_table.getLocalIndex(l, global_component_id,
+                                                x.getRangeBegin(),
+                                                x.getRangeEnd());
+
+                    output_data[node_id * n_components + component_id] =
+                        x_copy[index];
+                });
         }
     }
 
     // Secondary variables output
+    BaseLib::ProfilingScope const profiling_scope("extrapolation");
+
+    // Extrapolated secondary variables are grouped by their extrapolator and
+    // extrapolated together. Residuals are computed from the extrapolator's
+    // single-property state, therefore no grouping in that case.
+    std::map<NumLib::Extrapolator*,
+             std::vector<std::pair<SecondaryVariable const*, std::string>>>
+        extrapolated_variables;
     for (auto const& external_variable_name : output_variables)
     {
         if (!already_output.insert(external_variable_name).second)
@@ -219,9 +280,17 @@ void processOutputData(
             continue;
         }
 
-        addSecondaryVariableNodes(
-            t, x, dof_table, secondary_variables.get(external_variable_name),
-            external_variable_name, mesh);
+        auto const& var = secondary_variables.get(external_variable_name);
+        if (!process_output.output_residuals && var.fcts.extrapolator &&
+            var.fcts.make_extrapolatables)
+        {
+            extrapolated_variables[var.fcts.extrapolator].emplace_back(
+                &var, external_variable_name);
+            continue;
+        }
+
+        addSecondaryVariableNodes(t, x, dof_table, var, external_variable_name,
+                                  mesh);
         if (process_output.output_residuals)
         {
             addSecondaryVariableResiduals(
@@ -231,6 +300,13 @@ void processOutputData(
         }
     }
 
+    for (auto const& extrapolator_variables : extrapolated_variables)
+    {
+        addExtrapolatedSecondaryVariablesNodes(
+            t, x, dof_table, *extrapolator_variables.first,
+            extrapolator_variables.second, mesh);
+    }
+
     addIntegrationPointWriter(mesh, integration_point_writer);
 }
 
@@ -243,4 +319,15 @@ void makeOutput(std::string const& file_name, MeshLib::Mesh& mesh,
     vtu_interface.writeToFile(file_name);
 }
 
+void makeOutput(std::string const& file_name, MeshLib::Mesh const& mesh,
+                MeshLib::Properties const& properties,
+                bool const compress_output, int const data_mode)
+{
+    // Write output file
+    DBUG("Writing output to \'%s\'.", file_name.c_str());
+    MeshLib::IO::VtuInterface vtu_interface(&mesh, &properties, data_mode,
+                                            compress_output);
+    vtu_interface.writeToFile(file_name);
+}
+
 }  // namespace ProcessLib
@@ -47,4 +47,10 @@ void processOutputData(
 void makeOutput(std::string const& file_name, MeshLib::Mesh& mesh,
                 bool const compress_output, int const data_mode);
 
+//! Writes the topology of the given \c mesh together with the given
+//! \c properties, e.g., a snapshot of the mesh's properties.
+void makeOutput(std::string const& file_name, MeshLib::Mesh const& mesh,
+                MeshLib::Properties const& properties,
+                bool const compress_output, int const data_mode);
+
 }  // namespace ProcessLib
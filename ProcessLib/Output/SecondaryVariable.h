@@ -96,6 +96,17 @@ struct SecondaryVariableFunctions final
     //! further information check the specific NumLib::Extrapolator
     //! documentation.
     Function const eval_residuals;
+
+    //! If the secondary variable is extrapolated, the extrapolator used by
+    //! eval_field, otherwise \c nullptr. Secondary variables sharing the same
+    //! extrapolator can be extrapolated together in a single pass over the
+    //! elements.
+    NumLib::Extrapolator* extrapolator = nullptr;
+
+    //! Creates the collection of elements whose integration point values are
+    //! extrapolated. Only set together with \c extrapolator.
+    std::function<std::unique_ptr<NumLib::ExtrapolatableElementCollection>()>
+        make_extrapolatables;
 };
 
 //! Stores information about a specific secondary variable
@@ -194,7 +205,16 @@ SecondaryVariableFunctions makeExtrapolator(
                                         dof_table);
         return extrapolator.getElementResiduals();
     };
-    return {num_components, eval_field, eval_residuals};
+    SecondaryVariableFunctions fcts{num_components, eval_field,
+                                    eval_residuals};
+    fcts.extrapolator = &extrapolator;
+    fcts.make_extrapolatables = [&local_assemblers,
+                                 integration_point_values_method]() {
+        return std::make_unique<NumLib::ExtrapolatableLocalAssemblerCollection<
+            LocalAssemblerCollection>>(local_assemblers,
+                                       integration_point_values_method);
+    };
+    return fcts;
 }
 
 }  // namespace ProcessLib
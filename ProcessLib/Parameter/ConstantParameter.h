@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <utility>
 
 #include "Parameter.h"
@@ -46,6 +47,23 @@ struct ConstantParameter final : public Parameter<T>
         return _values;
     }
 
+    void getValue(double const /*t*/, SpatialPosition const& /*pos*/,
+                  T* const values) const override
+    {
+        std::copy(_values.begin(), _values.end(), values);
+    }
+
+    void getIntegrationPointValuesOnElement(
+        MeshLib::Element const& /*element*/,
+        unsigned const n_integration_points, double const /*t*/,
+        T* values) const override
+    {
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            values = std::copy(_values.begin(), _values.end(), values);
+        }
+    }
+
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
         MeshLib::Element const& element, double const /*t*/) const override
     {
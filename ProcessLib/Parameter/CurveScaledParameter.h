@@ -46,18 +46,44 @@ struct CurveScaledParameter final : public Parameter<T> {
     std::vector<T> const& operator()(double const t,
                                      SpatialPosition const& pos) const override
     {
-        auto const& tup = (*_parameter)(t, pos);
-        auto const scaling = _curve.getValue(t);
+        getValue(t, pos, _cache.data());
+        return _cache;
+    }
+
+    void getValue(double const t, SpatialPosition const& pos,
+                  T* const values) const override
+    {
+        _parameter->getValue(t, pos, values);
+        scale(t, _parameter->getNumberOfComponents(), values);
+    }
+
+    void getIntegrationPointValuesOnElement(
+        MeshLib::Element const& element, unsigned const n_integration_points,
+        double const t, T* const values) const override
+    {
+        _parameter->getIntegrationPointValuesOnElement(
+            element, n_integration_points, t, values);
+        scale(t, n_integration_points * _parameter->getNumberOfComponents(),
+              values);
+    }
 
-        auto const num_comp = _parameter->getNumberOfComponents();
-        for (int c = 0; c < num_comp; ++c)
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
+        MeshLib::Element const& element, double const t) const override
+    {
+        return _curve.getValue(t) *
+               _parameter->getNodalValuesOnElement(element, t);
+    }
+
+private:
+    void scale(double const t, int const n_values, T* const values) const
+    {
+        auto const scaling = _curve.getValue(t);
+        for (int i = 0; i < n_values; ++i)
         {
-            _cache[c] = scaling * tup[c];
+            values[i] *= scaling;
         }
-        return _cache;
     }
 
-private:
     MathLib::PiecewiseLinearInterpolation const& _curve;
     Parameter<T> const* _parameter;
     mutable std::vector<T> _cache;
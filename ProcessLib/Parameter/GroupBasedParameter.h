@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <utility>
 
 #include "BaseLib/Error.h"
@@ -63,14 +64,46 @@ struct GroupBasedParameter final
     {
         auto const item_id = getMeshItemID(pos, type<MeshItemType>());
         assert(item_id);
-        int const index = _property_index[item_id.get()];
+        return getGroupValues(item_id.get());
+    }
+
+    void getValue(double const t, SpatialPosition const& pos,
+                  T* const values) const override
+    {
+        auto const& group_values = (*this)(t, pos);
+        std::copy(group_values.begin(), group_values.end(), values);
+    }
+
+    void getIntegrationPointValuesOnElement(
+        MeshLib::Element const& element, unsigned const n_integration_points,
+        double const t, T* values) const override
+    {
+        if (MeshItemType != MeshLib::MeshItemType::Cell)
+        {
+            Parameter<T>::getIntegrationPointValuesOnElement(
+                element, n_integration_points, t, values);
+            return;
+        }
+
+        // The values are the same for all integration points.
+        auto const& group_values = getGroupValues(element.getID());
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            values =
+                std::copy(group_values.begin(), group_values.end(), values);
+        }
+    }
+
+private:
+    std::vector<T> const& getGroupValues(std::size_t const item_id) const
+    {
+        int const index = _property_index[item_id];
         auto const& values = _vec_values[index];
         if (values.empty())
             OGS_FATAL("No data found for the group index %d", index);
-         return values;
+        return values;
     }
 
-private:
     template <MeshLib::MeshItemType ITEM_TYPE> struct type {};
 
     static boost::optional<std::size_t>
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "Parameter.h"
 
 namespace MeshLib
@@ -37,8 +39,15 @@ struct MeshElementParameter final : public Parameter<T> {
         return _property.getNumberOfComponents();
     }
 
-    std::vector<T> const& operator()(double const /*t*/,
+    std::vector<T> const& operator()(double const t,
                                      SpatialPosition const& pos) const override
+    {
+        getValue(t, pos, _cache.data());
+        return _cache;
+    }
+
+    void getValue(double const /*t*/, SpatialPosition const& pos,
+                  T* const values) const override
     {
         auto const e = pos.getElementID();
         if (!e)
@@ -47,36 +56,49 @@ struct MeshElementParameter final : public Parameter<T> {
                 "Trying to access a MeshElementParameter but the element id is "
                 "not specified.");
         }
+        getElementValues(*e, values);
+    }
+
+    void getIntegrationPointValuesOnElement(
+        MeshLib::Element const& element, unsigned const n_integration_points,
+        double const /*t*/, T* const values) const override
+    {
+        // The values are the same for all integration points.
+        getElementValues(element.getID(), values);
         auto const num_comp = _property.getNumberOfComponents();
-        for (int c = 0; c < num_comp; ++c)
+        for (unsigned ip = 1; ip < n_integration_points; ++ip)
         {
-            _cache[c] = _property.getComponent(*e, c);
+            std::copy_n(values, num_comp, values + ip * num_comp);
         }
-        return _cache;
     }
 
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
-        MeshLib::Element const& element, double const t) const override
+        MeshLib::Element const& element, double const /*t*/) const override
     {
         auto const n_nodes = element.getNumberOfNodes();
-        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(
-            n_nodes, getNumberOfComponents());
+        Eigen::Matrix<T, Eigen::Dynamic, 1> values(getNumberOfComponents());
+        getElementValues(element.getID(), values.data());
 
         // Column vector of values, copied for each node.
-        SpatialPosition x_position;
-        x_position.setElementID(element.getID());
-        auto const& values = this->operator()(t, x_position);
-        auto const row_values =
-            Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
-                values.data(), values.size());
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(
+            n_nodes, getNumberOfComponents());
         for (unsigned i = 0; i < n_nodes; ++i)
         {
-            result.row(i) = row_values;
+            result.row(i) = values.transpose();
         }
         return result;
     }
 
 private:
+    void getElementValues(std::size_t const element_id, T* const values) const
+    {
+        auto const num_comp = _property.getNumberOfComponents();
+        for (int c = 0; c < num_comp; ++c)
+        {
+            values[c] = _property.getComponent(element_id, c);
+        }
+    }
+
     MeshLib::PropertyVector<T> const& _property;
     mutable std::vector<T> _cache;
 };
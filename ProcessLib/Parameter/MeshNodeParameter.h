@@ -41,8 +41,15 @@ struct MeshNodeParameter final : public Parameter<T> {
         return _property.getNumberOfComponents();
     }
 
-    std::vector<T> const& operator()(double const /*t*/,
+    std::vector<T> const& operator()(double const t,
                                      SpatialPosition const& pos) const override
+    {
+        getValue(t, pos, _cache.data());
+        return _cache;
+    }
+
+    void getValue(double const /*t*/, SpatialPosition const& pos,
+                  T* const values) const override
     {
         auto const n = pos.getNodeID();
         if (!n)
@@ -54,27 +61,25 @@ struct MeshNodeParameter final : public Parameter<T> {
         auto const num_comp = _property.getNumberOfComponents();
         for (int c = 0; c < num_comp; ++c)
         {
-            _cache[c] = _property.getComponent(*n, c);
+            values[c] = _property.getComponent(*n, c);
         }
-        return _cache;
     }
 
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
-        MeshLib::Element const& element, double const t) const override
+        MeshLib::Element const& element, double const /*t*/) const override
     {
         auto const n_nodes = element.getNumberOfNodes();
-        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(
-            n_nodes, getNumberOfComponents());
+        auto const num_comp = _property.getNumberOfComponents();
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(n_nodes,
+                                                                num_comp);
 
-        SpatialPosition x_position;
         auto const nodes = element.getNodes();
         for (unsigned i = 0; i < n_nodes; ++i)
         {
-            x_position.setNodeID(nodes[i]->getID());
-            auto const& values = this->operator()(t, x_position);
-            result.row(i) =
-                Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
-                    values.data(), values.size());
+            for (int c = 0; c < num_comp; ++c)
+            {
+                result(i, c) = _property.getComponent(nodes[i]->getID(), c);
+            }
         }
 
         return result;
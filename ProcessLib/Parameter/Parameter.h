@@ -77,9 +77,68 @@ struct Parameter : public ParameterBase
     virtual int getNumberOfComponents() const = 0;
 
     //! Returns the parameter value at the given time and position.
+    //!
+    //! \note The returned reference might point to storage of the parameter
+    //! which is overwritten by the next call. Use getValue() or
+    //! getIntegrationPointValuesOnElement() if the parameter is evaluated
+    //! concurrently.
     virtual std::vector<T> const& operator()(
         double const t, SpatialPosition const& pos) const = 0;
 
+    //! Writes the parameter value at the given time and position to \c
+    //! values, which must have space for getNumberOfComponents() entries.
+    //!
+    //! Other than operator() this method does not modify the parameter and
+    //! can be called from several threads at the same time.
+    virtual void getValue(double const t, SpatialPosition const& pos,
+                          T* const values) const = 0;
+
+    //! Writes the parameter values at all integration points of the given
+    //! element to \c values.
+    //!
+    //! The values are stored integration point by integration point, i.e.,
+    //! the component \c c at the integration point \c ip is written to
+    //! <tt>values[ip * getNumberOfComponents() + c]</tt>. The caller provides
+    //! the storage for <tt>n_integration_points * getNumberOfComponents()</tt>
+    //! entries.
+    //!
+    //! The default implementation evaluates the parameter for each
+    //! integration point separately. Derived classes whose values do not vary
+    //! within an element evaluate them only once.
+    virtual void getIntegrationPointValuesOnElement(
+        MeshLib::Element const& element, unsigned const n_integration_points,
+        double const t, T* const values) const
+    {
+        auto const n_components = getNumberOfComponents();
+        SpatialPosition x_position;
+        x_position.setElementID(element.getID());
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            x_position.setIntegrationPoint(ip);
+            getValue(t, x_position, values + ip * n_components);
+        }
+    }
+
+    //! Writes the parameter values at the integration points of all elements
+    //! in the range [\c first, \c last) to \c values, element by element in
+    //! the layout of getIntegrationPointValuesOnElement(). All elements must
+    //! have \c n_integration_points integration points.
+    void getIntegrationPointValuesOnElements(
+        std::vector<MeshLib::Element*>::const_iterator first,
+        std::vector<MeshLib::Element*>::const_iterator const last,
+        unsigned const n_integration_points, double const t,
+        T* values) const
+    {
+        auto const n_values_per_element =
+            n_integration_points * getNumberOfComponents();
+        for (; first != last; ++first)
+        {
+            getIntegrationPointValuesOnElement(**first, n_integration_points,
+                                               t, values);
+            values += n_values_per_element;
+        }
+    }
+
     //! Returns a matrix of values for all nodes of the given element.
     //
     // The matrix is of the shape NxC, where N is the number of nodes and C is
@@ -98,18 +157,15 @@ struct Parameter : public ParameterBase
         Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(n_nodes,
                                                                 n_components);
 
-        // Column vector of values, copied for each node.
+        Eigen::Matrix<T, Eigen::Dynamic, 1> values(n_components);
         SpatialPosition x_position;
         auto const nodes = element.getNodes();
         for (int i = 0; i < n_nodes; ++i)
         {
             x_position.setAll(
                 nodes[i]->getID(), element.getID(), boost::none, boost::none);
-            auto const& values = this->operator()(t, x_position);
-            auto const row_values =
-                Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
-                    values.data(), values.size());
-            result.row(i) = row_values;
+            getValue(t, x_position, values.data());
+            result.row(i) = values.transpose();
         }
 
         return result;
@@ -194,6 +194,51 @@ void Process::assemble(const double t, GlobalVector const& x, GlobalMatrix& M,
     _source_term_collections[pcs_id].integrate(t, x, b, nullptr);
 }
 
+void Process::assembleLinearTimeInvariant(const double t,
+                                          GlobalVector const& x,
+                                          GlobalMatrix& M, GlobalMatrix& K,
+                                          GlobalVector& b,
+                                          bool const assemble_matrices)
+{
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+
+    const auto pcs_id =
+        (_coupled_solutions) != nullptr ? _coupled_solutions->process_id : 0;
+    if (_time_invariant_b.size() <= static_cast<std::size_t>(pcs_id))
+    {
+        _time_invariant_b.resize(pcs_id + 1);
+        _time_invariant_bc_K.resize(pcs_id + 1);
+    }
+    auto& local_assemblers_b = _time_invariant_b[pcs_id];
+    auto& bc_K = _time_invariant_bc_K[pcs_id];
+
+    if (assemble_matrices || !local_assemblers_b)
+    {
+        assembleConcreteProcess(t, x, M, K, b);
+        MathLib::LinAlg::finalizeAssembly(b);
+        local_assemblers_b =
+            MathLib::MatrixVectorTraits<GlobalVector>::newInstance(b);
+
+        _boundary_conditions[pcs_id].applyNaturalBC(t, x, K, b, nullptr);
+    }
+    else
+    {
+        MathLib::LinAlg::copy(*local_assemblers_b, b);
+
+        // The contributions to K are already contained in the stored K and
+        // are discarded here.
+        if (!bc_K)
+        {
+            bc_K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(
+                getMatrixSpecifications(pcs_id));
+        }
+        bc_K->setZero();
+        _boundary_conditions[pcs_id].applyNaturalBC(t, x, *bc_K, b, nullptr);
+    }
+
+    _source_term_collections[pcs_id].integrate(t, x, b, nullptr);
+}
+
 void Process::assembleWithJacobian(const double t, GlobalVector const& x,
                                    GlobalVector const& xdot,
                                    const double dxdot_dx, const double dx_dx,
@@ -212,6 +257,47 @@ void Process::assembleWithJacobian(const double t, GlobalVector const& x,
     _boundary_conditions[pcs_id].applyNaturalBC(t, x, K, b, &Jac);
 }
 
+void Process::assembleResidualWithJacobian(const double t,
+                                           GlobalVector const& x,
+                                           GlobalVector const& xdot,
+                                           const double dxdot_dx,
+                                           const double dx_dx,
+                                           GlobalVector& res, GlobalMatrix& Jac)
+{
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+    MathLib::LinAlg::setLocalAccessibleVector(xdot);
+
+    const auto pcs_id =
+        (_coupled_solutions) != nullptr ? _coupled_solutions->process_id : 0;
+    if (_residual_bc_K.size() <= static_cast<std::size_t>(pcs_id))
+        _residual_bc_K.resize(pcs_id + 1);
+    auto& bc_K = _residual_bc_K[pcs_id];
+    if (!bc_K)
+    {
+        // Only few entries are expected, hence no sparsity pattern.
+        auto const spec = getMatrixSpecifications(pcs_id);
+        bc_K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(
+            MathLib::MatrixSpecifications(spec.nrows, spec.ncols,
+                                          spec.ghost_indices, nullptr));
+    }
+    bc_K->setZero();
+
+    // The global assembler does not access M and K in this mode, bc_K only
+    // serves as a placeholder for them. res receives b - M xdot - K x.
+    _global_assembler.setResidualAssembly(true);
+    assembleWithJacobianConcreteProcess(t, x, xdot, dxdot_dx, dx_dx, *bc_K,
+                                        *bc_K, res, Jac);
+    _global_assembler.setResidualAssembly(false);
+
+    _boundary_conditions[pcs_id].applyNaturalBC(t, x, *bc_K, res, &Jac);
+
+    // res = bc_K * x - res
+    MathLib::LinAlg::finalizeAssembly(*bc_K);
+    MathLib::LinAlg::finalizeAssembly(res);
+    MathLib::LinAlg::scale(res, -1.0);
+    MathLib::LinAlg::matMultAdd(*bc_K, x, res, res);
+}
+
 void Process::constructDofTable()
 {
     // Create single component dof in every of the mesh's nodes.
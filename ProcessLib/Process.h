@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <tuple>
 
+#include "BaseLib/Error.h"
 #include "NumLib/NamedFunctionCaller.h"
 #include "NumLib/ODESolver/NonlinearSolver.h"
 #include "NumLib/ODESolver/ODESystem.h"
@@ -80,6 +82,17 @@ public:
     void setInitialConditions(const int process_id, const double t,
                               GlobalVector& x);
 
+    /// Writes the state of the process which is not contained in the solution
+    /// vectors, e.g., the stresses and the material state at the integration
+    /// points, for a checkpoint.
+    void writeCheckpoint(std::ostream& os) const
+    {
+        writeCheckpointConcreteProcess(os);
+    }
+
+    /// Restores the state written by writeCheckpoint().
+    void readCheckpoint(std::istream& is) { readCheckpointConcreteProcess(is); }
+
     virtual MathLib::MatrixSpecifications getMatrixSpecifications(
         const int process_id) const override;
 
@@ -95,12 +108,23 @@ public:
     void assemble(const double t, GlobalVector const& x, GlobalMatrix& M,
                   GlobalMatrix& K, GlobalVector& b) final;
 
+    void assembleLinearTimeInvariant(const double t, GlobalVector const& x,
+                                     GlobalMatrix& M, GlobalMatrix& K,
+                                     GlobalVector& b,
+                                     bool const assemble_matrices) final;
+
     void assembleWithJacobian(const double t, GlobalVector const& x,
                               GlobalVector const& xdot, const double dxdot_dx,
                               const double dx_dx, GlobalMatrix& M,
                               GlobalMatrix& K, GlobalVector& b,
                               GlobalMatrix& Jac) final;
 
+    void assembleResidualWithJacobian(const double t, GlobalVector const& x,
+                                      GlobalVector const& xdot,
+                                      const double dxdot_dx,
+                                      const double dx_dx, GlobalVector& res,
+                                      GlobalMatrix& Jac) final;
+
     std::vector<NumLib::IndexValueVector<GlobalIndexType>> const*
     getKnownSolutions(double const t, GlobalVector const& x) const final
     {
@@ -223,6 +247,20 @@ private:
         return NumLib::IterationResult::SUCCESS;
     }
 
+    /// Writes and reads the history dependent data of the process, e.g. the
+    /// data stored at the integration points. A process has to override these
+    /// to support checkpointing, also if it has no such data; otherwise its
+    /// state would silently be lost on a restart.
+    virtual void writeCheckpointConcreteProcess(std::ostream& /*os*/) const
+    {
+        OGS_FATAL("Checkpointing is not supported by this process.");
+    }
+    virtual void readCheckpointConcreteProcess(std::istream& /*is*/)
+    {
+        OGS_FATAL(
+            "Restarting from a checkpoint is not supported by this process.");
+    }
+
 protected:
     virtual void constructDofTable();
 
@@ -301,6 +339,19 @@ private:
     std::vector<SourceTermCollection> _source_term_collections;
 
     ExtrapolatorData _extrapolator_data;
+
+    /// Contributions of the local assemblers to \c b stored by
+    /// assembleLinearTimeInvariant(), one entry per process.
+    std::vector<std::unique_ptr<GlobalVector>> _time_invariant_b;
+
+    /// Receives the contributions of the natural boundary conditions to \c K
+    /// once the time-invariant matrices have been assembled, one entry per
+    /// process.
+    std::vector<std::unique_ptr<GlobalMatrix>> _time_invariant_bc_K;
+
+    /// Receives the contributions of the natural boundary conditions to \c K
+    /// in assembleResidualWithJacobian(), one entry per process.
+    std::vector<std::unique_ptr<GlobalMatrix>> _residual_bc_K;
 };
 
 }  // namespace ProcessLib
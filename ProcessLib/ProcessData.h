@@ -51,6 +51,8 @@ struct ProcessData
           nonlinear_solver(pd.nonlinear_solver),
           nonlinear_solver_converged(pd.nonlinear_solver_converged),
           conv_crit(std::move(pd.conv_crit)),
+          time_invariant_matrices(pd.time_invariant_matrices),
+          fused_newton_assembly(pd.fused_newton_assembly),
           time_disc(std::move(pd.time_disc)),
           tdisc_ode_sys(std::move(pd.tdisc_ode_sys)),
           mat_strg(pd.mat_strg),
@@ -74,6 +76,14 @@ struct ProcessData
     bool nonlinear_solver_converged;
     std::unique_ptr<NumLib::ConvergenceCriterion> conv_crit;
 
+    //! If set, the process is linear and its matrices do not change in time.
+    //! They are assembled only once then.
+    bool time_invariant_matrices = false;
+
+    //! If set, the residual and the Jacobian are assembled directly without
+    //! forming the global matrices M and K. Newton-Raphson only.
+    bool fused_newton_assembly = false;
+
     std::unique_ptr<NumLib::TimeDiscretization> time_disc;
     //! type-erased time-discretized ODE system
     std::unique_ptr<NumLib::EquationSystem> tdisc_ode_sys;
@@ -14,6 +14,7 @@
 #include "MaterialLib/SolidModels/LinearElasticIsotropic.h"
 #include "MathLib/KelvinVector.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "NumLib/Checkpoint.h"
 
 namespace ProcessLib
 {
@@ -69,6 +70,24 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
+    void writeCheckpoint(std::ostream& os) const
+    {
+        NumLib::writeCheckpointMatrix(os, sigma_eff);
+        NumLib::writeCheckpointMatrix(os, sigma_eff_prev);
+        NumLib::writeCheckpointMatrix(os, eps);
+        NumLib::writeCheckpointMatrix(os, eps_prev);
+        material_state_variables->writeCheckpoint(os);
+    }
+
+    void readCheckpoint(std::istream& is)
+    {
+        NumLib::readCheckpointMatrix(is, sigma_eff);
+        NumLib::readCheckpointMatrix(is, sigma_eff_prev);
+        NumLib::readCheckpointMatrix(is, eps);
+        NumLib::readCheckpointMatrix(is, eps_prev);
+        material_state_variables->readCheckpoint(is);
+    }
+
     template <typename DisplacementVectorType>
     typename BMatricesType::KelvinMatrixType updateConstitutiveRelation(
         double const t,
@@ -98,6 +98,22 @@ public:
         }
     }
 
+    void writeCheckpoint(std::ostream& os) const override
+    {
+        for (auto const& ip_data : _ip_data)
+        {
+            ip_data.writeCheckpoint(os);
+        }
+    }
+
+    void readCheckpoint(std::istream& is) override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.readCheckpoint(is);
+        }
+    }
+
     void computeSecondaryVariableConcrete(
         double const t, std::vector<double> const& local_x) override;
 
@@ -327,6 +327,26 @@ void RichardsMechanicsProcess<DisplacementDim>::preTimestepConcreteProcess(
             *_local_to_global_index_map, x, t, dt);
 }
 
+template <int DisplacementDim>
+void RichardsMechanicsProcess<DisplacementDim>::writeCheckpointConcreteProcess(
+    std::ostream& os) const
+{
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        local_assembler->writeCheckpoint(os);
+    }
+}
+
+template <int DisplacementDim>
+void RichardsMechanicsProcess<DisplacementDim>::readCheckpointConcreteProcess(
+    std::istream& is)
+{
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->readCheckpoint(is);
+    }
+}
+
 template <int DisplacementDim>
 void RichardsMechanicsProcess<
     DisplacementDim>::postNonLinearSolverConcreteProcess(GlobalVector const& x,
@@ -84,6 +84,10 @@ private:
                                     double const dt,
                                     const int process_id) override;
 
+    void writeCheckpointConcreteProcess(std::ostream& os) const override;
+
+    void readCheckpointConcreteProcess(std::istream& is) override;
+
     void postNonLinearSolverConcreteProcess(GlobalVector const& x,
                                             const double t,
                                             int const process_id) override;
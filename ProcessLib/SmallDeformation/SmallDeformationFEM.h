@@ -15,6 +15,7 @@
 #include "MaterialLib/PhysicalConstant.h"
 #include "MaterialLib/SolidModels/SelectSolidConstitutiveRelation.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "NumLib/Checkpoint.h"
 #include "NumLib/Extrapolation/ExtrapolatableElement.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
@@ -37,12 +38,14 @@ template <typename BMatricesType, typename ShapeMatricesType,
           int DisplacementDim>
 struct IntegrationPointData final
 {
-    explicit IntegrationPointData(
+    IntegrationPointData(
         MaterialLib::Solids::MechanicsBase<DisplacementDim> const&
-            solid_material)
+            solid_material,
+        typename ShapeMatricesType::NodalRowVectorType const& N_)
         : solid_material(solid_material),
           material_state_variables(
-              solid_material.createMaterialStateVariables())
+              solid_material.createMaterialStateVariables()),
+          N(N_)
     {
     }
 
@@ -56,7 +59,9 @@ struct IntegrationPointData final
         material_state_variables;
 
     double integration_weight;
-    typename ShapeMatricesType::NodalRowVectorType N;
+    /// Shared by all elements of the same type, see
+    /// getReferenceShapeMatrices().
+    typename ShapeMatricesType::NodalRowVectorType const& N;
     typename ShapeMatricesType::GlobalDimNodalMatrixType dNdx;
 
     void pushBackState()
@@ -66,15 +71,27 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
-    EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
-};
+    void writeCheckpoint(std::ostream& os) const
+    {
+        NumLib::writeCheckpointMatrix(os, sigma);
+        NumLib::writeCheckpointMatrix(os, sigma_prev);
+        NumLib::writeCheckpointMatrix(os, eps);
+        NumLib::writeCheckpointMatrix(os, eps_prev);
+        NumLib::writeCheckpointValue(os, free_energy_density);
+        material_state_variables->writeCheckpoint(os);
+    }
 
-/// Used by for extrapolation of the integration point values. It is ordered
-/// (and stored) by integration points.
-template <typename ShapeMatrixType>
-struct SecondaryData
-{
-    std::vector<ShapeMatrixType, Eigen::aligned_allocator<ShapeMatrixType>> N;
+    void readCheckpoint(std::istream& is)
+    {
+        NumLib::readCheckpointMatrix(is, sigma);
+        NumLib::readCheckpointMatrix(is, sigma_prev);
+        NumLib::readCheckpointMatrix(is, eps);
+        NumLib::readCheckpointMatrix(is, eps_prev);
+        NumLib::readCheckpointValue(is, free_energy_density);
+        material_state_variables->readCheckpoint(is);
+    }
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
 template <typename ShapeFunction, typename IntegrationMethod,
@@ -119,8 +136,10 @@ public:
             _integration_method.getNumberOfPoints();
 
         _ip_data.reserve(n_integration_points);
-        _secondary_data.N.resize(n_integration_points);
 
+        auto const& reference_shape_matrices =
+            getReferenceShapeMatrices<ShapeFunction, ShapeMatricesType>(
+                _integration_method);
         auto const shape_matrices =
             initShapeMatrices<ShapeFunction, ShapeMatricesType,
                               IntegrationMethod, DisplacementDim>(
@@ -134,14 +153,14 @@ public:
 
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            _ip_data.emplace_back(solid_material);
+            _ip_data.emplace_back(solid_material,
+                                  reference_shape_matrices.N[ip]);
             auto& ip_data = _ip_data[ip];
             auto const& sm = shape_matrices[ip];
             _ip_data[ip].integration_weight =
                 _integration_method.getWeightedPoint(ip).getWeight() *
                 sm.integralMeasure * sm.detJ;
 
-            ip_data.N = sm.N;
             ip_data.dNdx = sm.dNdx;
 
             static const int kelvin_vector_size =
@@ -154,8 +173,6 @@ public:
             // Previous time step values are not initialized and are set later.
             ip_data.sigma_prev.resize(kelvin_vector_size);
             ip_data.eps_prev.resize(kelvin_vector_size);
-
-            _secondary_data.N[ip] = shape_matrices[ip].N;
         }
     }
 
@@ -212,15 +229,60 @@ public:
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
+        // The constitutive relation is evaluated for all integration points
+        // of the element at once. The batch is reused by all elements
+        // assembled by the same thread.
+        thread_local typename MaterialLib::Solids::MechanicsBase<
+            DisplacementDim>::StressBatch batch;
+        thread_local std::vector<
+            typename BMatricesType::BMatrixType,
+            Eigen::aligned_allocator<typename BMatricesType::BMatrixType>>
+            Bs;
+        batch.resize(n_integration_points);
+        Bs.resize(n_integration_points);
+
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            auto const& ip_data = _ip_data[ip];
+            auto const& N = ip_data.N;
+            auto const& dNdx = ip_data.dNdx;
+
+            auto const x_coord =
+                interpolateXCoordinate<ShapeFunction, ShapeMatricesType>(
+                    _element, N);
+            auto& B = Bs[ip];
+            B = LinearBMatrix::computeBMatrix<
+                DisplacementDim, ShapeFunction::NPOINTS,
+                typename BMatricesType::BMatrixType>(dNdx, N, x_coord,
+                                                     _is_axially_symmetric);
+
+            batch.eps[ip].noalias() =
+                B *
+                Eigen::Map<typename BMatricesType::NodalForceVectorType const>(
+                    local_x.data(), ShapeFunction::NPOINTS * DisplacementDim);
+            batch.eps_prev[ip] = ip_data.eps_prev;
+            batch.sigma_prev[ip] = ip_data.sigma_prev;
+            batch.material_state_variables[ip] =
+                ip_data.material_state_variables.get();
+        }
+
+        if (!_ip_data[0].solid_material.integrateStressBatch(
+                t, _element, _process_data.dt, batch,
+                _process_data.reference_temperature))
+        {
+            OGS_FATAL("Computation of local constitutive relation failed.");
+        }
+
         SpatialPosition x_position;
         x_position.setElementID(_element.getID());
 
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
             x_position.setIntegrationPoint(ip);
-            auto const& w = _ip_data[ip].integration_weight;
-            auto const& N = _ip_data[ip].N;
-            auto const& dNdx = _ip_data[ip].dNdx;
+            auto& ip_data = _ip_data[ip];
+            auto const& w = ip_data.integration_weight;
+            auto const& N = ip_data.N;
+            auto const& B = Bs[ip];
 
             typename ShapeMatricesType::template MatrixType<DisplacementDim,
                                                             displacement_size>
@@ -234,37 +296,18 @@ public:
                         i, i * displacement_size / DisplacementDim)
                     .noalias() = N;
 
-            auto const x_coord =
-                interpolateXCoordinate<ShapeFunction, ShapeMatricesType>(
-                    _element, N);
-            auto const B = LinearBMatrix::computeBMatrix<
-                DisplacementDim, ShapeFunction::NPOINTS,
-                typename BMatricesType::BMatrixType>(dNdx, N, x_coord,
-                                                     _is_axially_symmetric);
-
-            auto const& eps_prev = _ip_data[ip].eps_prev;
-            auto const& sigma_prev = _ip_data[ip].sigma_prev;
-
-            auto& eps = _ip_data[ip].eps;
-            auto& sigma = _ip_data[ip].sigma;
-            auto& state = _ip_data[ip].material_state_variables;
-
-            eps.noalias() =
-                B *
-                Eigen::Map<typename BMatricesType::NodalForceVectorType const>(
-                    local_x.data(), ShapeFunction::NPOINTS * DisplacementDim);
+            ip_data.eps = batch.eps[ip];
+            ip_data.sigma = batch.sigma[ip];
+            // The previous state object stays in the batch and is reused for
+            // the next element.
+            std::swap(ip_data.material_state_variables,
+                      batch.material_state_variables_new[ip]);
 
-            auto&& solution = _ip_data[ip].solid_material.integrateStress(
-                t, x_position, _process_data.dt, eps_prev, eps, sigma_prev,
-                *state, _process_data.reference_temperature);
+            auto const& sigma = ip_data.sigma;
+            auto const& C = batch.C[ip];
 
-            if (!solution)
-                OGS_FATAL("Computation of local constitutive relation failed.");
-
-            MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-            std::tie(sigma, state, C) = std::move(*solution);
-
-            auto const rho = _process_data.solid_density(t, x_position)[0];
+            double rho;
+            _process_data.solid_density.getValue(t, x_position, &rho);
             auto const& b = _process_data.specific_body_force;
             local_b.noalias() -=
                 (B.transpose() * sigma - N_u_op.transpose() * rho * b) * w;
@@ -285,6 +328,22 @@ public:
         }
     }
 
+    void writeCheckpoint(std::ostream& os) const override
+    {
+        for (auto const& ip_data : _ip_data)
+        {
+            ip_data.writeCheckpoint(os);
+        }
+    }
+
+    void readCheckpoint(std::istream& is) override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.readCheckpoint(is);
+        }
+    }
+
     void postTimestepConcrete(std::vector<double> const& /*local_x*/) override
     {
         unsigned const n_integration_points =
@@ -322,7 +381,7 @@ public:
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
-        auto const& N = _secondary_data.N[integration_point];
+        auto const& N = _ip_data[integration_point].N;
 
         // assumes N is stored contiguously in memory
         return Eigen::Map<const Eigen::RowVectorXd>(N.data(), N.size());
@@ -468,7 +527,6 @@ private:
 
     IntegrationMethod _integration_method;
     MeshLib::Element const& _element;
-    SecondaryData<typename ShapeMatrices::ShapeType> _secondary_data;
     bool const _is_axially_symmetric;
 
     static const int displacement_size =
@@ -280,6 +280,26 @@ void SmallDeformationProcess<DisplacementDim>::preTimestepConcreteProcess(
         *_local_to_global_index_map, x, t, dt);
 }
 
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::writeCheckpointConcreteProcess(
+    std::ostream& os) const
+{
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        local_assembler->writeCheckpoint(os);
+    }
+}
+
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::readCheckpointConcreteProcess(
+    std::istream& is)
+{
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->readCheckpoint(is);
+    }
+}
+
 template <int DisplacementDim>
 void SmallDeformationProcess<DisplacementDim>::postTimestepConcreteProcess(
     GlobalVector const& x, const double /*t*/, const double /*delta_t*/,
@@ -95,6 +95,10 @@ private:
         GlobalVector const& x, double const t, double const dt,
         const int process_id) override;
 
+    void writeCheckpointConcreteProcess(std::ostream& os) const override;
+
+    void readCheckpointConcreteProcess(std::istream& is) override;
+
     void postTimestepConcreteProcess(GlobalVector const& x, const double t,
                                      const double delta_t,
                                      int const process_id) override;
@@ -15,6 +15,7 @@
 #include "MaterialLib/SolidModels/SelectSolidConstitutiveRelation.h"
 #include "MathLib/KelvinVector.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "NumLib/Checkpoint.h"
 #include "NumLib/Extrapolation/ExtrapolatableElement.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
@@ -72,6 +73,32 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
+    void writeCheckpoint(std::ostream& os) const
+    {
+        NumLib::writeCheckpointMatrix(os, sigma);
+        NumLib::writeCheckpointMatrix(os, sigma_prev);
+        NumLib::writeCheckpointMatrix(os, eps);
+        NumLib::writeCheckpointMatrix(os, eps_prev);
+        NumLib::writeCheckpointMatrix(os, eps_m);
+        NumLib::writeCheckpointMatrix(os, eps_m_prev);
+        NumLib::writeCheckpointValue(os, solid_density);
+        NumLib::writeCheckpointValue(os, solid_density_prev);
+        material_state_variables->writeCheckpoint(os);
+    }
+
+    void readCheckpoint(std::istream& is)
+    {
+        NumLib::readCheckpointMatrix(is, sigma);
+        NumLib::readCheckpointMatrix(is, sigma_prev);
+        NumLib::readCheckpointMatrix(is, eps);
+        NumLib::readCheckpointMatrix(is, eps_prev);
+        NumLib::readCheckpointMatrix(is, eps_m);
+        NumLib::readCheckpointMatrix(is, eps_m_prev);
+        NumLib::readCheckpointValue(is, solid_density);
+        NumLib::readCheckpointValue(is, solid_density_prev);
+        material_state_variables->readCheckpoint(is);
+    }
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
@@ -397,6 +424,22 @@ public:
         }
     }
 
+    void writeCheckpoint(std::ostream& os) const override
+    {
+        for (auto const& ip_data : _ip_data)
+        {
+            ip_data.writeCheckpoint(os);
+        }
+    }
+
+    void readCheckpoint(std::istream& is) override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.readCheckpoint(is);
+        }
+    }
+
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
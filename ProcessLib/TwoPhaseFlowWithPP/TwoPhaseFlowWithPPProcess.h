@@ -66,6 +66,12 @@ private:
         const double dxdot_dx, const double dx_dx, GlobalMatrix& M,
         GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac) override;
 
+    // The process has no history dependent data besides the solution.
+    void writeCheckpointConcreteProcess(std::ostream& /*os*/) const override
+    {
+    }
+    void readCheckpointConcreteProcess(std::istream& /*is*/) override {}
+
     TwoPhaseFlowWithPPProcessData _process_data;
 
     std::vector<std::unique_ptr<TwoPhaseFlowWithPPLocalAssemblerInterface>>
@@ -9,9 +9,22 @@
 
 #include "UncoupledProcessesTimeLoop.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+#ifdef USE_PETSC
+#include <petsc.h>
+#endif
+
 #include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+#include "BaseLib/Profiler.h"
 #include "BaseLib/RunTime.h"
 #include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/Checkpoint.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
 #include "NumLib/ODESolver/TimeDiscretizedODESystem.h"
 #include "ProcessLib/CreateProcessData.h"
@@ -58,6 +71,27 @@ static void setEquationSystem(NumLib::NonlinearSolverBase& nonlinear_solver,
     }
 }
 
+namespace
+{
+//! Identifies checkpoint files and their format version.
+char const checkpoint_magic[8] = {'O', 'G', 'S', 'C', 'K', 'P', 'T', '1'};
+
+//! With MPI each rank writes and reads its own checkpoint file, whose name is
+//! the given one with the rank inserted before the extension.
+std::string checkpointFileNameOfThisRank(std::string const& file_name)
+{
+#ifdef USE_PETSC
+    int rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    auto const extension = BaseLib::getFileExtension(file_name);
+    return BaseLib::dropFileExtension(file_name) + "_" +
+           std::to_string(rank) + (extension.empty() ? "" : "." + extension);
+#else
+    return file_name;
+#endif
+}
+}  // namespace
+
 namespace ProcessLib
 {
 template <NumLib::ODESystemTag ODETag>
@@ -77,9 +111,12 @@ void setTimeDiscretizedODESystem(
         // because the Newton ODESystem derives from the Picard ODESystem.
         // So no further checks are needed here.
 
-        process_data.tdisc_ode_sys = std::make_unique<
+        auto tdisc_ode_sys = std::make_unique<
             NumLib::TimeDiscretizedODESystem<ODETag, Tag::Picard>>(
             process_data.process_id, ode_sys, *process_data.time_disc);
+        tdisc_ode_sys->setTimeInvariantMatrices(
+            process_data.time_invariant_matrices);
+        process_data.tdisc_ode_sys = std::move(tdisc_ode_sys);
     }
     else if (dynamic_cast<NonlinearSolverNewton*>(
                  &process_data.nonlinear_solver))
@@ -89,9 +126,12 @@ void setTimeDiscretizedODESystem(
         using ODENewton = NumLib::ODESystem<ODETag, Tag::Newton>;
         if (auto* ode_newton = dynamic_cast<ODENewton*>(&ode_sys))
         {
-            process_data.tdisc_ode_sys = std::make_unique<
+            auto tdisc_ode_sys = std::make_unique<
                 NumLib::TimeDiscretizedODESystem<ODETag, Tag::Newton>>(
                 process_data.process_id, *ode_newton, *process_data.time_disc);
+            tdisc_ode_sys->setFusedAssembly(
+                process_data.fused_newton_assembly);
+            process_data.tdisc_ode_sys = std::move(tdisc_ode_sys);
         }
         else
         {
@@ -169,6 +209,26 @@ std::unique_ptr<UncoupledProcessesTimeLoop> createUncoupledProcessesTimeLoop(
         }
     }
 
+    unsigned checkpoint_each_steps = 0;
+    std::string checkpoint_file_name;
+    //! \ogs_file_param{prj__time_loop__checkpoint}
+    if (auto const checkpoint_config = config.getConfigSubtreeOptional(
+            "checkpoint"))
+    {
+        checkpoint_each_steps =
+            //! \ogs_file_param{prj__time_loop__checkpoint__each_steps}
+            checkpoint_config->getConfigParameter<unsigned>("each_steps");
+        if (checkpoint_each_steps == 0)
+        {
+            OGS_FATAL("The checkpoint interval each_steps must be positive.");
+        }
+        checkpoint_file_name = BaseLib::joinPaths(
+            output_directory,
+            //! \ogs_file_param{prj__time_loop__checkpoint__prefix}
+            checkpoint_config->getConfigParameter<std::string>("prefix") +
+                ".checkpoint");
+    }
+
     const auto minmax_iter = std::minmax_element(
         per_process_data.begin(),
         per_process_data.end(),
@@ -185,7 +245,26 @@ std::unique_ptr<UncoupledProcessesTimeLoop> createUncoupledProcessesTimeLoop(
 
     return std::make_unique<UncoupledProcessesTimeLoop>(
         std::move(output), std::move(per_process_data), max_coupling_iterations,
-        std::move(global_coupling_conv_criteria), start_time, end_time);
+        std::move(global_coupling_conv_criteria), start_time, end_time,
+        checkpoint_each_steps, std::move(checkpoint_file_name));
+}
+
+//! Performs the additional assembly needed by time discretization schemes
+//! like CrankNicolson before the first time step is solved.
+void preloadTimeDiscretization(ProcessData& process_data, double const t,
+                               GlobalVector const& x)
+{
+    auto& time_disc = *process_data.time_disc;
+    auto& ode_sys = *process_data.tdisc_ode_sys;
+    auto& nonlinear_solver = process_data.nonlinear_solver;
+    auto& mat_strg = *process_data.mat_strg;
+    auto& conv_crit = *process_data.conv_crit;
+
+    setEquationSystem(nonlinear_solver, ode_sys, conv_crit,
+                      process_data.nonlinear_solver_tag);
+    nonlinear_solver.assemble(x);
+    time_disc.pushState(t, x,
+                        mat_strg);  // TODO: that might do duplicate work
 }
 
 std::vector<GlobalVector*> setInitialConditions(
@@ -201,7 +280,6 @@ std::vector<GlobalVector*> setInitialConditions(
         auto& time_disc = *process_data->time_disc;
 
         auto& ode_sys = *process_data->tdisc_ode_sys;
-        auto const nl_tag = process_data->nonlinear_solver_tag;
 
         // append a solution vector of suitable size
         process_solutions.emplace_back(
@@ -216,15 +294,7 @@ std::vector<GlobalVector*> setInitialConditions(
 
         if (time_disc.needsPreload())
         {
-            auto& nonlinear_solver = process_data->nonlinear_solver;
-            auto& mat_strg = *process_data->mat_strg;
-            auto& conv_crit = *process_data->conv_crit;
-
-            setEquationSystem(nonlinear_solver, ode_sys, conv_crit, nl_tag);
-            nonlinear_solver.assemble(x0);
-            time_disc.pushState(
-                t0, x0,
-                mat_strg);  // TODO: that might do duplicate work
+            preloadTimeDiscretization(*process_data, t0, x0);
         }
 
         ++process_id;
@@ -279,14 +349,26 @@ UncoupledProcessesTimeLoop::UncoupledProcessesTimeLoop(
     const unsigned global_coupling_max_iterations,
     std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
         global_coupling_conv_crit,
-    const double start_time, const double end_time)
+    const double start_time, const double end_time,
+    unsigned const checkpoint_each_steps, std::string checkpoint_file_name)
     : _output(std::move(output)),
       _per_process_data(std::move(per_process_data)),
       _start_time(start_time),
       _end_time(end_time),
       _global_coupling_max_iterations(global_coupling_max_iterations),
-      _global_coupling_conv_crit(std::move(global_coupling_conv_crit))
+      _global_coupling_conv_crit(std::move(global_coupling_conv_crit)),
+      _checkpoint_each_steps(checkpoint_each_steps),
+      _checkpoint_file_name(std::move(checkpoint_file_name))
+{
+    if (_checkpoint_each_steps > 0)
+    {
+        _checkpoint_writer = std::make_unique<BaseLib::AsyncTaskQueue>(1);
+    }
+}
+
+void UncoupledProcessesTimeLoop::setRestartFile(std::string restart_file_name)
 {
+    _restart_file_name = std::move(restart_file_name);
 }
 
 bool UncoupledProcessesTimeLoop::setCoupledSolutions()
@@ -308,7 +390,6 @@ bool UncoupledProcessesTimeLoop::setCoupledSolutions()
 
         // Create a vector to store the solution of the last coupling iteration
         auto& x0 = NumLib::GlobalVectorProvider::provider.getVector(x);
-        MathLib::LinAlg::copy(x, x0);
 
         // append a solution vector of suitable size
         _solutions_of_last_cpl_iteration.emplace_back(&x0);
@@ -321,6 +402,7 @@ double UncoupledProcessesTimeLoop::computeTimeStepping(
     const double prev_dt, double& t, std::size_t& accepted_steps,
     std::size_t& rejected_steps)
 {
+    BaseLib::ProfilingScope const profiling_scope("time_step_control");
     bool all_process_steps_accepted = true;
     // Get minimum time step size among step sizes of all processes.
     double dt = std::numeric_limits<double>::max();
@@ -512,21 +594,32 @@ bool UncoupledProcessesTimeLoop::loop()
     // init solution storage
     _process_solutions = setInitialConditions(_start_time, _per_process_data);
 
-    const bool is_staggered_coupling = setCoupledSolutions();
-
-    // Output initial conditions
-    {
-        const bool output_initial_condition = true;
-        outputSolutions(output_initial_condition, is_staggered_coupling, 0,
-                        _start_time, *_output, &Output::doOutput);
-    }
-
     double t = _start_time;
+    double dt = 0;
     std::size_t accepted_steps = 0;
     std::size_t rejected_steps = 0;
     bool nonlinear_solver_succeeded = true;
 
-    double dt = computeTimeStepping(0.0, t, accepted_steps, rejected_steps);
+    bool const is_restart = !_restart_file_name.empty();
+    if (is_restart)
+    {
+        readCheckpoint(t, dt, accepted_steps, rejected_steps);
+        _output->continueExistingOutput(t);
+    }
+
+    const bool is_staggered_coupling = setCoupledSolutions();
+
+    if (!is_restart)
+    {
+        // Output initial conditions
+        {
+            const bool output_initial_condition = true;
+            outputSolutions(output_initial_condition, is_staggered_coupling, 0,
+                            _start_time, *_output, &Output::doOutput);
+        }
+
+        dt = computeTimeStepping(0.0, t, accepted_steps, rejected_steps);
+    }
 
     while (t < _end_time)
     {
@@ -537,6 +630,8 @@ bool UncoupledProcessesTimeLoop::loop()
         const double prev_dt = dt;
 
         const std::size_t timesteps = accepted_steps + 1;
+        BaseLib::Profiler::instance().setTimeStep(timesteps);
+        BaseLib::ProfilingScope const profiling_scope("time_step");
         // TODO(wenqing): , input option for time unit.
         INFO("=== Time stepping at step #%u and time %g with step size %g",
              timesteps, t, dt);
@@ -556,12 +651,22 @@ bool UncoupledProcessesTimeLoop::loop()
              time_timestep.elapsed());
 
         dt = computeTimeStepping(prev_dt, t, accepted_steps, rejected_steps);
+        if (_last_step_rejected)
+        {
+            BaseLib::Profiler::instance().addToCounter("rejected", 1);
+        }
 
         if (!_last_step_rejected)
         {
             const bool output_initial_condition = false;
             outputSolutions(output_initial_condition, is_staggered_coupling,
                             timesteps, t, *_output, &Output::doOutput);
+
+            if (_checkpoint_each_steps > 0 &&
+                accepted_steps % _checkpoint_each_steps == 0)
+            {
+                writeCheckpoint(t, dt, accepted_steps, rejected_steps);
+            }
         }
 
         if (t + dt > _end_time ||
@@ -597,6 +702,8 @@ bool UncoupledProcessesTimeLoop::loop()
             const bool output_initial_condition = false;
             outputSolutions(output_initial_condition, is_staggered_coupling,
                             timesteps, t, *_output, &Output::doOutputAlways);
+            _output->waitForPendingOutput();
+            waitForPendingCheckpoint();
             return false;
         }
     }
@@ -614,10 +721,161 @@ bool UncoupledProcessesTimeLoop::loop()
                         accepted_steps + rejected_steps, t, *_output,
                         &Output::doOutputLastTimestep);
     }
+    _output->waitForPendingOutput();
+    waitForPendingCheckpoint();
 
     return nonlinear_solver_succeeded;
 }
 
+void UncoupledProcessesTimeLoop::waitForPendingCheckpoint()
+{
+    if (_pending_checkpoint.valid())
+    {
+        _pending_checkpoint.get();
+    }
+}
+
+void UncoupledProcessesTimeLoop::writeCheckpoint(
+    double const t, double const dt, std::size_t const accepted_steps,
+    std::size_t const rejected_steps)
+{
+    BaseLib::ProfilingScope const profiling_scope("checkpoint");
+
+    // At most one checkpoint is kept in memory besides the one being written.
+    // Errors of the previous write are rethrown here.
+    waitForPendingCheckpoint();
+
+    std::ostringstream os(std::ios::out | std::ios::binary);
+    os.write(checkpoint_magic, sizeof(checkpoint_magic));
+    NumLib::writeCheckpointValue(os, t);
+    NumLib::writeCheckpointValue(os, dt);
+    NumLib::writeCheckpointValue(os, accepted_steps);
+    NumLib::writeCheckpointValue(os, rejected_steps);
+    NumLib::writeCheckpointValue(os, _per_process_data.size());
+
+    for (std::size_t i = 0; i < _per_process_data.size(); i++)
+    {
+        auto const& ppd = *_per_process_data[i];
+        NumLib::writeCheckpointValue(os, ppd.skip_time_stepping);
+        NumLib::writeCheckpointVector(os, *_process_solutions[i]);
+        ppd.time_disc->writeCheckpoint(os);
+        ppd.timestepper->writeCheckpoint(os);
+    }
+
+    // With the staggered scheme several process data share one process.
+    std::set<Process const*> written_processes;
+    for (auto const& ppd : _per_process_data)
+    {
+        if (written_processes.insert(&ppd->process).second)
+        {
+            ppd->process.writeCheckpoint(os);
+        }
+    }
+
+    if (!os)
+    {
+        OGS_FATAL("Could not serialize the checkpoint of time step %zu.",
+                  accepted_steps);
+    }
+
+    // The file is written to a temporary file first, s.t. the previous
+    // checkpoint stays intact if the program is aborted while writing.
+    auto const file_name = checkpointFileNameOfThisRank(_checkpoint_file_name);
+    auto const data = std::make_shared<std::string>(os.str());
+    _pending_checkpoint = _checkpoint_writer->push([file_name, data, t]() {
+        auto const tmp_file_name = file_name + ".tmp";
+        {
+            std::ofstream file(tmp_file_name, std::ios::binary);
+            file.write(data->data(), data->size());
+            if (!file)
+            {
+                OGS_FATAL("Could not write the checkpoint file `%s'.",
+                          tmp_file_name.c_str());
+            }
+        }
+        if (std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0)
+        {
+            OGS_FATAL("Could not rename `%s' to `%s'.", tmp_file_name.c_str(),
+                      file_name.c_str());
+        }
+        INFO("Wrote checkpoint `%s' at time %g.", file_name.c_str(), t);
+    });
+}
+
+void UncoupledProcessesTimeLoop::readCheckpoint(double& t, double& dt,
+                                                std::size_t& accepted_steps,
+                                                std::size_t& rejected_steps)
+{
+    auto const file_name = checkpointFileNameOfThisRank(_restart_file_name);
+    std::ifstream is(file_name, std::ios::binary);
+    if (!is)
+    {
+        OGS_FATAL("Could not open the checkpoint file `%s'.",
+                  file_name.c_str());
+    }
+
+    char magic[sizeof(checkpoint_magic)];
+    if (!is.read(magic, sizeof(magic)) ||
+        !std::equal(std::begin(magic), std::end(magic),
+                    std::begin(checkpoint_magic)))
+    {
+        OGS_FATAL("`%s' is not a checkpoint file of this version of OGS.",
+                  file_name.c_str());
+    }
+
+    NumLib::readCheckpointValue(is, t);
+    NumLib::readCheckpointValue(is, dt);
+    NumLib::readCheckpointValue(is, accepted_steps);
+    NumLib::readCheckpointValue(is, rejected_steps);
+
+    std::size_t number_of_processes;
+    NumLib::readCheckpointValue(is, number_of_processes);
+    if (number_of_processes != _per_process_data.size())
+    {
+        OGS_FATAL(
+            "The checkpoint `%s' contains %zu processes, but %zu processes are "
+            "configured.",
+            file_name.c_str(), number_of_processes, _per_process_data.size());
+    }
+
+    for (std::size_t i = 0; i < _per_process_data.size(); i++)
+    {
+        auto& ppd = *_per_process_data[i];
+        auto& x = *_process_solutions[i];
+        NumLib::readCheckpointValue(is, ppd.skip_time_stepping);
+        NumLib::readCheckpointVector(is, x);
+        ppd.time_disc->readCheckpoint(is);
+        ppd.timestepper->readCheckpoint(is);
+
+        // The preload assembly changes the state of the processes, which is
+        // therefore restored afterwards.
+        if (ppd.time_disc->needsPreload())
+        {
+            preloadTimeDiscretization(ppd, ppd.time_disc->getCurrentTime(), x);
+        }
+    }
+
+    std::set<Process*> read_processes;
+    for (auto& ppd : _per_process_data)
+    {
+        if (read_processes.insert(&ppd->process).second)
+        {
+            ppd->process.readCheckpoint(is);
+        }
+    }
+
+    if (is.peek() != std::ifstream::traits_type::eof())
+    {
+        OGS_FATAL(
+            "The checkpoint `%s' contains more data than expected. Restarts "
+            "are only possible with the same project file.",
+            file_name.c_str());
+    }
+
+    INFO("Restarting from checkpoint `%s' at time step #%zu and time %g.",
+         file_name.c_str(), accepted_steps, t);
+}
+
 static std::string const nonlinear_fixed_dt_fails_info =
     "Nonlinear solver fails. Because the time stepper"
     " FixedTimeStepping is used, the program has to be"
@@ -639,6 +897,8 @@ bool UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
 
         BaseLib::RunTime time_timestep_process;
         time_timestep_process.start();
+        BaseLib::ProfilingScope const profiling_scope(
+            "process_" + std::to_string(process_id));
 
         auto& x = *_process_solutions[process_id];
         auto& pcs = process_data->process;
@@ -665,6 +925,7 @@ bool UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
                 _output->doOutputAlways(pcs, process_id,
                                         process_data->process_output,
                                         timestep_id, t, x);
+                _output->waitForPendingOutput();
                 OGS_FATAL(nonlinear_fixed_dt_fails_info.data());
             }
 
@@ -717,6 +978,8 @@ bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
 
             BaseLib::RunTime time_timestep_process;
             time_timestep_process.start();
+            BaseLib::ProfilingScope const profiling_scope(
+                "process_" + std::to_string(process_id));
 
             auto& x = *_process_solutions[process_id];
             if (global_coupling_iteration == 0)
@@ -759,6 +1022,7 @@ bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                     _output->doOutputAlways(process_data->process, process_id,
                                             process_data->process_output,
                                             timestep_id, t, x);
+                    _output->waitForPendingOutput();
                     OGS_FATAL(nonlinear_fixed_dt_fails_info.data());
                 }
                 break;
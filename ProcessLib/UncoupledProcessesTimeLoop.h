@@ -11,9 +11,12 @@
 
 #include <memory>
 #include <functional>
+#include <future>
+#include <string>
 
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/AsyncTaskQueue.h"
 #include "NumLib/ODESolver/NonlinearSolver.h"
 #include "NumLib/TimeStepping/Algorithms/TimeStepAlgorithm.h"
 #include "ProcessLib/Output/Output.h"
@@ -41,7 +44,14 @@ public:
         const unsigned global_coupling_max_iterations,
         std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
             global_coupling_conv_crit,
-        const double start_time, const double end_time);
+        const double start_time, const double end_time,
+        unsigned const checkpoint_each_steps = 0,
+        std::string checkpoint_file_name = "");
+
+    /// Continues the simulation from the given checkpoint file instead of
+    /// starting from the initial conditions. The results are appended to the
+    /// existing PVD files. Must be called before loop().
+    void setRestartFile(std::string restart_file_name);
 
     bool loop();
 
@@ -87,6 +97,15 @@ private:
     /// criteria of the coupling iteration.
     std::vector<GlobalVector*> _solutions_of_last_cpl_iteration;
 
+    /// A checkpoint is written every \c _checkpoint_each_steps accepted time
+    /// steps. Zero disables checkpoints.
+    unsigned const _checkpoint_each_steps;
+    std::string const _checkpoint_file_name;
+    std::string _restart_file_name;
+
+    /// Result of the checkpoint being written in the background.
+    std::future<void> _pending_checkpoint;
+
     /**
      * \brief Member to solver non coupled systems of equations, which can be
      *        a single system of equations, or several systems of equations
@@ -129,11 +148,38 @@ private:
                                std::size_t& accepted_steps,
                                std::size_t& rejected_steps);
 
+    /**
+     * Serializes the state of the time loop, of the time discretizations, of
+     * the time steppers and of the processes and queues writing it to the
+     * checkpoint file. Only the serialization blocks the time loop.
+     *
+     * @param t              Time of the last accepted time step.
+     * @param dt             Size of the next time step.
+     * @param accepted_steps Number of accepted time steps.
+     * @param rejected_steps Number of rejected time steps.
+     */
+    void writeCheckpoint(double const t, double const dt,
+                         std::size_t const accepted_steps,
+                         std::size_t const rejected_steps);
+
+    /// Blocks until the checkpoint being written in the background is finished.
+    /// Errors which occurred during writing are rethrown.
+    void waitForPendingCheckpoint();
+
+    /// Restores the state written by writeCheckpoint() from the restart file.
+    /// \see writeCheckpoint() for the parameters.
+    void readCheckpoint(double& t, double& dt, std::size_t& accepted_steps,
+                        std::size_t& rejected_steps);
+
     template <typename OutputClass, typename OutputClassMember>
     void outputSolutions(bool const output_initial_condition,
                          bool const is_staggered_coupling, unsigned timestep,
                          const double t, OutputClass& output_object,
                          OutputClassMember output_class_member) const;
+
+    /// Writes the checkpoints in the background. Declared last, s.t. the
+    /// pending writes are finished before the other members are destroyed.
+    std::unique_ptr<BaseLib::AsyncTaskQueue> _checkpoint_writer;
 };
 
 //! Builds an UncoupledProcessesTimeLoop from the given configuration.
@@ -8,12 +8,15 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 #include <vector>
 
 #include "MeshLib/Elements/Element.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 
-
 namespace ProcessLib
 {
 template <typename ShapeFunction, typename ShapeMatricesType,
@@ -47,6 +50,90 @@ initShapeMatrices(MeshLib::Element const& e, bool is_axially_symmetric,
     return shape_matrices;
 }
 
+/// The shape functions and their derivatives with respect to the natural
+/// coordinates at the integration points of the reference element. Other than
+/// the ShapeMatrices these do not depend on the element's geometry.
+template <typename ShapeMatricesType>
+struct ReferenceShapeMatrices
+{
+    std::vector<typename ShapeMatricesType::NodalRowVectorType,
+                Eigen::aligned_allocator<
+                    typename ShapeMatricesType::NodalRowVectorType>>
+        N;
+    std::vector<typename ShapeMatricesType::DimNodalMatrixType,
+                Eigen::aligned_allocator<
+                    typename ShapeMatricesType::DimNodalMatrixType>>
+        dNdr;
+};
+
+namespace detail
+{
+template <typename ShapeFunction, typename DimNodalMatrixType>
+void computeReferenceGradShapeFunction(double const* const natural_pt,
+                                       DimNodalMatrixType& dNdr,
+                                       std::true_type /*has_derivatives*/)
+{
+    double* const dNdr_data = dNdr.data();
+    ShapeFunction::computeGradShapeFunction(natural_pt, dNdr_data);
+}
+
+template <typename ShapeFunction, typename DimNodalMatrixType>
+void computeReferenceGradShapeFunction(double const* const /*natural_pt*/,
+                                       DimNodalMatrixType& /*dNdr*/,
+                                       std::false_type /*has_derivatives*/)
+{
+}
+}  // namespace detail
+
+/// Returns the shape functions and their derivatives at the integration points
+/// of the reference element.
+///
+/// They are computed once for each combination of shape function, shape
+/// matrix types and integration order and are shared by all elements, local
+/// assemblers and processes. The returned reference is valid until the end of
+/// the program. The function is thread-safe.
+template <typename ShapeFunction, typename ShapeMatricesType,
+          typename IntegrationMethod>
+ReferenceShapeMatrices<ShapeMatricesType> const& getReferenceShapeMatrices(
+    IntegrationMethod const& integration_method)
+{
+    static std::mutex mutex;
+    static std::map<unsigned,
+                    std::unique_ptr<ReferenceShapeMatrices<ShapeMatricesType>>>
+        cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& shape_matrices = cache[integration_method.getIntegrationOrder()];
+    if (shape_matrices)
+    {
+        return *shape_matrices;
+    }
+
+    shape_matrices =
+        std::make_unique<ReferenceShapeMatrices<ShapeMatricesType>>();
+    unsigned const n_integration_points = integration_method.getNumberOfPoints();
+    shape_matrices->N.reserve(n_integration_points);
+    shape_matrices->dNdr.reserve(n_integration_points);
+    for (unsigned ip = 0; ip < n_integration_points; ++ip)
+    {
+        auto const weighted_point = integration_method.getWeightedPoint(ip);
+        auto const* const natural_pt = weighted_point.getCoords();
+
+        shape_matrices->N.emplace_back(ShapeFunction::NPOINTS);
+        ShapeFunction::computeShapeFunction(natural_pt,
+                                            shape_matrices->N.back());
+
+        shape_matrices->dNdr.emplace_back(ShapeFunction::DIM,
+                                          ShapeFunction::NPOINTS);
+        shape_matrices->dNdr.back().setZero();
+        detail::computeReferenceGradShapeFunction<ShapeFunction>(
+            natural_pt, shape_matrices->dNdr.back(),
+            std::integral_constant<bool, (ShapeFunction::DIM > 0)>{});
+    }
+
+    return *shape_matrices;
+}
+
 template <typename ShapeFunction, typename ShapeMatricesType>
 double interpolateXCoordinate(
     MeshLib::Element const& e,
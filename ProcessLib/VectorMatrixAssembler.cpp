@@ -19,6 +19,58 @@
 #include "CoupledSolutionsForStaggeredScheme.h"
 #include "Process.h"
 
+namespace
+{
+// Temporary data only stored here in order to avoid frequent memory
+// reallocations. The storage is thread local because the assembly methods may
+// be executed concurrently by the GlobalExecutor.
+thread_local std::vector<double> local_M_data;
+thread_local std::vector<double> local_K_data;
+thread_local std::vector<double> local_b_data;
+thread_local std::vector<double> local_Jac_data;
+thread_local std::vector<double> local_x;
+thread_local std::vector<double> local_xdot;
+thread_local std::vector<std::vector<GlobalIndexType>> indices_of_processes;
+
+//! Fills \c indices_of_processes with the indices of the given mesh item for
+//! each of the \c dof_tables. The inner vectors are reused.
+void getIndicesOfProcesses(
+    std::size_t const mesh_item_id,
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const&
+        dof_tables,
+    std::vector<std::vector<GlobalIndexType>>& indices_of_processes)
+{
+    indices_of_processes.resize(dof_tables.size());
+    for (std::size_t i = 0; i < dof_tables.size(); i++)
+    {
+        NumLib::getIndices(mesh_item_id, dof_tables[i].get(),
+                           indices_of_processes[i]);
+    }
+}
+
+//! Replaces the local \c b by \f$ b - M \cdot \dot x - K \cdot x \f$ and
+//! clears the local \c M and \c K afterwards.
+void formNegativeLocalResidual(std::size_t const num_r_c)
+{
+    // Zero-initialized if nothing has been assembled.
+    local_b_data.resize(num_r_c);
+    auto local_b = MathLib::toVector(local_b_data);
+
+    if (!local_M_data.empty())
+    {
+        auto const local_M = MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+        local_b.noalias() -= local_M * MathLib::toVector(local_xdot);
+        local_M_data.clear();
+    }
+    if (!local_K_data.empty())
+    {
+        auto const local_K = MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+        local_b.noalias() -= local_K * MathLib::toVector(local_x);
+        local_K_data.clear();
+    }
+}
+}  // namespace
+
 namespace ProcessLib
 {
 VectorMatrixAssembler::VectorMatrixAssembler(
@@ -32,10 +84,23 @@ void VectorMatrixAssembler::preAssemble(
     const NumLib::LocalToGlobalIndexMap& dof_table, const double t,
     const GlobalVector& x)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
-    auto const local_x = x.get(indices);
+    auto const pre_assemble = [&]() {
+        indices_of_processes.resize(1);
+        auto& indices = indices_of_processes[0];
+        NumLib::getIndices(mesh_item_id, dof_table, indices);
+        x.get(indices, local_x);
+
+        local_assembler.preAssemble(t, local_x);
+    };
 
-    local_assembler.preAssemble(t, local_x);
+    if (_concurrent_local_assembly)
+    {
+        pre_assemble();
+    }
+    else
+    {
+        GlobalExecutor::executeOrdered(pre_assemble);
+    }
 }
 
 void VectorMatrixAssembler::assemble(
@@ -45,61 +110,77 @@ void VectorMatrixAssembler::assemble(
     const double t, const GlobalVector& x, GlobalMatrix& M, GlobalMatrix& K,
     GlobalVector& b, CoupledSolutionsForStaggeredScheme const* const cpl_xs)
 {
-    std::vector<std::vector<GlobalIndexType>> indices_of_processes;
-    indices_of_processes.reserve(dof_tables.size());
-    for (std::size_t i = 0; i < dof_tables.size(); i++)
-    {
-        indices_of_processes.emplace_back(
-            NumLib::getIndices(mesh_item_id, dof_tables[i].get()));
-    }
+    getIndicesOfProcesses(mesh_item_id, dof_tables, indices_of_processes);
 
     auto const& indices = (cpl_xs == nullptr)
                               ? indices_of_processes[0]
                               : indices_of_processes[cpl_xs->process_id];
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
 
-    if (cpl_xs == nullptr)
-    {
-        auto const local_x = x.get(indices);
-        local_assembler.assemble(t, local_x, _local_M_data, _local_K_data,
-                                 _local_b_data);
-    }
-    else
-    {
-        auto local_coupled_xs0 =
-            getPreviousLocalSolutions(*cpl_xs, indices_of_processes);
-        auto local_coupled_xs =
-            getCurrentLocalSolutions(*cpl_xs, indices_of_processes);
-
-        ProcessLib::LocalCoupledSolutions local_coupled_solutions(
-            cpl_xs->dt, cpl_xs->process_id, std::move(local_coupled_xs0),
-            std::move(local_coupled_xs));
-
-        local_assembler.assembleForStaggeredScheme(t, _local_M_data,
-                                                   _local_K_data, _local_b_data,
-                                                   local_coupled_solutions);
-    }
+    auto const assemble_local = [&]() {
+        local_M_data.clear();
+        local_K_data.clear();
+        local_b_data.clear();
+
+        if (cpl_xs == nullptr)
+        {
+            x.get(indices, local_x);
+            local_assembler.assemble(t, local_x, local_M_data, local_K_data,
+                                     local_b_data);
+        }
+        else
+        {
+            auto local_coupled_xs0 =
+                getPreviousLocalSolutions(*cpl_xs, indices_of_processes);
+            auto local_coupled_xs =
+                getCurrentLocalSolutions(*cpl_xs, indices_of_processes);
+
+            ProcessLib::LocalCoupledSolutions local_coupled_solutions(
+                cpl_xs->dt, cpl_xs->process_id, std::move(local_coupled_xs0),
+                std::move(local_coupled_xs));
+
+            local_assembler.assembleForStaggeredScheme(
+                t, local_M_data, local_K_data, local_b_data,
+                local_coupled_solutions);
+        }
+    };
 
     auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
-    {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
-    }
-    if (!_local_K_data.empty())
+    auto const add_to_global = [&]() {
+        if (!local_M_data.empty())
+        {
+            auto const local_M =
+                MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+            M.add(mesh_item_id, r_c_indices, local_M);
+        }
+        if (!local_K_data.empty())
+        {
+            auto const local_K =
+                MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+            K.add(mesh_item_id, r_c_indices, local_K);
+        }
+        if (!local_b_data.empty())
+        {
+            assert(local_b_data.size() == num_r_c);
+            b.add(indices, local_b_data);
+        }
+    };
+
+    if (_concurrent_local_assembly)
     {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
+        assemble_local();
+        GlobalExecutor::executeOrdered(add_to_global);
     }
-    if (!_local_b_data.empty())
+    else
     {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+        // Only one ordered section is allowed per mesh item, therefore the
+        // local assembly is done within the same section.
+        GlobalExecutor::executeOrdered([&]() {
+            assemble_local();
+            add_to_global();
+        });
     }
 }
 
@@ -112,78 +193,99 @@ void VectorMatrixAssembler::assembleWithJacobian(
     GlobalVector& b, GlobalMatrix& Jac,
     CoupledSolutionsForStaggeredScheme const* const cpl_xs)
 {
-    std::vector<std::vector<GlobalIndexType>> indices_of_processes;
-    indices_of_processes.reserve(dof_tables.size());
-    for (std::size_t i = 0; i < dof_tables.size(); i++)
-    {
-        indices_of_processes.emplace_back(
-            NumLib::getIndices(mesh_item_id, dof_tables[i].get()));
-    }
+    getIndicesOfProcesses(mesh_item_id, dof_tables, indices_of_processes);
 
     auto const& indices = (cpl_xs == nullptr)
                               ? indices_of_processes[0]
                               : indices_of_processes[cpl_xs->process_id];
-    auto const local_xdot = xdot.get(indices);
+    xdot.get(indices, local_xdot);
 
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
-    _local_Jac_data.clear();
+    auto const assemble_local = [&]() {
+        local_M_data.clear();
+        local_K_data.clear();
+        local_b_data.clear();
+        local_Jac_data.clear();
 
-    if (cpl_xs == nullptr)
-    {
-        auto const local_x = x.get(indices);
-        _jacobian_assembler->assembleWithJacobian(
-            local_assembler, t, local_x, local_xdot, dxdot_dx, dx_dx,
-            _local_M_data, _local_K_data, _local_b_data, _local_Jac_data);
-    }
-    else
-    {
-        auto local_coupled_xs0 =
-            getPreviousLocalSolutions(*cpl_xs, indices_of_processes);
-        auto local_coupled_xs =
-            getCurrentLocalSolutions(*cpl_xs, indices_of_processes);
-
-        ProcessLib::LocalCoupledSolutions local_coupled_solutions(
-            cpl_xs->dt, cpl_xs->process_id, std::move(local_coupled_xs0),
-            std::move(local_coupled_xs));
-
-        _jacobian_assembler->assembleWithJacobianForStaggeredScheme(
-            local_assembler, t, local_xdot, dxdot_dx, dx_dx, _local_M_data,
-            _local_K_data, _local_b_data, _local_Jac_data,
-            local_coupled_solutions);
-    }
+        if (cpl_xs == nullptr)
+        {
+            x.get(indices, local_x);
+            _jacobian_assembler->assembleWithJacobian(
+                local_assembler, t, local_x, local_xdot, dxdot_dx, dx_dx,
+                local_M_data, local_K_data, local_b_data, local_Jac_data);
+        }
+        else
+        {
+            auto local_coupled_xs0 =
+                getPreviousLocalSolutions(*cpl_xs, indices_of_processes);
+            auto local_coupled_xs =
+                getCurrentLocalSolutions(*cpl_xs, indices_of_processes);
+
+            ProcessLib::LocalCoupledSolutions local_coupled_solutions(
+                cpl_xs->dt, cpl_xs->process_id, std::move(local_coupled_xs0),
+                std::move(local_coupled_xs));
+
+            _jacobian_assembler->assembleWithJacobianForStaggeredScheme(
+                local_assembler, t, local_xdot, dxdot_dx, dx_dx, local_M_data,
+                local_K_data, local_b_data, local_Jac_data,
+                local_coupled_solutions);
+        }
+
+        if (local_Jac_data.empty())
+        {
+            OGS_FATAL(
+                "No Jacobian has been assembled! This might be due to "
+                "programming errors in the local assembler of the current "
+                "process.");
+        }
+
+        if (_assemble_residual)
+        {
+            if (cpl_xs != nullptr)
+                x.get(indices, local_x);
+            formNegativeLocalResidual(indices.size());
+        }
+    };
 
     auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
-    {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
-    }
-    if (!_local_K_data.empty())
-    {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
-    }
-    if (!_local_b_data.empty())
-    {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
-    }
-    if (!_local_Jac_data.empty())
-    {
+    auto const add_to_global = [&]() {
+        if (!local_M_data.empty())
+        {
+            auto const local_M =
+                MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+            M.add(mesh_item_id, r_c_indices, local_M);
+        }
+        if (!local_K_data.empty())
+        {
+            auto const local_K =
+                MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+            K.add(mesh_item_id, r_c_indices, local_K);
+        }
+        if (!local_b_data.empty())
+        {
+            assert(local_b_data.size() == num_r_c);
+            b.add(indices, local_b_data);
+        }
         auto const local_Jac =
-            MathLib::toMatrix(_local_Jac_data, num_r_c, num_r_c);
-        Jac.add(r_c_indices, local_Jac);
+            MathLib::toMatrix(local_Jac_data, num_r_c, num_r_c);
+        Jac.add(mesh_item_id, r_c_indices, local_Jac);
+    };
+
+    if (_concurrent_local_assembly && _jacobian_assembler->isThreadSafe())
+    {
+        assemble_local();
+        GlobalExecutor::executeOrdered(add_to_global);
     }
     else
     {
-        OGS_FATAL(
-            "No Jacobian has been assembled! This might be due to programming "
-            "errors in the local assembler of the current process.");
+        // Only one ordered section is allowed per mesh item, therefore the
+        // local assembly is done within the same section.
+        GlobalExecutor::executeOrdered([&]() {
+            assemble_local();
+            add_to_global();
+        });
     }
 }
 
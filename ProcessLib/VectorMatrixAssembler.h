@@ -29,6 +29,11 @@ class LocalAssemblerInterface;
 //!
 //! The methods of this class get the global matrices and vectors as input and
 //! pass only local data on to the local assemblers.
+//!
+//! The assembly methods may be called concurrently for different mesh items by
+//! the GlobalExecutor. The local matrices are added to the global ones inside
+//! GlobalExecutor::executeOrdered() sections. The local assembly runs inside
+//! the same sections unless setConcurrentLocalAssembly() has been enabled.
 class VectorMatrixAssembler final
 {
 public:
@@ -63,16 +68,33 @@ public:
         GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac,
         CoupledSolutionsForStaggeredScheme const* const cpl_xs);
 
-private:
-    // temporary data only stored here in order to avoid frequent memory
-    // reallocations.
-    std::vector<double> _local_M_data;
-    std::vector<double> _local_K_data;
-    std::vector<double> _local_b_data;
-    std::vector<double> _local_Jac_data;
+    //! If set, assembleWithJacobian() adds the local
+    //! \f$ b - M \cdot \dot x - K \cdot x \f$, i.e., the negative residual,
+    //! to \c b and does not access the global \c M and \c K.
+    void setResidualAssembly(bool const assemble_residual)
+    {
+        _assemble_residual = assemble_residual;
+    }
+
+    //! If set, the local assemblers are called concurrently for different mesh
+    //! items, otherwise one after another in the ordered sections. Must only
+    //! be set by processes whose local assemblers evaluate parameters and
+    //! material models in a thread-safe way, i.e., not via
+    //! Parameter::operator().
+    void setConcurrentLocalAssembly(bool const concurrent_local_assembly)
+    {
+        _concurrent_local_assembly = concurrent_local_assembly;
+    }
 
+private:
     //! Used to assemble the Jacobian.
     std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
+
+    //! \see setResidualAssembly()
+    bool _assemble_residual = false;
+
+    //! \see setConcurrentLocalAssembly()
+    bool _concurrent_local_assembly = false;
 };
 
 }  // namespace ProcessLib
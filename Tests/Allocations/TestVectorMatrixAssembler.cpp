@@ -0,0 +1,176 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ProcessLib/AnalyticalJacobianAssembler.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+#include "ProcessLib/VectorMatrixAssembler.h"
+
+// The replaced global allocation functions below are the reason why these
+// tests are built into the separate testrunner_allocations executable.
+
+namespace
+{
+// Counts the heap allocations of the current thread while enabled.
+thread_local bool count_allocations = false;
+thread_local std::size_t number_of_allocations = 0;
+
+void* allocate(std::size_t const size)
+{
+    if (count_allocations)
+        ++number_of_allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc{};
+}
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*size*/) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t /*size*/) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+class LocalAssemblerStub final : public ProcessLib::LocalAssemblerInterface
+{
+public:
+    void assemble(double const /*t*/, std::vector<double> const& local_x,
+                  std::vector<double>& local_M_data,
+                  std::vector<double>& local_K_data,
+                  std::vector<double>& local_b_data) override
+    {
+        auto const n = local_x.size();
+        local_M_data.assign(n * n, 1.0);
+        local_K_data.assign(n * n, 2.0);
+        local_b_data.assign(local_x.begin(), local_x.end());
+    }
+
+    void assembleWithJacobian(double const t,
+                              std::vector<double> const& local_x,
+                              std::vector<double> const& /*local_xdot*/,
+                              const double /*dxdot_dx*/, const double /*dx_dx*/,
+                              std::vector<double>& local_M_data,
+                              std::vector<double>& local_K_data,
+                              std::vector<double>& local_b_data,
+                              std::vector<double>& local_Jac_data) override
+    {
+        assemble(t, local_x, local_M_data, local_K_data, local_b_data);
+        local_Jac_data.assign(local_x.size() * local_x.size(), 3.0);
+    }
+};
+}  // namespace
+
+#ifndef USE_PETSC
+TEST(ProcessLibVectorMatrixAssembler, NoAllocationsPerElement)
+#else
+TEST(ProcessLibVectorMatrixAssembler, DISABLED_NoAllocationsPerElement)
+#endif
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 10));
+    MeshLib::MeshSubset const all_nodes(*mesh, mesh->getNodes());
+    std::vector<MeshLib::MeshSubset> components{all_nodes, all_nodes};
+    NumLib::LocalToGlobalIndexMap dof_table(
+        std::move(components), NumLib::ComponentOrder::BY_LOCATION);
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
+        dof_tables{std::ref(dof_table)};
+
+    auto const sparsity_pattern =
+        NumLib::computeSparsityPattern(dof_table, *mesh);
+    MathLib::MatrixSpecifications const spec(dof_table.dofSizeWithoutGhosts(),
+                                             dof_table.dofSizeWithoutGhosts(),
+                                             &dof_table.getGhostIndices(),
+                                             &sparsity_pattern);
+    using MatrixTraits = MathLib::MatrixVectorTraits<GlobalMatrix>;
+    using VectorTraits = MathLib::MatrixVectorTraits<GlobalVector>;
+    auto M = MatrixTraits::newInstance(spec);
+    auto K = MatrixTraits::newInstance(spec);
+    auto Jac = MatrixTraits::newInstance(spec);
+    auto b = VectorTraits::newInstance(spec);
+    auto x = VectorTraits::newInstance(spec);
+    auto xdot = VectorTraits::newInstance(spec);
+    MathLib::LinAlg::setLocalAccessibleVector(*x);
+    MathLib::LinAlg::setLocalAccessibleVector(*xdot);
+
+    std::vector<LocalAssemblerStub> local_assemblers(
+        mesh->getNumberOfElements());
+    ProcessLib::VectorMatrixAssembler assembler(
+        std::make_unique<ProcessLib::AnalyticalJacobianAssembler>());
+
+    auto const assemble = [&]() {
+        M->setZero();
+        K->setZero();
+        Jac->setZero();
+        b->setZero();
+        for (std::size_t id = 0; id < local_assemblers.size(); ++id)
+        {
+            assembler.assemble(id, local_assemblers[id], dof_tables, 0.0, *x,
+                               *M, *K, *b, nullptr);
+            assembler.assembleWithJacobian(id, local_assemblers[id],
+                                           dof_tables, 0.0, *x, *xdot, 1.0,
+                                           1.0, *M, *K, *b, *Jac, nullptr);
+        }
+        MathLib::LinAlg::finalizeAssembly(*M);
+        MathLib::LinAlg::finalizeAssembly(*K);
+        MathLib::LinAlg::finalizeAssembly(*Jac);
+        MathLib::LinAlg::finalizeAssembly(*b);
+    };
+
+    // Warm up: insert the matrix entries and fill the scratch buffers and
+    // caches.
+    assemble();
+    assemble();
+
+    number_of_allocations = 0;
+    count_allocations = true;
+    assemble();
+    count_allocations = false;
+
+    ASSERT_EQ(0u, number_of_allocations);
+}
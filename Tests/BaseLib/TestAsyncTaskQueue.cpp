@@ -0,0 +1,85 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "BaseLib/AsyncTaskQueue.h"
+
+TEST(BaseLibAsyncTaskQueue, TasksRunInOrder)
+{
+    std::vector<int> executed;
+    {
+        BaseLib::AsyncTaskQueue queue(2);
+        for (int i = 0; i < 100; ++i)
+        {
+            queue.push([i, &executed]() { executed.push_back(i); });
+        }
+        // The destructor waits for the remaining tasks.
+    }
+
+    ASSERT_EQ(100u, executed.size());
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(i, executed[i]);
+    }
+}
+
+TEST(BaseLibAsyncTaskQueue, QueueSizeIsBounded)
+{
+    BaseLib::AsyncTaskQueue queue(1);
+    std::atomic<bool> release{false};
+    std::atomic<int> finished{0};
+
+    auto const blocking_task = [&]() {
+        while (!release)
+        {
+            std::this_thread::yield();
+        }
+        ++finished;
+    };
+
+    queue.push(blocking_task);
+    // Returns as soon as the worker has taken the blocking task. Afterwards
+    // the queue is full.
+    queue.push([]() {});
+
+    std::atomic<bool> pushed{false};
+    std::thread producer([&]() {
+        queue.push([&]() { ++finished; });
+        pushed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // The queue is full, hence the producer is still blocked.
+    ASSERT_FALSE(pushed);
+
+    release = true;
+    producer.join();
+    queue.waitForAll();
+    ASSERT_TRUE(pushed);
+    ASSERT_EQ(2, finished);
+}
+
+TEST(BaseLibAsyncTaskQueue, ExceptionsArePassedToTheFuture)
+{
+    BaseLib::AsyncTaskQueue queue(1);
+    auto future = queue.push([]() { throw std::runtime_error("failure"); });
+    ASSERT_THROW(future.get(), std::runtime_error);
+
+    // The queue keeps working.
+    bool executed = false;
+    queue.push([&]() { executed = true; }).get();
+    ASSERT_TRUE(executed);
+}
@@ -0,0 +1,116 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "BaseLib/Profiler.h"
+
+namespace
+{
+void runTimeSteps(std::size_t const number_of_time_steps)
+{
+    auto& profiler = BaseLib::Profiler::instance();
+    for (std::size_t time_step = 1; time_step <= number_of_time_steps;
+         ++time_step)
+    {
+        profiler.setTimeStep(time_step);
+        BaseLib::ProfilingScope const time_step_scope("time_step");
+        for (int process_id = 0; process_id < 2; ++process_id)
+        {
+            BaseLib::ProfilingScope const process_scope(
+                "process_" + std::to_string(process_id));
+            for (int iteration = 0; iteration < 3; ++iteration)
+            {
+                BaseLib::ProfilingScope const assembly_scope("assembly");
+            }
+            profiler.addToCounter("iterations", 3);
+        }
+    }
+}
+
+nlohmann::json const* findScope(nlohmann::json const& summary,
+                                std::string const& path)
+{
+    for (auto const& scope : summary["scopes"])
+        if (scope["path"] == path)
+            return &scope;
+    return nullptr;
+}
+}  // namespace
+
+TEST(BaseLibProfiler, DisabledProfilerRecordsNothing)
+{
+    auto& profiler = BaseLib::Profiler::instance();
+    profiler.clear();
+    ASSERT_FALSE(profiler.isEnabled());
+
+    runTimeSteps(2);
+
+    std::ostringstream json;
+    profiler.writeJSON(json);
+    ASSERT_TRUE(nlohmann::json::parse(json.str())["scopes"].empty());
+}
+
+TEST(BaseLibProfiler, NestedScopesAndCounters)
+{
+    auto& profiler = BaseLib::Profiler::instance();
+    profiler.clear();
+    profiler.enable();
+    runTimeSteps(2);
+    profiler.disable();
+
+    std::ostringstream json;
+    profiler.writeJSON(json);
+    auto const summary = nlohmann::json::parse(json.str());
+    ASSERT_EQ(1, summary["number_of_ranks"]);
+    ASSERT_EQ(5u, summary["scopes"].size());
+
+    auto const* time_step = findScope(summary, "time_step");
+    ASSERT_NE(nullptr, time_step);
+    ASSERT_EQ(2, (*time_step)["calls"]["avg"]);
+
+    auto const* assembly = findScope(summary, "time_step/process_1/assembly");
+    ASSERT_NE(nullptr, assembly);
+    ASSERT_EQ(6, (*assembly)["calls"]["avg"]);
+    ASSERT_LE((*assembly)["min"]["avg"], (*assembly)["max"]["avg"]);
+    auto const& time_steps = (*assembly)["time_steps"];
+    ASSERT_EQ(2u, time_steps.size());
+    ASSERT_EQ(1, time_steps[0]["time_step"]);
+    ASSERT_EQ(3, time_steps[0]["calls"]["avg"]);
+    ASSERT_EQ(2, time_steps[1]["time_step"]);
+
+    auto const* process = findScope(summary, "time_step/process_0");
+    ASSERT_NE(nullptr, process);
+    ASSERT_EQ(6, (*process)["counters"]["iterations"]["avg"]);
+
+    // One line per scope and time step, one per scope for all time steps, and
+    // the header.
+    std::ostringstream csv;
+    profiler.writeCSV(csv);
+    auto const csv_string = csv.str();
+    ASSERT_EQ(5u * 3 + 1, static_cast<std::size_t>(std::count(
+                              csv_string.begin(), csv_string.end(), '\n')));
+    ASSERT_NE(std::string::npos,
+              csv_string.find("\"time_step/process_1/assembly\",2,3,3,"));
+
+    // Every closed scope is one trace event.
+    std::ostringstream trace;
+    profiler.writeChromeTrace(trace);
+    auto const events = nlohmann::json::parse(trace.str())["traceEvents"];
+    ASSERT_EQ(2u * (1 + 2 * (1 + 3)), events.size());
+    ASSERT_EQ("X", events[0]["ph"]);
+
+    profiler.clear();
+}
@@ -0,0 +1,149 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BaseLib/TextParsing.h"
+
+namespace
+{
+void checkParseDouble(std::string const& text)
+{
+    char const* first = text.data();
+    double value;
+    ASSERT_TRUE(BaseLib::parseDouble(first, text.data() + text.size(), value))
+        << text;
+    // std::strtod is used as reference; the tests run in the "C" locale.
+    char* expected_end;
+    double const expected = std::strtod(text.c_str(), &expected_end);
+    EXPECT_EQ(expected, value) << text;
+    EXPECT_EQ(expected_end, first) << text;
+}
+}  // namespace
+
+TEST(BaseLibTextParsing, ParseDouble)
+{
+    for (auto const* text :
+         {"0", "-0", "1.5", " \t-0.25e-3", "3.141592653589793", "1e308",
+          "4.9e-324", "2.2250738585072014e-308", "123456789012345678901234",
+          "0.1", "2.", ".5", "+1E+2", "6.02214076e23", "9007199254740993",
+          "0.000000000000000000000000000123", "1e", "7e+", "1.5 2.5"})
+    {
+        checkParseDouble(text);
+    }
+
+    std::mt19937 random_number_generator(0);
+    std::uniform_real_distribution<double> mantissa(-1e3, 1e3);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    char text[64];
+    for (int i = 0; i < 10000; ++i)
+    {
+        double const x = mantissa(random_number_generator) *
+                         std::pow(10., exponent(random_number_generator));
+        std::snprintf(text, sizeof(text), "%.17g", x);
+        checkParseDouble(text);
+        std::snprintf(text, sizeof(text), "%.6g", x);
+        checkParseDouble(text);
+    }
+
+    for (std::string const invalid : {"", "  ", "abc", "-", "."})
+    {
+        char const* first = invalid.data();
+        double value;
+        EXPECT_FALSE(BaseLib::parseDouble(
+            first, invalid.data() + invalid.size(), value));
+        EXPECT_EQ(invalid.data(), first);
+    }
+}
+
+TEST(BaseLibTextParsing, ParseInteger)
+{
+    std::string const text = " 42\t-7 +3 4294967296 -1";
+    char const* first = text.data();
+    char const* const last = text.data() + text.size();
+
+    int i;
+    ASSERT_TRUE(BaseLib::parseInteger(first, last, i));
+    EXPECT_EQ(42, i);
+    ASSERT_TRUE(BaseLib::parseInteger(first, last, i));
+    EXPECT_EQ(-7, i);
+    unsigned u;
+    ASSERT_TRUE(BaseLib::parseInteger(first, last, u));
+    EXPECT_EQ(3u, u);
+    // Out of range values are rejected.
+    EXPECT_FALSE(BaseLib::parseInteger(first, last, u));
+    std::size_t s;
+    ASSERT_TRUE(BaseLib::parseInteger(first, last, s));
+    EXPECT_EQ(4294967296u, s);
+    EXPECT_FALSE(BaseLib::parseInteger(first, last, u));
+    ASSERT_TRUE(BaseLib::parseInteger(first, last, i));
+    EXPECT_EQ(-1, i);
+    EXPECT_EQ(last, first);
+
+    std::string const min_max = "-128 127 -129";
+    first = min_max.data();
+    signed char c;
+    ASSERT_TRUE(
+        BaseLib::parseInteger(first, min_max.data() + min_max.size(), c));
+    EXPECT_EQ(-128, c);
+    ASSERT_TRUE(
+        BaseLib::parseInteger(first, min_max.data() + min_max.size(), c));
+    EXPECT_EQ(127, c);
+    EXPECT_FALSE(
+        BaseLib::parseInteger(first, min_max.data() + min_max.size(), c));
+}
+
+TEST(BaseLibTextParsing, ParseLinesInParallel)
+{
+    // Large enough to be split into several chunks.
+    std::size_t const n_lines = 100000;
+    std::string text;
+    for (std::size_t i = 0; i < n_lines; ++i)
+    {
+        text += std::to_string(i) + " " + std::to_string(0.5 * i) + "\r\n";
+        if (i % 1000 == 0)
+        {
+            text += " \n";
+        }
+    }
+    text += "trailing line\n";
+
+    std::vector<double> values(n_lines, -1);
+    std::vector<std::size_t> ids(n_lines, 0);
+    ASSERT_TRUE(BaseLib::parseLinesInParallel(
+        text.data(), text.data() + text.size(), n_lines,
+        [&](char const* p, char const* const line_end, std::size_t const i) {
+            return BaseLib::parseInteger(p, line_end, ids[i]) &&
+                   BaseLib::parseDouble(p, line_end, values[i]);
+        }));
+    for (std::size_t i = 0; i < n_lines; ++i)
+    {
+        ASSERT_EQ(i, ids[i]);
+        ASSERT_EQ(0.5 * i, values[i]);
+    }
+
+    // Too few lines.
+    EXPECT_FALSE(BaseLib::parseLinesInParallel(
+        text.data(), text.data() + text.size(), n_lines + 2,
+        [](char const*, char const*, std::size_t) { return true; }));
+    // A line which could not be parsed.
+    EXPECT_FALSE(BaseLib::parseLinesInParallel(
+        text.data(), text.data() + text.size(), n_lines + 1,
+        [](char const* p, char const* const line_end, std::size_t) {
+            std::size_t id;
+            return BaseLib::parseInteger(p, line_end, id);
+        }));
+}
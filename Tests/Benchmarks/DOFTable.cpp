@@ -0,0 +1,60 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+
+#include "MeshSizes.h"
+
+namespace
+{
+std::unique_ptr<NumLib::LocalToGlobalIndexMap> createDOFTable(
+    MeshLib::Mesh const& mesh, int const number_of_components)
+{
+    MeshLib::MeshSubset const all_nodes(mesh, mesh.getNodes());
+    std::vector<MeshLib::MeshSubset> components(number_of_components,
+                                                all_nodes);
+    return std::make_unique<NumLib::LocalToGlobalIndexMap>(
+        std::move(components), NumLib::ComponentOrder::BY_LOCATION);
+}
+}  // namespace
+
+/// Construction of the d.o.f. table of a 3D mechanics problem.
+static void LocalToGlobalIndexMapConstruction(benchmark::State& state)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, state.range(0)));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(createDOFTable(*mesh, 3));
+    state.SetItemsProcessed(state.iterations() * mesh->getNumberOfElements());
+}
+BENCHMARK(LocalToGlobalIndexMapConstruction)->Apply(Benchmarks::meshSizes);
+
+/// Sparsity pattern of the global matrix of a 3D mechanics problem.
+static void ComputeSparsityPattern(benchmark::State& state)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, state.range(0)));
+    auto const dof_table = createDOFTable(*mesh, 3);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(
+            NumLib::computeSparsityPattern(*dof_table, *mesh));
+    state.SetItemsProcessed(state.iterations() * mesh->getNumberOfNodes());
+}
+BENCHMARK(ComputeSparsityPattern)->Apply(Benchmarks::meshSizes);
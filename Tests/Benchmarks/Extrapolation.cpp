@@ -0,0 +1,146 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/Extrapolation/ExtrapolatableElementCollection.h"
+#include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendreRegular.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "NumLib/NumericsConfig.h"
+
+#include "MeshSizes.h"
+
+namespace
+{
+/// Integration point values of a hex mesh; all elements share the shape
+/// matrices, which depend on the natural coordinates only.
+class HexIntegrationPointValues final
+    : public NumLib::ExtrapolatableElementCollection
+{
+public:
+    HexIntegrationPointValues(std::size_t const number_of_elements,
+                              unsigned const number_of_components)
+        : _number_of_elements(number_of_elements)
+    {
+        NumLib::IntegrationGaussLegendreRegular<3> const integration_method(2);
+        _number_of_integration_points = integration_method.getNumberOfPoints();
+
+        _N.resize(_number_of_integration_points * NumLib::ShapeHex8::NPOINTS);
+        for (unsigned ip = 0; ip < _number_of_integration_points; ++ip)
+        {
+            Eigen::Map<Eigen::RowVectorXd> N(
+                _N.data() + ip * NumLib::ShapeHex8::NPOINTS,
+                NumLib::ShapeHex8::NPOINTS);
+            NumLib::ShapeHex8::computeShapeFunction(
+                integration_method.getWeightedPoint(ip).getCoords(), N);
+        }
+
+        _values.resize(_number_of_integration_points * number_of_components);
+        for (std::size_t i = 0; i < _values.size(); ++i)
+            _values[i] = static_cast<double>(i);
+    }
+
+    Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
+        std::size_t const /*id*/,
+        unsigned const integration_point) const override
+    {
+        return {_N.data() + integration_point * NumLib::ShapeHex8::NPOINTS,
+                NumLib::ShapeHex8::NPOINTS};
+    }
+
+    std::vector<double> const& getIntegrationPointValues(
+        std::size_t const /*id*/, const double /*t*/,
+        GlobalVector const& /*current_solution*/,
+        NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
+        std::vector<double>& /*cache*/) const override
+    {
+        return _values;
+    }
+
+    std::size_t size() const override { return _number_of_elements; }
+
+private:
+    std::size_t const _number_of_elements;
+    unsigned _number_of_integration_points;
+    std::vector<double> _N;
+    std::vector<double> _values;
+};
+
+struct ExtrapolationFixture
+{
+    explicit ExtrapolationFixture(int const subdivisions)
+        : mesh(MeshLib::MeshGenerator::generateRegularHexMesh(1.0,
+                                                              subdivisions))
+    {
+        MeshLib::MeshSubset const all_nodes(*mesh, mesh->getNodes());
+        std::vector<MeshLib::MeshSubset> components{all_nodes};
+        dof_table = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+            std::move(components), NumLib::ComponentOrder::BY_COMPONENT);
+        extrapolator =
+            std::make_unique<NumLib::LocalLinearLeastSquaresExtrapolator>(
+                *dof_table);
+
+        MathLib::MatrixSpecifications const spec(
+            dof_table->dofSizeWithoutGhosts(),
+            dof_table->dofSizeWithoutGhosts(), &dof_table->getGhostIndices(),
+            nullptr);
+        x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    std::unique_ptr<NumLib::LocalToGlobalIndexMap> dof_table;
+    std::unique_ptr<NumLib::LocalLinearLeastSquaresExtrapolator> extrapolator;
+    std::unique_ptr<GlobalVector> x;
+};
+}  // namespace
+
+/// Extrapolation of a symmetric tensor (six components) from the integration
+/// points of linear hexahedra.
+static void ExtrapolateTensor(benchmark::State& state)
+{
+    ExtrapolationFixture f(state.range(0));
+    HexIntegrationPointValues const values(f.mesh->getNumberOfElements(), 6);
+
+    for (auto _ : state)
+        f.extrapolator->extrapolate(6, values, 0.0, *f.x, *f.dof_table);
+    state.SetItemsProcessed(state.iterations() *
+                            f.mesh->getNumberOfElements());
+}
+BENCHMARK(ExtrapolateTensor)->Apply(Benchmarks::meshSizes);
+
+/// Extrapolation of four secondary variables with one or six components each
+/// in a single pass.
+static void ExtrapolateSeveralVariables(benchmark::State& state)
+{
+    ExtrapolationFixture f(state.range(0));
+    auto const n_elements = f.mesh->getNumberOfElements();
+    HexIntegrationPointValues const scalar(n_elements, 1);
+    HexIntegrationPointValues const tensor(n_elements, 6);
+
+    std::vector<unsigned> const num_components{1, 6, 1, 6};
+    std::vector<NumLib::ExtrapolatableElementCollection const*> const
+        extrapolatables{&scalar, &tensor, &scalar, &tensor};
+    std::vector<std::unique_ptr<GlobalVector>> nodal_values;
+
+    for (auto _ : state)
+        f.extrapolator->extrapolate(num_components, extrapolatables, 0.0,
+                                    *f.x, *f.dof_table, nodal_values);
+    state.SetItemsProcessed(state.iterations() * n_elements);
+}
+BENCHMARK(ExtrapolateSeveralVariables)->Apply(Benchmarks::meshSizes);
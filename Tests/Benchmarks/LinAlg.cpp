@@ -0,0 +1,106 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifndef USE_PETSC
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <Eigen/Core>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/DOFTableUtil.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/NumericsConfig.h"
+
+#include "MeshSizes.h"
+
+namespace
+{
+/// A global matrix with the sparsity pattern of a hex mesh with three
+/// components per node, i.e., the matrix of a 3D mechanics problem.
+struct GlobalMatrixFixture
+{
+    explicit GlobalMatrixFixture(int const subdivisions)
+        : mesh(MeshLib::MeshGenerator::generateRegularHexMesh(1.0,
+                                                              subdivisions))
+    {
+        MeshLib::MeshSubset const all_nodes(*mesh, mesh->getNodes());
+        std::vector<MeshLib::MeshSubset> components(3, all_nodes);
+        dof_table = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+            std::move(components), NumLib::ComponentOrder::BY_LOCATION);
+
+        auto const sparsity_pattern =
+            NumLib::computeSparsityPattern(*dof_table, *mesh);
+        MathLib::MatrixSpecifications const spec(
+            dof_table->dofSizeWithoutGhosts(),
+            dof_table->dofSizeWithoutGhosts(), &dof_table->getGhostIndices(),
+            &sparsity_pattern);
+        K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+
+        for (std::size_t id = 0; id < mesh->getNumberOfElements(); ++id)
+            indices.push_back(NumLib::getIndices(id, *dof_table));
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    std::unique_ptr<NumLib::LocalToGlobalIndexMap> dof_table;
+    std::unique_ptr<GlobalMatrix> K;
+    std::vector<std::vector<GlobalIndexType>> indices;
+};
+}  // namespace
+
+/// Adds one local 24x24 matrix per element to the global matrix searching
+/// for the entries of each local matrix.
+static void EigenMatrixAdd(benchmark::State& state)
+{
+    GlobalMatrixFixture f(state.range(0));
+    Eigen::MatrixXd const local_K = Eigen::MatrixXd::Ones(24, 24);
+
+    for (auto _ : state)
+    {
+        f.K->setZero();
+        for (auto const& indices : f.indices)
+            f.K->add(indices, local_K);
+        MathLib::LinAlg::finalizeAssembly(*f.K);
+    }
+    state.SetItemsProcessed(state.iterations() * f.indices.size());
+}
+BENCHMARK(EigenMatrixAdd)->Apply(Benchmarks::meshSizes);
+
+/// Same as EigenMatrixAdd() but uses the value offsets cached per element.
+static void EigenMatrixAddCached(benchmark::State& state)
+{
+    GlobalMatrixFixture f(state.range(0));
+    Eigen::MatrixXd const local_K = Eigen::MatrixXd::Ones(24, 24);
+
+    auto const assemble = [&]() {
+        f.K->setZero();
+        for (std::size_t id = 0; id < f.indices.size(); ++id)
+            f.K->add(id, {f.indices[id], f.indices[id]}, local_K);
+        MathLib::LinAlg::finalizeAssembly(*f.K);
+    };
+
+    // Fill the cache.
+    assemble();
+    assemble();
+
+    for (auto _ : state)
+        assemble();
+    state.SetItemsProcessed(state.iterations() * f.indices.size());
+}
+BENCHMARK(EigenMatrixAddCached)->Apply(Benchmarks::meshSizes);
+
+#endif  // USE_PETSC
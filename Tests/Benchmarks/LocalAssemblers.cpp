@@ -0,0 +1,156 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "MaterialLib/SolidModels/LinearElasticIsotropic.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/QuadraticMeshGenerator.h"
+#include "NumLib/Fem/Integration/GaussLegendreIntegrationPolicy.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex20.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "ProcessLib/HydroMechanics/HydroMechanicsFEM-impl.h"
+#include "ProcessLib/HydroMechanics/HydroMechanicsProcessData.h"
+#include "ProcessLib/Parameter/ConstantParameter.h"
+#include "ProcessLib/SmallDeformation/SmallDeformationFEM.h"
+#include "ProcessLib/SmallDeformation/SmallDeformationProcessData.h"
+
+#include "MeshSizes.h"
+
+namespace
+{
+std::map<int,
+         std::unique_ptr<MaterialLib::Solids::MechanicsBase<3>>>
+createLinearElasticMaterial(ProcessLib::Parameter<double> const& E,
+                            ProcessLib::Parameter<double> const& nu)
+{
+    using Material = MaterialLib::Solids::LinearElasticIsotropic<3>;
+    std::map<int, std::unique_ptr<MaterialLib::Solids::MechanicsBase<3>>>
+        materials;
+    materials[0] = std::make_unique<Material>(
+        typename Material::MaterialProperties{E, nu});
+    return materials;
+}
+
+/// A small, smooth nodal solution of the given size.
+std::vector<double> localSolution(std::size_t const size)
+{
+    std::vector<double> x(size);
+    for (std::size_t i = 0; i < size; ++i)
+        x[i] = 1e-4 * static_cast<double>(i % 7);
+    return x;
+}
+
+/// Calls assembleWithJacobian() of all local assemblers the way the
+/// VectorMatrixAssembler does, without the global matrix assembly.
+template <typename LocalAssembler>
+void assembleWithJacobian(
+    benchmark::State& state,
+    std::vector<std::unique_ptr<LocalAssembler>> const& local_assemblers,
+    std::size_t const local_matrix_size)
+{
+    auto const local_x = localSolution(local_matrix_size);
+    std::vector<double> const local_xdot(local_matrix_size, 0.0);
+    std::vector<double> local_M_data;
+    std::vector<double> local_K_data;
+    std::vector<double> local_b_data;
+    std::vector<double> local_Jac_data;
+
+    for (auto _ : state)
+    {
+        for (auto const& local_assembler : local_assemblers)
+        {
+            local_M_data.clear();
+            local_K_data.clear();
+            local_b_data.clear();
+            local_Jac_data.clear();
+            local_assembler->assembleWithJacobian(
+                0.0, local_x, local_xdot, 1.0, 1.0, local_M_data,
+                local_K_data, local_b_data, local_Jac_data);
+            benchmark::DoNotOptimize(local_Jac_data.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * local_assemblers.size());
+}
+}  // namespace
+
+/// Newton assembly of linear elastic small deformation on linear hexahedra.
+static void SmallDeformationAssembleWithJacobian(benchmark::State& state)
+{
+    using namespace ProcessLib;
+    using LocalAssembler = SmallDeformation::SmallDeformationLocalAssembler<
+        NumLib::ShapeHex8, NumLib::GaussLegendreIntegrationPolicy<
+                               MeshLib::Hex>::IntegrationMethod,
+        3>;
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, state.range(0)));
+
+    ConstantParameter<double> const E("E", 1e9);
+    ConstantParameter<double> const nu("nu", 0.25);
+    ConstantParameter<double> const rho_sr("rho_sr", 2e3);
+    SmallDeformation::SmallDeformationProcessData<3> process_data(
+        nullptr, createLinearElasticMaterial(E, nu), rho_sr,
+        Eigen::Vector3d::Zero(), 293.15);
+    process_data.dt = 1.0;
+
+    std::size_t const local_matrix_size = 3 * NumLib::ShapeHex8::NPOINTS;
+    std::vector<std::unique_ptr<LocalAssembler>> local_assemblers;
+    for (auto const* e : mesh->getElements())
+        local_assemblers.push_back(std::make_unique<LocalAssembler>(
+            *e, local_matrix_size, false, 2, process_data));
+
+    assembleWithJacobian(state, local_assemblers, local_matrix_size);
+}
+BENCHMARK(SmallDeformationAssembleWithJacobian)->Apply(Benchmarks::meshSizes);
+
+/// Monolithic Newton assembly of linear poroelasticity on quadratic
+/// (displacement) and linear (pressure) hexahedra.
+static void HydroMechanicsAssembleWithJacobian(benchmark::State& state)
+{
+    using namespace ProcessLib;
+    using LocalAssembler = HydroMechanics::HydroMechanicsLocalAssembler<
+        NumLib::ShapeHex20, NumLib::ShapeHex8,
+        NumLib::GaussLegendreIntegrationPolicy<
+            MeshLib::Hex20>::IntegrationMethod,
+        3>;
+
+    std::unique_ptr<MeshLib::Mesh> const linear_mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, state.range(0)));
+    auto const mesh = MeshLib::createQuadraticOrderMesh(*linear_mesh);
+
+    ConstantParameter<double> const E("E", 1e9);
+    ConstantParameter<double> const nu("nu", 0.25);
+    ConstantParameter<double> const k("k", 1e-12);
+    ConstantParameter<double> const S("S", 1e-10);
+    ConstantParameter<double> const mu("mu", 1e-3);
+    ConstantParameter<double> const rho_fr("rho_fr", 1e3);
+    ConstantParameter<double> const alpha("alpha", 1.0);
+    ConstantParameter<double> const phi("phi", 0.2);
+    ConstantParameter<double> const rho_sr("rho_sr", 2e3);
+    HydroMechanics::HydroMechanicsProcessData<3> process_data(
+        nullptr, createLinearElasticMaterial(E, nu), k, S, mu, rho_fr, alpha,
+        phi, rho_sr, Eigen::Vector3d::Zero(), 293.15);
+    process_data.dt = 1.0;
+
+    std::size_t const local_matrix_size =
+        NumLib::ShapeHex8::NPOINTS + 3 * NumLib::ShapeHex20::NPOINTS;
+    std::vector<std::unique_ptr<LocalAssembler>> local_assemblers;
+    for (auto const* e : mesh->getElements())
+        local_assemblers.push_back(std::make_unique<LocalAssembler>(
+            *e, local_matrix_size, false, 3, process_data));
+
+    assembleWithJacobian(state, local_assemblers, local_matrix_size);
+}
+BENCHMARK(HydroMechanicsAssembleWithJacobian)->Apply(Benchmarks::meshSizes);
@@ -0,0 +1,52 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmarks
+{
+/// Returns the numbers of subdivisions per direction of the generated meshes.
+///
+/// They are read from the comma separated list in the environment variable
+/// OGS_BENCHMARK_MESH_SIZES, e.g., "8,16,32", and default to 4, 8 and 16.
+inline std::vector<int> meshSubdivisions()
+{
+    std::vector<int> subdivisions;
+    if (char const* const sizes = std::getenv("OGS_BENCHMARK_MESH_SIZES"))
+    {
+        std::istringstream is(sizes);
+        std::string size;
+        while (std::getline(is, size, ','))
+        {
+            int const n = std::atoi(size.c_str());
+            if (n > 0)
+                subdivisions.push_back(n);
+        }
+    }
+    if (subdivisions.empty())
+        subdivisions = {4, 8, 16};
+    return subdivisions;
+}
+
+/// Registers one benchmark run per mesh size; to be passed to
+/// benchmark::internal::Benchmark::Apply().
+inline void meshSizes(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("subdivisions");
+    for (int const n : meshSubdivisions())
+        b->Arg(n);
+}
+}  // namespace Benchmarks
@@ -0,0 +1,81 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+
+#include "MeshSizes.h"
+
+namespace
+{
+std::unique_ptr<MeshLib::Mesh> createMeshWithData(int const subdivisions)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, subdivisions));
+
+    auto* const displacement =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "displacement", MeshLib::MeshItemType::Node, 3);
+    displacement->resize(3 * mesh->getNumberOfNodes(), 1.0);
+
+    auto* const stress = mesh->getProperties().createNewPropertyVector<double>(
+        "sigma", MeshLib::MeshItemType::Cell, 6);
+    stress->resize(6 * mesh->getNumberOfElements(), 2.0);
+
+    return mesh;
+}
+
+std::string benchmarkFileName(int const subdivisions)
+{
+    return BaseLib::BuildInfo::tests_tmp_path + "VtuIOBenchmark_" +
+           std::to_string(subdivisions) + ".vtu";
+}
+}  // namespace
+
+/// Writes a hex mesh with a nodal vector and a cell tensor field.
+static void VtuWrite(benchmark::State& state)
+{
+    auto const mesh = createMeshWithData(state.range(0));
+    auto const file_name = benchmarkFileName(state.range(0));
+    MeshLib::IO::VtuInterface vtu_interface(mesh.get());
+
+    for (auto _ : state)
+        vtu_interface.writeToFile(file_name);
+    state.SetItemsProcessed(state.iterations() * mesh->getNumberOfElements());
+
+    std::remove(file_name.c_str());
+}
+BENCHMARK(VtuWrite)->Apply(Benchmarks::meshSizes);
+
+/// Reads the file written by VtuWrite().
+static void VtuRead(benchmark::State& state)
+{
+    auto const mesh = createMeshWithData(state.range(0));
+    auto const file_name = benchmarkFileName(state.range(0));
+    MeshLib::IO::VtuInterface(mesh.get()).writeToFile(file_name);
+
+    for (auto _ : state)
+    {
+        std::unique_ptr<MeshLib::Mesh> read_mesh(
+            MeshLib::IO::VtuInterface::readVTUFile(file_name));
+        benchmark::DoNotOptimize(read_mesh.get());
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->getNumberOfElements());
+
+    std::remove(file_name.c_str());
+}
+BENCHMARK(VtuRead)->Apply(Benchmarks::meshSizes);
@@ -0,0 +1,58 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <clocale>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "Applications/ApplicationsLib/LinearSolverLibrarySetup.h"
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "BaseLib/TemplateLogogFormatterSuppressedGCC.h"
+
+/// Runs the Google Benchmark micro-benchmarks.
+///
+/// Besides the Google Benchmark options, e.g., --benchmark_filter or
+/// --benchmark_out, the log level can be set with "-l <level>"; it defaults
+/// to "warn" to keep the benchmark output readable. The mesh sizes are
+/// configured via the OGS_BENCHMARK_MESH_SIZES environment variable, see
+/// MeshSizes.h.
+int main(int argc, char* argv[])
+{
+    std::string logLevel("warn");
+    for (int i = 1; i < argc; i++)
+    {
+        if (i + 1 == argc)
+            break;
+        if (std::strcmp(argv[i], "-l") == 0)
+            logLevel = argv[i + 1];
+    }
+
+    setlocale(LC_ALL, "C");
+
+    // Same order as in the testrunner, see there.
+    ApplicationsLib::LogogSetup logog_setup;
+
+    ApplicationsLib::LinearSolverLibrarySetup linear_solver_library_setup(
+        argc, argv);
+
+    logog_setup.setFormatter(
+        std::make_unique<BaseLib::TemplateLogogFormatterSuppressedGCC<
+            TOPIC_LEVEL_FLAG | TOPIC_FILE_NAME_FLAG |
+            TOPIC_LINE_NUMBER_FLAG>>());
+    logog_setup.setLevel(logLevel);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,40 @@
+
+import OpenGeoSys
+import numpy as np
+
+a = 2.0*np.pi/3.0
+
+# analytical solution used to set the Dirichlet BCs
+def solution(x, y):
+    return np.sin(a*x) * np.sinh(a*y)
+
+# gradient of the analytical solution used to set the Neumann BCs
+def grad_solution(x, y):
+    return a * np.cos(a*x) * np.sinh(a*y), \
+            a * np.sin(a*x) * np.cosh(a*y)
+
+# Dirichlet BCs; all nodes of a boundary are handled in a single call
+class BCDirichlet(OpenGeoSys.BoundaryCondition):
+    def getDirichletBCValues(self, t, coords, node_ids, primary_vars):
+        x = coords[:, 0]
+        y = coords[:, 1]
+        values = solution(x, y)
+        return (np.ones(len(node_ids), dtype=bool), values)
+
+# Neumann BC; all integration points of the boundary in a single call
+class BCRight(OpenGeoSys.BoundaryCondition):
+    def getFluxes(self, t, coords, primary_vars):
+        x = coords[:, 0]
+        y = coords[:, 1]
+        assert np.all(x == 1.0)
+        values = grad_solution(x, y)[0]
+        # values do not depend on the primary variable
+        Jac = np.zeros(primary_vars.shape)
+        return (np.ones(len(x), dtype=bool), values, Jac)
+
+
+# instantiate BC objects referenced in OpenGeoSys' prj file
+bc_top = BCDirichlet()
+bc_right = BCRight()
+bc_bottom = BCDirichlet()
+bc_left = BCDirichlet()
@@ -0,0 +1,160 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "Applications/FileIO/Gmsh/GmshReader.h"
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+// All files describe the same mesh: a unit square with two triangles of
+// different physical groups, a line on the boundary and a point element,
+// which is skipped.
+class GmshReaderTest : public ::testing::Test
+{
+public:
+    GmshReaderTest()
+        : _file_name(BaseLib::BuildInfo::tests_tmp_path + "test.msh")
+    {
+    }
+
+    ~GmshReaderTest() override { std::remove(_file_name.c_str()); }
+
+protected:
+    void write(std::string const& content)
+    {
+        std::ofstream out(_file_name, std::ios::binary);
+        out << content;
+    }
+
+    void checkMesh()
+    {
+        std::unique_ptr<MeshLib::Mesh> const mesh(
+            FileIO::GMSH::readGMSHMesh(_file_name));
+        ASSERT_TRUE(mesh != nullptr);
+        ASSERT_EQ(4u, mesh->getNumberOfNodes());
+        ASSERT_EQ(3u, mesh->getNumberOfElements());
+        EXPECT_EQ(1.0, (*mesh->getNode(2))[0]);
+        EXPECT_EQ(1.0, (*mesh->getNode(2))[1]);
+
+        auto const& elements = mesh->getElements();
+        EXPECT_EQ(MeshLib::MeshElemType::LINE, elements[0]->getGeomType());
+        EXPECT_EQ(MeshLib::MeshElemType::TRIANGLE, elements[1]->getGeomType());
+        EXPECT_EQ(MeshLib::MeshElemType::TRIANGLE, elements[2]->getGeomType());
+        // The triangle nodes are reversed.
+        EXPECT_EQ(mesh->getNode(2), elements[1]->getNode(0));
+        EXPECT_EQ(mesh->getNode(0), elements[1]->getNode(2));
+        EXPECT_EQ(mesh->getNode(3), elements[2]->getNode(0));
+
+        // Physical groups 9, 7 and 8 condensed to 2, 0 and 1.
+        auto const& material_ids =
+            *mesh->getProperties().getPropertyVector<int>("MaterialIDs");
+        ASSERT_EQ(3u, material_ids.size());
+        EXPECT_EQ(2, material_ids[0]);
+        EXPECT_EQ(0, material_ids[1]);
+        EXPECT_EQ(1, material_ids[2]);
+    }
+
+    std::string _file_name;
+};
+
+TEST_F(GmshReaderTest, Version22)
+{
+    write(
+        "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n"
+        "$PhysicalNames\n1\n2 7 \"left\"\n$EndPhysicalNames\n"
+        "$Nodes\n4\n"
+        "1 0 0 0\n2 1 0 0\n3 1.0 1.0 0\n4 0 1e0 0\n"
+        "$EndNodes\n"
+        "$Elements\n4\n"
+        "1 15 2 0 1 1\n"
+        "2 1 2 9 1 1 2\n"
+        "3 2 2 7 1 1 2 3\n"
+        "4 2 2 8 2 1 3 4\n"
+        "$EndElements\n");
+    checkMesh();
+}
+
+TEST_F(GmshReaderTest, Version41Text)
+{
+    write(
+        "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n"
+        "$Entities\n1 1 2 0\n"
+        "1 0 0 0 0\n"
+        "1 0 0 0 1 0 0 1 9 2 1 -2\n"
+        "1 0 0 0 1 1 0 1 7 0\n"
+        "2 0 0 0 1 1 0 1 8 0\n"
+        "$EndEntities\n"
+        "$Nodes\n2 4 1 4\n"
+        "0 1 0 1\n1\n0 0 0\n"
+        "2 1 0 3\n2\n3\n4\n1 0 0\n1 1 0\n0 1 0\n"
+        "$EndNodes\n"
+        "$Elements\n4 4 1 4\n"
+        "0 1 15 1\n1 1\n"
+        "1 1 1 1\n2 1 2\n"
+        "2 1 2 1\n3 1 2 3\n"
+        "2 2 2 1\n4 1 3 4\n"
+        "$EndElements\n");
+    checkMesh();
+}
+
+TEST_F(GmshReaderTest, Version41Binary)
+{
+    std::string content = "$MeshFormat\n4.1 1 8\n";
+    auto const append = [&content](auto const value) {
+        char bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        content.append(bytes, sizeof(value));
+    };
+    auto const i = [&append](std::int32_t const v) { append(v); };
+    auto const s = [&append](std::uint64_t const v) { append(v); };
+    auto const d = [&append](double const v) { append(v); };
+
+    i(1);
+    content += "\n$EndMeshFormat\n$Entities\n";
+    s(1), s(1), s(2), s(0);
+    i(1), d(0), d(0), d(0), s(0);
+    i(1), d(0), d(0), d(0), d(1), d(0), d(0), s(1), i(9), s(2), i(1), i(-2);
+    i(1), d(0), d(0), d(0), d(1), d(1), d(0), s(1), i(7), s(0);
+    i(2), d(0), d(0), d(0), d(1), d(1), d(0), s(1), i(8), s(0);
+    content += "\n$EndEntities\n$Nodes\n";
+    s(1), s(4), s(1), s(4);
+    i(2), i(1), i(0), s(4);
+    s(1), s(2), s(3), s(4);
+    d(0), d(0), d(0), d(1), d(0), d(0), d(1), d(1), d(0), d(0), d(1), d(0);
+    content += "\n$EndNodes\n$Elements\n";
+    s(4), s(4), s(1), s(4);
+    i(0), i(1), i(15), s(1), s(1), s(1);
+    i(1), i(1), i(1), s(1), s(2), s(1), s(2);
+    i(2), i(1), i(2), s(1), s(3), s(1), s(2), s(3);
+    i(2), i(2), i(2), s(1), s(4), s(1), s(3), s(4);
+    content += "\n$EndElements\n";
+
+    write(content);
+    checkMesh();
+
+    // Truncated files are detected.
+    write(content.substr(0, content.size() - 40));
+    EXPECT_ANY_THROW(FileIO::GMSH::readGMSHMesh(_file_name));
+}
+
+TEST_F(GmshReaderTest, UnsupportedVersion)
+{
+    write("$MeshFormat\n4 0 8\n$EndMeshFormat\n");
+    EXPECT_EQ(nullptr, FileIO::GMSH::readGMSHMesh(_file_name));
+}
@@ -0,0 +1,170 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "MaterialLib/SolidModels/CreepBGRa.h"
+#include "MaterialLib/SolidModels/Ehlers.h"
+#include "MaterialLib/SolidModels/Lubby2.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Node.h"
+#include "ProcessLib/Parameter/ConstantParameter.h"
+#include "ProcessLib/Parameter/SpatialPosition.h"
+
+using namespace MaterialLib::Solids;
+using P = ProcessLib::ConstantParameter<double>;
+
+namespace
+{
+template <int DisplacementDim>
+typename MechanicsBase<DisplacementDim>::KelvinVectors strains()
+{
+    using KelvinVector = typename MechanicsBase<DisplacementDim>::KelvinVector;
+
+    KelvinVector direction;
+    if (DisplacementDim == 2)
+        direction << -1, 0.3, 0.1, 0.5;
+    else
+        direction << -1, 0.3, 0.1, 0.5, 0.2, 0.4;
+
+    // From elastic to plastic integration points of the Ehlers model.
+    typename MechanicsBase<DisplacementDim>::KelvinVectors eps;
+    for (double const scale : {1e-6, 1e-4, 3e-4, 5e-4})
+        eps.push_back(scale * direction);
+    return eps;
+}
+
+// Checks that integrateStressBatch() yields the same results as
+// integrateStress() called for each integration point separately.
+template <int DisplacementDim>
+void checkStressBatch(MechanicsBase<DisplacementDim> const& model,
+                      double const dt, double const T)
+{
+    using Model = MechanicsBase<DisplacementDim>;
+    using KelvinVector = typename Model::KelvinVector;
+
+    std::array<MeshLib::Node, 4> nodes{{MeshLib::Node(0, 0, 0),
+                                        MeshLib::Node(1, 0, 0),
+                                        MeshLib::Node(1, 1, 0),
+                                        MeshLib::Node(0, 1, 0)}};
+    std::array<MeshLib::Node*, 4> const node_pointers{
+        {&nodes[0], &nodes[1], &nodes[2], &nodes[3]}};
+    MeshLib::Quad const element(node_pointers, 3);
+
+    auto const eps = strains<DisplacementDim>();
+    auto const n_integration_points = eps.size();
+    KelvinVector const zero = KelvinVector::Zero();
+
+    std::vector<std::unique_ptr<typename Model::MaterialStateVariables>>
+        states;
+    typename Model::StressBatch batch;
+    batch.resize(n_integration_points);
+    for (std::size_t ip = 0; ip < n_integration_points; ++ip)
+    {
+        states.push_back(model.createMaterialStateVariables());
+        // Initializes the previous state like at the beginning of a time
+        // step.
+        states.back()->pushBackState();
+        batch.eps_prev[ip] = zero;
+        batch.eps[ip] = eps[ip];
+        batch.sigma_prev[ip] = zero;
+        batch.material_state_variables[ip] = states[ip].get();
+    }
+
+    ASSERT_TRUE(model.integrateStressBatch(0, element, dt, batch, T));
+
+    ProcessLib::SpatialPosition x_position;
+    x_position.setElementID(element.getID());
+    for (std::size_t ip = 0; ip < n_integration_points; ++ip)
+    {
+        x_position.setIntegrationPoint(ip);
+        auto const solution =
+            model.integrateStress(0, x_position, dt, zero, eps[ip], zero,
+                                  *states[ip], T);
+        ASSERT_TRUE(solution != boost::none);
+
+        auto const& sigma = std::get<0>(*solution);
+        auto const& state = *std::get<1>(*solution);
+        auto const& C = std::get<2>(*solution);
+        EXPECT_NEAR(0, (batch.sigma[ip] - sigma).norm(),
+                    1e-12 * sigma.norm());
+        EXPECT_NEAR(0, (batch.C[ip] - C).norm(), 1e-12 * C.norm());
+
+        // The states are compared by their effect on the free energy.
+        ASSERT_NE(nullptr, batch.material_state_variables_new[ip]);
+        EXPECT_DOUBLE_EQ(
+            model.computeFreeEnergyDensity(0, x_position, dt, eps[ip], sigma,
+                                           state),
+            model.computeFreeEnergyDensity(
+                0, x_position, dt, eps[ip], sigma,
+                *batch.material_state_variables_new[ip]));
+    }
+
+    // The state objects owned by the batch are reused.
+    auto const* const new_state = batch.material_state_variables_new[0].get();
+    ASSERT_TRUE(model.integrateStressBatch(0, element, dt, batch, T));
+    ASSERT_EQ(new_state, batch.material_state_variables_new[0].get());
+}
+}  // namespace
+
+TEST(MaterialLibSolidModels, StressBatchCreepBGRa)
+{
+    P const E("E", 7.65e9);
+    P const nu("nu", 0.27);
+    P const A("A", 2.0833333333333333e-6);
+    P const n("n", 4.9);
+    P const sigma_f("sigma_f", 1e6);
+    P const Q("Q", 54000);
+
+    Creep::CreepBGRa<3> const model({E, nu}, {1000, 2e-8}, A, n, sigma_f, Q);
+    checkStressBatch(model, 86400, 310);
+}
+
+TEST(MaterialLibSolidModels, StressBatchEhlers)
+{
+    P const G("G", 150);
+    P const K("K", 200);
+    P const kappa("kappa", 0.1);
+    P const beta("beta", 0.095);
+    P const gamma("gamma", 1);
+    P const hardening("hardening", 0);
+    P const alpha("alpha", 0.01);
+    P const delta("delta", 0.0078);
+    P const epsilon("epsilon", 0.1);
+    P const m("m", 0.54);
+    P const beta_p("beta_p", 0.0608);
+
+    Ehlers::SolidEhlers<3> const model(
+        {100, 1e-14},
+        {G, K, alpha, beta, gamma, delta, epsilon, m, alpha, beta_p, gamma,
+         delta, epsilon, m, kappa, hardening},
+        nullptr);
+    checkStressBatch(model, 1, 293);
+}
+
+TEST(MaterialLibSolidModels, StressBatchLubby2)
+{
+    P const GK0("GK0", 0.8);
+    P const etaK0("etaK0", 0.5);
+    P const GM0("GM0", 0.8);
+    P const KM0("KM0", 0.8);
+    P const etaM0("etaM0", 0.5);
+    P const mK("mK", -0.2);
+    P const mvK("mvK", -0.2);
+    P const mvM("mvM", -0.3);
+
+    Lubby2::Lubby2MaterialProperties material_properties(
+        GK0, GM0, KM0, etaK0, etaM0, mK, mvK, mvM);
+    Lubby2::Lubby2<2> const model({20, 1e-10}, material_properties);
+    checkStressBatch(model, 0.1, 293);
+}
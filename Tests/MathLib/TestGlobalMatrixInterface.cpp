@@ -232,4 +232,48 @@ TEST(Math, CheckInterface_EigenMatrix)
     MathLib::EigenMatrix m(10);
     checkGlobalMatrixInterface(m);
 }
+
+TEST(Math, EigenMatrixAddWithCachedValueOffsets)
+{
+    using Indices = MathLib::RowColumnIndices<GlobalIndexType>;
+    std::vector<GlobalIndexType> const element_0 = {0, 1, 2};
+    std::vector<GlobalIndexType> const element_1 = {2, 3, 4};
+    MathLib::DenseMatrix<double> local_m(3, 3);
+    for (std::size_t i = 0; i < 3; i++)
+        for (std::size_t j = 0; j < 3; j++)
+            local_m(i, j) = 1.0 + i + 3 * j;
+
+    MathLib::EigenMatrix cached(5);
+    MathLib::EigenMatrix reference(5);
+    auto const assemble = [&]() {
+        cached.setZero();
+        cached.add(0, Indices(element_0, element_0), local_m);
+        cached.add(1, Indices(element_1, element_1), local_m);
+        finalizeAssembly(cached);
+
+        reference.setZero();
+        reference.add(Indices(element_0, element_0), local_m);
+        reference.add(Indices(element_1, element_1), local_m);
+        finalizeAssembly(reference);
+    };
+
+    // The first assembly inserts the entries, the second fills the cache and
+    // the third uses it.
+    for (int iteration = 0; iteration < 3; iteration++)
+    {
+        assemble();
+        for (GlobalIndexType i = 0; i < 5; i++)
+            for (GlobalIndexType j = 0; j < 5; j++)
+                ASSERT_EQ(reference.get(i, j), cached.get(i, j));
+    }
+
+    // A new entry changes the structure and thus invalidates the cache.
+    cached.add(4, 0, 0.0);
+    reference.add(4, 0, 0.0);
+    assemble();
+    assemble();
+    for (GlobalIndexType i = 0; i < 5; i++)
+        for (GlobalIndexType j = 0; j < 5; j++)
+            ASSERT_EQ(reference.get(i, j), cached.get(i, j));
+}
 #endif
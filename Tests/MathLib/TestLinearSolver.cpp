@@ -226,6 +226,136 @@ TEST(Math, CheckInterface_Eigen)
 }
 #endif
 
+#ifdef OGS_USE_EIGEN
+namespace
+{
+// Solves a sequence of slowly changing systems with the same sparsity pattern
+// and checks the solutions against a dense solver.
+void checkEigenFactorizationReuse(std::string const& solver_type,
+                                  std::string const& precon_type,
+                                  std::size_t const expected_saved_factorizations)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", solver_type);
+    t_solver.put("precon_type", precon_type);
+    t_solver.put("error_tolerance", 1e-12);
+    t_solver.put("max_iteration_step", 1000);
+    t_solver.put("max_factorization_reuse", 3);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "",
+        BaseLib::ConfigTree::onerror, BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+
+    std::size_t const n = 20;
+    std::size_t const number_of_solves = 8;
+    MathLib::EigenMatrix A(n);
+    MathLib::EigenVector b(n);
+    MathLib::EigenVector x(n);
+    for (std::size_t k = 0; k < number_of_solves; ++k)
+    {
+        // Discrete 1D Laplacian plus a slowly growing diagonal shift.
+        A.setZero();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            A.add(i, i, 2.0 + 1e-5 * k);
+            if (i > 0)
+                A.add(i, i - 1, -1.0);
+            if (i + 1 < n)
+                A.add(i, i + 1, -1.0);
+            b.set(i, 1.0 + i);
+        }
+        MathLib::finalizeMatrixAssembly(A);
+
+        ASSERT_TRUE(ls.solve(A, b, x));
+
+        Eigen::VectorXd const expected =
+            Eigen::MatrixXd(A.getRawMatrix()).lu().solve(b.getRawVector());
+        ASSERT_ARRAY_NEAR(expected.data(), x.getRawVector().data(), n,
+                          1e-8 * expected.norm());
+    }
+
+    ASSERT_EQ(number_of_solves - 1, ls.getNumberOfSavedAnalyses());
+    ASSERT_EQ(expected_saved_factorizations,
+              ls.getNumberOfSavedFactorizations());
+}
+}  // namespace
+
+TEST(Math, EigenFactorizationReuse_SparseLU)
+{
+    // Three reuses after each of the factorizations in the first and the
+    // fifth solve.
+    checkEigenFactorizationReuse("SparseLU", "NONE", 6);
+}
+
+TEST(Math, EigenFactorizationReuse_BiCGSTAB_ILUT)
+{
+    checkEigenFactorizationReuse("BiCGSTAB", "ILUT", 6);
+}
+
+TEST(Math, EigenApplyKnownSolution)
+{
+    std::size_t const n = 6;
+    std::vector<MathLib::EigenMatrix::IndexType> const bc_ids = {4, 1};
+    MathLib::EigenMatrix assembled(n);
+    MathLib::EigenMatrix A(n);
+    MathLib::EigenVector b(n);
+    MathLib::EigenVector x(n);
+
+    // Like in the nonlinear solvers the assembled matrix is copied before the
+    // known solutions are applied. The later copies keep the cached column
+    // entries.
+    for (int k = 0; k < 3; ++k)
+    {
+        // Non-symmetric matrix with a zero diagonal entry in row 4, which is
+        // missing in the first assembly.
+        assembled.setZero();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (i != 4)
+                assembled.add(i, i, 4.0 + k);
+            else if (k > 0)
+                assembled.add(i, i, 0.0);
+            assembled.add(i, (i + 1) % n, -1.0 - i);
+            assembled.add(i, (i + 3) % n, 0.5 * i);
+            b.set(i, 1.0 + i);
+        }
+        MathLib::LinAlg::finalizeAssembly(assembled);
+        A = assembled;
+        std::vector<double> const bc_values = {2.0 + k, -3.0};
+
+        // Dense reference of the symmetric elimination.
+        Eigen::MatrixXd expected_A(A.getRawMatrix());
+        Eigen::VectorXd expected_b = b.getRawVector();
+        for (auto const id : bc_ids)
+        {
+            auto const diagonal = expected_A(id, id);
+            expected_A.row(id).setZero();
+            expected_A(id, id) = diagonal;
+        }
+        for (std::size_t ix = 0; ix < bc_ids.size(); ++ix)
+        {
+            auto const id = bc_ids[ix];
+            auto const diagonal = expected_A(id, id);
+            expected_b -= expected_A.col(id) * bc_values[ix];
+            expected_A.col(id).setZero();
+            expected_A(id, id) = diagonal != 0.0 ? diagonal : 1.0;
+            expected_b[id] = bc_values[ix] * expected_A(id, id);
+        }
+
+        MathLib::applyKnownSolution(A, b, x, bc_ids, bc_values);
+
+        ASSERT_TRUE(A.getRawMatrix().isCompressed());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ASSERT_EQ(expected_b[i], b.get(i));
+            for (std::size_t j = 0; j < n; ++j)
+                ASSERT_EQ(expected_A(i, j), A.get(i, j));
+        }
+    }
+}
+#endif
+
 #if defined(OGS_USE_EIGEN) && defined(USE_LIS)
 TEST(Math, CheckInterface_EigenLis)
 {
@@ -243,6 +373,50 @@ TEST(Math, CheckInterface_EigenLis)
 }
 #endif
 
+#if defined(OGS_USE_EIGEN) && defined(USE_LIS)
+TEST(Math, EigenLisPreconditionerReuse)
+{
+    boost::property_tree::ptree t_root;
+    t_root.put("lis", "-i bicgstab -p ilu -tol 1e-12 -maxiter 1000");
+    t_root.put("lis_max_preconditioner_reuse", 3);
+    BaseLib::ConfigTree conf(t_root, "",
+        BaseLib::ConfigTree::onerror, BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLisLinearSolver ls("dummy_name", &conf);
+
+    std::size_t const n = 20;
+    std::size_t const number_of_solves = 8;
+    MathLib::EigenMatrix A(n);
+    MathLib::EigenVector b(n);
+    MathLib::EigenVector x(n);
+    for (std::size_t k = 0; k < number_of_solves; ++k)
+    {
+        // Discrete 1D Laplacian plus a slowly growing diagonal shift.
+        A.setZero();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            A.add(i, i, 2.0 + 1e-5 * k);
+            if (i > 0)
+                A.add(i, i - 1, -1.0);
+            if (i + 1 < n)
+                A.add(i, i + 1, -1.0);
+            b.set(i, 1.0 + i);
+        }
+        MathLib::finalizeMatrixAssembly(A);
+
+        ASSERT_TRUE(ls.solve(A, b, x));
+
+        Eigen::VectorXd const expected =
+            Eigen::MatrixXd(A.getRawMatrix()).lu().solve(b.getRawVector());
+        ASSERT_ARRAY_NEAR(expected.data(), x.getRawVector().data(), n,
+                          1e-8 * expected.norm());
+    }
+
+    // Three reuses after each of the preconditioners computed in the first
+    // and the fifth solve.
+    ASSERT_EQ(6u, ls.getNumberOfSavedPreconditioners());
+}
+#endif
+
 #ifdef USE_PETSC
 TEST(MPITest_Math, CheckInterface_PETSc_Linear_Solver_basic)
 {
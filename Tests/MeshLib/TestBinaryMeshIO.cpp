@@ -0,0 +1,166 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/Binary/BinaryMeshIO.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/QuadraticMeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+void expectEqualMeshes(MeshLib::Mesh const& expected,
+                       MeshLib::Mesh const& actual)
+{
+    EXPECT_EQ(expected.getName(), actual.getName());
+    ASSERT_EQ(expected.getNumberOfNodes(), actual.getNumberOfNodes());
+    EXPECT_EQ(expected.getNumberOfBaseNodes(), actual.getNumberOfBaseNodes());
+    ASSERT_EQ(expected.getNumberOfElements(), actual.getNumberOfElements());
+
+    for (std::size_t i = 0; i < expected.getNumberOfNodes(); ++i)
+    {
+        for (int d = 0; d < 3; ++d)
+        {
+            EXPECT_EQ((*expected.getNode(i))[d], (*actual.getNode(i))[d]);
+        }
+    }
+
+    for (std::size_t e = 0; e < expected.getNumberOfElements(); ++e)
+    {
+        auto const& expected_element = *expected.getElement(e);
+        auto const& actual_element = *actual.getElement(e);
+        ASSERT_EQ(expected_element.getCellType(), actual_element.getCellType());
+        for (unsigned k = 0; k < expected_element.getNumberOfNodes(); ++k)
+        {
+            EXPECT_EQ(expected_element.getNodeIndex(k),
+                      actual_element.getNodeIndex(k));
+        }
+    }
+}
+
+template <typename T>
+void expectEqualProperties(MeshLib::Mesh const& expected,
+                           MeshLib::Mesh const& actual,
+                           std::string const& name)
+{
+    auto const& expected_property =
+        *expected.getProperties().getPropertyVector<T>(name);
+    ASSERT_TRUE(actual.getProperties().existsPropertyVector<T>(name));
+    auto const& actual_property =
+        *actual.getProperties().getPropertyVector<T>(name);
+    EXPECT_EQ(expected_property.getMeshItemType(),
+              actual_property.getMeshItemType());
+    EXPECT_EQ(expected_property.getNumberOfComponents(),
+              actual_property.getNumberOfComponents());
+    EXPECT_EQ(static_cast<std::vector<T> const&>(expected_property),
+              static_cast<std::vector<T> const&>(actual_property));
+}
+}  // namespace
+
+TEST(MeshLibBinaryMeshIO, WriteAndReadMeshWithProperties)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(2.0, 3));
+
+    std::vector<int> material_ids(mesh->getNumberOfElements());
+    for (std::size_t i = 0; i < material_ids.size(); ++i)
+    {
+        material_ids[i] = static_cast<int>(i % 3);
+    }
+    MeshLib::addPropertyToMesh(*mesh, "MaterialIDs",
+                               MeshLib::MeshItemType::Cell, 1, material_ids);
+    std::vector<double> displacement(3 * mesh->getNumberOfNodes());
+    for (std::size_t i = 0; i < displacement.size(); ++i)
+    {
+        displacement[i] = 0.5 * i - 1;
+    }
+    MeshLib::addPropertyToMesh(*mesh, "displacement",
+                               MeshLib::MeshItemType::Node, 3, displacement);
+    std::vector<std::size_t> bulk_ids(mesh->getNumberOfNodes());
+    for (std::size_t i = 0; i < bulk_ids.size(); ++i)
+    {
+        bulk_ids[i] = 2 * i;
+    }
+    MeshLib::addPropertyToMesh(*mesh, "bulk_node_ids",
+                               MeshLib::MeshItemType::Node, 1, bulk_ids);
+
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "MeshLibBinaryMeshIO.bmsh";
+    ASSERT_EQ(0, MeshLib::IO::writeMeshToFile(*mesh, file_name));
+
+    std::unique_ptr<MeshLib::Mesh> const read_mesh(
+        MeshLib::IO::readMeshFromFile(file_name));
+    ASSERT_TRUE(read_mesh != nullptr);
+
+    expectEqualMeshes(*mesh, *read_mesh);
+    expectEqualProperties<int>(*mesh, *read_mesh, "MaterialIDs");
+    expectEqualProperties<double>(*mesh, *read_mesh, "displacement");
+    expectEqualProperties<std::size_t>(*mesh, *read_mesh, "bulk_node_ids");
+
+    std::remove(file_name.c_str());
+}
+
+TEST(MeshLibBinaryMeshIO, WriteAndReadQuadraticMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const linear_mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+    auto const mesh = MeshLib::createQuadraticOrderMesh(*linear_mesh);
+
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "MeshLibBinaryQuadraticMesh.bmsh";
+    ASSERT_TRUE(MeshLib::IO::Binary::writeBinaryMesh(*mesh, file_name));
+
+    std::unique_ptr<MeshLib::Mesh> const read_mesh(
+        MeshLib::IO::Binary::readBinaryMesh(file_name));
+    ASSERT_TRUE(read_mesh != nullptr);
+    expectEqualMeshes(*mesh, *read_mesh);
+
+    std::remove(file_name.c_str());
+}
+
+TEST(MeshLibBinaryMeshIO, RejectInvalidFiles)
+{
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "MeshLibBinaryInvalid.bmsh";
+
+    {
+        std::ofstream os(file_name, std::ios::binary);
+        os << "not a binary mesh";
+    }
+    EXPECT_EQ(nullptr, MeshLib::IO::Binary::readBinaryMesh(file_name));
+
+    // A truncated file.
+    {
+        std::unique_ptr<MeshLib::Mesh> const mesh(
+            MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 2));
+        ASSERT_TRUE(MeshLib::IO::Binary::writeBinaryMesh(*mesh, file_name));
+        std::ifstream is(file_name, std::ios::binary);
+        std::string const content((std::istreambuf_iterator<char>(is)),
+                                  std::istreambuf_iterator<char>());
+        is.close();
+        std::ofstream os(file_name, std::ios::binary);
+        os.write(content.data(), content.size() / 2);
+    }
+    EXPECT_ANY_THROW(MeshLib::IO::Binary::readBinaryMesh(file_name));
+
+    std::remove(file_name.c_str());
+}
@@ -0,0 +1,77 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/Legacy/MeshIO.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+TEST(MeshLibLegacyMeshIO, WriteAndReadMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(30., 20., 30, 20));
+    auto* const material_ids =
+        mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    for (std::size_t i = 0; i < mesh->getNumberOfElements(); ++i)
+    {
+        material_ids->push_back(static_cast<int>(i % 3));
+    }
+
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "MeshLibLegacyMeshIO.msh";
+    MeshLib::IO::Legacy::MeshIO writer;
+    writer.setMesh(mesh.get());
+    ASSERT_EQ(1, writer.writeToFile(file_name));
+
+    MeshLib::IO::Legacy::MeshIO reader;
+    std::unique_ptr<MeshLib::Mesh> const read_mesh(
+        reader.loadMeshFromFile(file_name));
+    ASSERT_TRUE(read_mesh != nullptr);
+    ASSERT_EQ(mesh->getNumberOfNodes(), read_mesh->getNumberOfNodes());
+    ASSERT_EQ(mesh->getNumberOfElements(), read_mesh->getNumberOfElements());
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            ASSERT_EQ((*mesh->getNode(i))[k], (*read_mesh->getNode(i))[k]);
+        }
+    }
+    auto const& read_material_ids =
+        *read_mesh->getProperties().getPropertyVector<int>("MaterialIDs");
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+    {
+        auto const& element = *mesh->getElement(e);
+        auto const& read_element = *read_mesh->getElement(e);
+        ASSERT_EQ(element.getGeomType(), read_element.getGeomType());
+        for (unsigned k = 0; k < element.getNumberOfNodes(); ++k)
+        {
+            ASSERT_EQ(element.getNodeIndex(k), read_element.getNodeIndex(k));
+        }
+        ASSERT_EQ((*material_ids)[e], read_material_ids[e]);
+    }
+
+    // An element referring to a non-existing node is rejected.
+    {
+        std::ofstream out(file_name);
+        out << "#FEM_MSH\n$NODES\n 2\n0 0 0 0\n1 1 0 0\n"
+               "$ELEMENTS\n 1\n0 0 line 0 2\n#STOP\n";
+    }
+    EXPECT_EQ(nullptr, reader.loadMeshFromFile(file_name));
+    std::remove(file_name.c_str());
+}
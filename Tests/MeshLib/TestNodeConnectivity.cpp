@@ -0,0 +1,123 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/NodePartitionedMesh.h"
+
+namespace
+{
+// Computes the elements connected to each node by brute force.
+std::vector<std::vector<MeshLib::Element const*>> elementsConnectedToNodes(
+    MeshLib::Mesh const& mesh)
+{
+    std::vector<std::vector<MeshLib::Element const*>> elements(
+        mesh.getNumberOfNodes());
+    for (auto const* e : mesh.getElements())
+        for (unsigned i = 0; i < e->getNumberOfNodes(); ++i)
+            elements[e->getNodeIndex(i)].push_back(e);
+    return elements;
+}
+
+void checkElementsConnectedToNodes(MeshLib::Mesh const& mesh)
+{
+    auto const expected = elementsConnectedToNodes(mesh);
+    for (auto const* node : mesh.getNodes())
+    {
+        auto const elements = node->getElements();
+        auto const& expected_elements = expected[node->getID()];
+        ASSERT_EQ(expected_elements.size(), elements.size());
+        ASSERT_EQ(expected_elements.size(), node->getNumberOfElements());
+        ASSERT_TRUE(std::equal(expected_elements.begin(),
+                               expected_elements.end(), elements.begin()));
+    }
+}
+
+void checkNodesConnectedByElements(MeshLib::Mesh const& mesh)
+{
+    auto const expected = elementsConnectedToNodes(mesh);
+    for (auto const* node : mesh.getNodes())
+    {
+        std::vector<std::size_t> expected_ids;
+        for (auto const* e : expected[node->getID()])
+            for (unsigned i = 0; i < e->getNumberOfNodes(); ++i)
+                expected_ids.push_back(e->getNodeIndex(i));
+        std::sort(expected_ids.begin(), expected_ids.end());
+        expected_ids.erase(
+            std::unique(expected_ids.begin(), expected_ids.end()),
+            expected_ids.end());
+
+        auto const connected_nodes = node->getConnectedNodes();
+        ASSERT_EQ(expected_ids.size(), connected_nodes.size());
+        for (std::size_t i = 0; i < expected_ids.size(); ++i)
+        {
+            ASSERT_EQ(expected_ids[i], connected_nodes[i]->getID());
+            // The connected nodes belong to the same mesh.
+            ASSERT_EQ(mesh.getNode(expected_ids[i]), connected_nodes[i]);
+        }
+    }
+}
+}  // namespace
+
+TEST(MeshLib, NodeConnectivityHexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 4));
+
+    checkElementsConnectedToNodes(*mesh);
+    checkNodesConnectedByElements(*mesh);
+
+    // Interior node of a structured hex mesh.
+    auto const* const interior_node = mesh->getNode(1 + 5 * (1 + 5 * 1));
+    ASSERT_EQ(8u, interior_node->getNumberOfElements());
+    ASSERT_EQ(27u, interior_node->getConnectedNodes().size());
+}
+
+TEST(MeshLib, NodeConnectivityCopiedMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(1.0, 5));
+
+    MeshLib::Mesh const mesh_copy(*mesh);
+    checkElementsConnectedToNodes(mesh_copy);
+    for (auto const* node : mesh_copy.getNodes())
+        for (auto const* e : node->getElements())
+            ASSERT_EQ(mesh_copy.getElement(e->getID()), e);
+
+    MeshLib::NodePartitionedMesh const partitioned_mesh(*mesh);
+    checkElementsConnectedToNodes(partitioned_mesh);
+    checkNodesConnectedByElements(partitioned_mesh);
+
+    // The copies stay valid after the original mesh is gone.
+    mesh.reset();
+    checkNodesConnectedByElements(partitioned_mesh);
+}
+
+TEST(MeshLib, NodeConnectivityAddedElements)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+
+    // The clones share the nodes of the original elements.
+    std::vector<MeshLib::Element*> new_elements;
+    for (auto const* e : mesh->getElements())
+        new_elements.push_back(e->clone());
+    mesh->addElements(new_elements);
+
+    ASSERT_EQ(32u, mesh->getNumberOfElements());
+    checkElementsConnectedToNodes(*mesh);
+}
@@ -0,0 +1,91 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/IO/VtkIO/PVDFile.h"
+
+namespace
+{
+std::string readFile(std::string const& file_name)
+{
+    std::ifstream is(file_name);
+    return {std::istreambuf_iterator<char>(is),
+            std::istreambuf_iterator<char>()};
+}
+
+std::string const header =
+    "<?xml version=\"1.0\"?>\n"
+    "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\""
+    " compressor=\"vtkZLibDataCompressor\">\n"
+    "  <Collection>\n";
+std::string const footer = "  </Collection>\n</VTKFile>\n";
+
+std::string dataSet(std::string const& time, std::string const& file_name)
+{
+    return "    <DataSet timestep=\"" + time +
+           "\" group=\"\" part=\"0\" file=\"" + file_name + "\"/>\n";
+}
+}  // namespace
+
+TEST(MeshLibPVDFile, WriteAndContinue)
+{
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "MeshLibPVDFile.pvd";
+
+    {
+        MeshLib::IO::PVDFile pvd(file_name);
+        pvd.addVTUFile("a_0.vtu", 0);
+        ASSERT_EQ(header + dataSet("0", "a_0.vtu") + footer,
+                  readFile(file_name));
+
+        pvd.addVTUFile("a_1.vtu", 0.5);
+        ASSERT_EQ(header + dataSet("0", "a_0.vtu") +
+                      dataSet("0.5", "a_1.vtu") + footer,
+                  readFile(file_name));
+    }
+
+    {
+        // Restart: the existing data sets are kept.
+        MeshLib::IO::PVDFile pvd(file_name);
+        pvd.continueExisting(0.5);
+        pvd.addVTUFile("a_2.vtu", 1);
+        ASSERT_EQ(header + dataSet("0", "a_0.vtu") +
+                      dataSet("0.5", "a_1.vtu") + dataSet("1", "a_2.vtu") +
+                      footer,
+                  readFile(file_name));
+    }
+
+    {
+        // Restart from an earlier checkpoint: the data sets after the restart
+        // time are removed.
+        MeshLib::IO::PVDFile pvd(file_name);
+        pvd.continueExisting(0);
+        pvd.addVTUFile("a_1b.vtu", 0.25);
+        ASSERT_EQ(header + dataSet("0", "a_0.vtu") +
+                      dataSet("0.25", "a_1b.vtu") + footer,
+                  readFile(file_name));
+    }
+
+    {
+        // Without continuation the file is overwritten.
+        MeshLib::IO::PVDFile pvd(file_name);
+        pvd.addVTUFile("b_0.vtu", 2);
+        ASSERT_EQ(header + dataSet("2", "b_0.vtu") + footer,
+                  readFile(file_name));
+    }
+
+    std::remove(file_name.c_str());
+}
@@ -370,3 +370,28 @@ TEST_F(InSituMesh, DISABLED_MappedMeshSourceRoundtrip)
         }
     }
 }
+
+// Maps a snapshot of the properties instead of the mesh's own ones.
+TEST_F(InSituMesh, MappedMeshSourceWithPropertiesSnapshot)
+{
+    ASSERT_TRUE(mesh != nullptr);
+    MeshLib::Properties const snapshot = mesh->getProperties();
+
+    // Changes after the snapshot must not show up in the output.
+    auto& point_double_properties =
+        *mesh->getProperties().getPropertyVector<double>("PointDoubleProperty");
+    point_double_properties[0] = -1.0;
+
+    vtkNew<MeshLib::VtkMappedMeshSource> vtkSource;
+    vtkSource->SetMesh(mesh);
+    vtkSource->SetProperties(&snapshot);
+    vtkSource->Update();
+    vtkUnstructuredGrid* output = vtkSource->GetOutput();
+
+    ASSERT_EQ((subdivisions+1)*(subdivisions+1)*(subdivisions+1), output->GetNumberOfPoints());
+    ASSERT_EQ(subdivisions*subdivisions*subdivisions, output->GetNumberOfCells());
+
+    vtkDataArray* pointDoubleArray = output->GetPointData()->GetScalars("PointDoubleProperty");
+    ASSERT_EQ(pointDoubleArray->GetSize(), mesh->getNumberOfNodes());
+    ASSERT_EQ(1.0, pointDoubleArray->GetComponent(0, 0));
+}
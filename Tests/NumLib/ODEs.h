@@ -37,6 +37,22 @@ public:
         MathLib::setVector(b, { 0.0, 0.0 });
     }
 
+    void assembleLinearTimeInvariant(const double t, GlobalVector const& x,
+                                     GlobalMatrix& M, GlobalMatrix& K,
+                                     GlobalVector& b,
+                                     bool const assemble_matrices) override
+    {
+        if (assemble_matrices)
+        {
+            assemble(t, x, M, K, b);
+            ++number_of_matrix_assemblies;
+        }
+        else
+        {
+            MathLib::setVector(b, {0.0, 0.0});
+        }
+    }
+
     void assembleWithJacobian(const double t, GlobalVector const& x_curr,
                               GlobalVector const& /*xdot*/,
                               const double dxdot_dx, const double dx_dx,
@@ -58,6 +74,33 @@ public:
         }
     }
 
+    void assembleResidualWithJacobian(const double t,
+                                      GlobalVector const& x_curr,
+                                      GlobalVector const& xdot,
+                                      const double dxdot_dx,
+                                      const double dx_dx, GlobalVector& res,
+                                      GlobalMatrix& Jac) override
+    {
+        namespace LinAlg = MathLib::LinAlg;
+        using MatrixTraits = MathLib::MatrixVectorTraits<GlobalMatrix>;
+        using VectorTraits = MathLib::MatrixVectorTraits<GlobalVector>;
+
+        auto const spec = getMatrixSpecifications(0);
+        auto M = MatrixTraits::newInstance(spec);
+        auto K = MatrixTraits::newInstance(spec);
+        auto b = VectorTraits::newInstance(spec);
+        assembleWithJacobian(t, x_curr, xdot, dxdot_dx, dx_dx, *M, *K, *b,
+                             Jac);
+        LinAlg::finalizeAssembly(*K);
+        LinAlg::finalizeAssembly(*b);
+
+        // res = M * xdot + K * x_curr - b
+        LinAlg::matMult(*M, xdot, res);
+        LinAlg::matMultAdd(*K, x_curr, res, res);
+        LinAlg::axpy(res, -1.0, *b);
+        ++number_of_fused_assemblies;
+    }
+
     MathLib::MatrixSpecifications getMatrixSpecifications(
         const int /*process_id*/) const override
     {
@@ -70,6 +113,8 @@ public:
     }
 
     std::size_t const N = 2;
+    std::size_t number_of_matrix_assemblies = 0;
+    std::size_t number_of_fused_assemblies = 0;
 };
 
 template <>
@@ -0,0 +1,144 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "BaseLib/ConfigTree.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "NumLib/Checkpoint.h"
+#include "NumLib/ODESolver/TimeDiscretization.h"
+#include "NumLib/TimeStepping/Algorithms/EvolutionaryPIDcontroller.h"
+
+#include "Tests/TestTools.h"
+
+namespace
+{
+std::unique_ptr<GlobalVector> createVector(double const value)
+{
+    MathLib::MatrixSpecifications const spec(5, 5, nullptr, nullptr);
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    for (GlobalIndexType i = 0; i < 5; ++i)
+    {
+        x->set(i, value + i);
+    }
+    MathLib::LinAlg::finalizeAssembly(*x);
+    return x;
+}
+
+std::unique_ptr<NumLib::TimeStepAlgorithm> createPIDController()
+{
+    const char xml[] =
+        "<time_stepping>"
+        "   <type>EvolutionaryPIDcontroller</type>"
+        "   <t_initial> 0.0 </t_initial>"
+        "   <t_end> 10 </t_end>"
+        "   <dt_guess> 0.01 </dt_guess>"
+        "   <dt_min> 0.001 </dt_min>"
+        "   <dt_max> 1 </dt_max>"
+        "   <rel_dt_min> 0.01 </rel_dt_min>"
+        "   <rel_dt_max> 5 </rel_dt_max>"
+        "   <tol> 1.e-3 </tol>"
+        "   <fixed_output_times> 0.2 0.5 </fixed_output_times>"
+        "</time_stepping>";
+    auto const ptree = readXml(xml);
+    BaseLib::ConfigTree conf(ptree, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    return NumLib::createEvolutionaryPIDcontroller(
+        conf.getConfigSubtree("time_stepping"));
+}
+
+struct NoMatrixStorage final : public NumLib::InternalMatrixStorage
+{
+    void pushMatrices() const override {}
+};
+}  // namespace
+
+#ifndef USE_PETSC
+TEST(NumLibCheckpoint, BackwardDifferentiationFormula)
+#else
+TEST(NumLibCheckpoint, DISABLED_BackwardDifferentiationFormula)
+#endif
+{
+    NoMatrixStorage const no_matrix_storage;
+    NumLib::BackwardDifferentiationFormula bdf(3);
+    bdf.setInitialState(0.0, *createVector(0.0));
+    // More steps than the order, s.t. the history is a full circular buffer.
+    for (int step = 1; step <= 4; ++step)
+    {
+        bdf.nextTimestep(0.1 * step, 0.1);
+        bdf.pushState(0.1 * step, *createVector(step * step),
+                      no_matrix_storage);
+    }
+
+    std::stringstream checkpoint;
+    bdf.writeCheckpoint(checkpoint);
+
+    NumLib::BackwardDifferentiationFormula restored_bdf(3);
+    restored_bdf.setInitialState(0.0, *createVector(-1.0));
+    restored_bdf.readCheckpoint(checkpoint);
+
+    ASSERT_EQ(bdf.getCurrentTime(), restored_bdf.getCurrentTime());
+
+    bdf.nextTimestep(0.5, 0.1);
+    restored_bdf.nextTimestep(0.5, 0.1);
+    ASSERT_EQ(bdf.getNewXWeight(), restored_bdf.getNewXWeight());
+
+    auto x_old = createVector(0.0);
+    auto restored_x_old = createVector(0.0);
+    bdf.getWeightedOldX(*x_old);
+    restored_bdf.getWeightedOldX(*restored_x_old);
+    for (GlobalIndexType i = 0; i < 5; ++i)
+    {
+        ASSERT_EQ(x_old->get(i), restored_x_old->get(i));
+    }
+
+    // A truncated checkpoint is detected.
+    std::stringstream truncated(checkpoint.str().substr(0, 20));
+    ASSERT_ANY_THROW(restored_bdf.readCheckpoint(truncated));
+}
+
+TEST(NumLibCheckpoint, EvolutionaryPIDcontroller)
+{
+    auto const stepper = createPIDController();
+    std::vector<double> const errors = {0, 1e-4, 5e-4, 2e-3, 1e-4, 8e-4,
+                                        3e-4, 1e-5, 6e-4, 2e-4};
+
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        stepper->next(errors[i]);
+    }
+
+    std::stringstream checkpoint;
+    stepper->writeCheckpoint(checkpoint);
+
+    // The time loop adds the output times before restoring the checkpoint;
+    // they are replaced by the ones not reached yet.
+    auto const restored_stepper = createPIDController();
+    restored_stepper->addFixedOutputTimes({0.03});
+    restored_stepper->readCheckpoint(checkpoint);
+
+    for (std::size_t i = 5; i < errors.size(); ++i)
+    {
+        ASSERT_EQ(stepper->next(errors[i]), restored_stepper->next(errors[i]));
+        auto const ts = stepper->getTimeStep();
+        auto const restored_ts = restored_stepper->getTimeStep();
+        ASSERT_EQ(ts.steps(), restored_ts.steps());
+        ASSERT_EQ(ts.previous(), restored_ts.previous());
+        ASSERT_EQ(ts.current(), restored_ts.current());
+        ASSERT_EQ(stepper->accepted(), restored_stepper->accepted());
+    }
+    ASSERT_EQ(stepper->getTimeStepSizeHistory(),
+              restored_stepper->getTimeStepSizeHistory());
+}
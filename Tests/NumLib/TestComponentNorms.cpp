@@ -112,6 +112,19 @@ void do_test(unsigned const num_components,
         compwise_total_norm = accumulate_finish_cb(compwise_total_norm);
 
         EXPECT_NEAR(total_norm, compwise_total_norm, tolerance);
+
+        // All components at once.
+        auto const nodal_indices =
+            NumLib::getNonGhostNodalIndices(dtd.dof_table, *dtd.mesh);
+        auto const component_norms =
+            NumLib::norms(*x, nodal_indices, norm_type);
+        ASSERT_EQ(num_components, component_norms.size());
+        for (unsigned comp = 0; comp < num_components; ++comp)
+        {
+            EXPECT_NEAR(
+                NumLib::norm(*x, comp, norm_type, dtd.dof_table, *dtd.mesh),
+                component_norms[comp], tolerance);
+        }
     }
 }
 
@@ -199,6 +199,29 @@ public:
                 &_extrapolator->getElementResiduals()};
     }
 
+    std::vector<std::unique_ptr<GlobalVector>> extrapolate(
+        std::vector<IntegrationPointValuesMethod> const& methods,
+        const double t, const GlobalVector& x) const
+    {
+        using Extrapolatables = decltype(
+            NumLib::makeExtrapolatable(_local_assemblers, methods.front()));
+        std::vector<Extrapolatables> extrapolatables;
+        for (auto const method : methods)
+            extrapolatables.push_back(
+                NumLib::makeExtrapolatable(_local_assemblers, method));
+
+        std::vector<NumLib::ExtrapolatableElementCollection const*>
+            extrapolatables_ptrs;
+        for (auto const& e : extrapolatables)
+            extrapolatables_ptrs.push_back(&e);
+
+        std::vector<std::unique_ptr<GlobalVector>> nodal_values;
+        _extrapolator->extrapolate(
+            std::vector<unsigned>(methods.size(), 1), extrapolatables_ptrs, t,
+            x, *_dof_table, nodal_values);
+        return nodal_values;
+    }
+
 private:
     unsigned const _integration_order;
 
@@ -308,3 +331,52 @@ TEST(NumLib, DISABLED_Extrapolation)
             *two_x, nnodes, nelements);
     }
 }
+
+#ifndef USE_PETSC
+TEST(NumLib, ExtrapolationMultipleProperties)
+#else
+TEST(NumLib, DISABLED_ExtrapolationMultipleProperties)
+#endif
+{
+    // Same as the Extrapolation test, but the stored and the derived quantity
+    // are extrapolated together in a single pass.
+    namespace LinAlg = MathLib::LinAlg;
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 5));
+    auto const nnodes = mesh->getNumberOfNodes();
+
+    for (unsigned integration_order : {2, 3})
+    {
+        ExtrapolationTest::ExtrapolationTestProcess pcs(*mesh,
+                                                        integration_order);
+
+        MathLib::MatrixSpecifications spec{nnodes, nnodes, nullptr, nullptr};
+        auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+        fillVectorRandomly(*x);
+        pcs.interpolateNodalValuesToIntegrationPoints(*x);
+
+        auto two_x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(*x);
+        LinAlg::axpy(*two_x, 1.0, *x);  // two_x = x + x
+
+        auto const nodal_values = pcs.extrapolate(
+            {&ExtrapolationTest::LocalAssemblerDataInterface::getStoredQuantity,
+             &ExtrapolationTest::LocalAssemblerDataInterface::
+                 getDerivedQuantity},
+            0.0, *x);
+        ASSERT_EQ(2u, nodal_values.size());
+
+        auto const tolerance_dx = 30.0 * std::numeric_limits<double>::epsilon();
+        std::vector<GlobalVector const*> const expected{x.get(), two_x.get()};
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            ASSERT_EQ(nnodes, nodal_values[i]->size());
+
+            auto delta_x =
+                MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
+                    *expected[i]);
+            LinAlg::axpy(*delta_x, -1.0, *nodal_values[i]);
+            EXPECT_GT(tolerance_dx, LinAlg::normMax(*delta_x));
+        }
+    }
+}
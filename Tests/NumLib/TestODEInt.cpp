@@ -52,6 +52,39 @@ struct Solution
     std::vector<GlobalVector> solutions;
 };
 
+// Only the Picard method supports time-invariant matrices.
+template <typename ODESystem>
+void setTimeInvariantMatrices(ODESystem& /*ode_sys*/,
+                              bool const time_invariant_matrices)
+{
+    ASSERT_FALSE(time_invariant_matrices);
+}
+
+void setTimeInvariantMatrices(
+    NumLib::TimeDiscretizedODESystem<
+        NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+        NumLib::NonlinearSolverTag::Picard>& ode_sys,
+    bool const time_invariant_matrices)
+{
+    ode_sys.setTimeInvariantMatrices(time_invariant_matrices);
+}
+
+// Only the Newton method supports the fused assembly.
+template <typename ODESystem>
+void setFusedAssembly(ODESystem& /*ode_sys*/, bool const fused_assembly)
+{
+    ASSERT_FALSE(fused_assembly);
+}
+
+void setFusedAssembly(
+    NumLib::TimeDiscretizedODESystem<
+        NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+        NumLib::NonlinearSolverTag::Newton>& ode_sys,
+    bool const fused_assembly)
+{
+    ode_sys.setFusedAssembly(fused_assembly);
+}
+
 template<NumLib::NonlinearSolverTag NLTag>
 class TestOutput
 {
@@ -71,6 +104,8 @@ public:
         const int process_id = 0;
         NumLib::TimeDiscretizedODESystem<ODE_::ODETag, NLTag>
                 ode_sys(process_id, ode, timeDisc);
+        setTimeInvariantMatrices(ode_sys, time_invariant_matrices);
+        setFusedAssembly(ode_sys, fused_assembly);
 
         auto linear_solver = createLinearSolver();
         auto conv_crit = std::make_unique<NumLib::ConvergenceCriterionDeltaX>(
@@ -113,6 +148,9 @@ public:
         return sol;
     }
 
+    bool time_invariant_matrices = false;
+    bool fused_assembly = false;
+
 private:
     const double _tol = 1e-9;
     const unsigned _maxiter = 20;
@@ -291,8 +329,72 @@ TYPED_TEST(NumLibODEIntTyped, DISABLED_T1)
 }
 
 
+#ifndef USE_PETSC
+TEST(NumLibODEInt, TimeInvariantMatrices)
+#else
+TEST(NumLibODEInt, DISABLED_TimeInvariantMatrices)
+#endif
+{
+    using Tag = NumLib::NonlinearSolverTag;
+    const unsigned num_timesteps = 100;
+
+    ODE1 ode;
+    NumLib::BackwardEuler time_disc;
+    TestOutput<Tag::Picard> test;
+    test.time_invariant_matrices = true;
+    auto const sol = test.run_test(ode, time_disc, num_timesteps);
+    ASSERT_EQ(1u, ode.number_of_matrix_assemblies);
+
+    auto const sol_reference =
+        run_test_case<NumLib::BackwardEuler, ODE1, Tag::Picard>(num_timesteps);
+
+    ASSERT_EQ(sol_reference.ts.size(), sol.ts.size());
+    for (std::size_t i = 0; i < sol.ts.size(); ++i)
+    {
+        ASSERT_EQ(sol_reference.ts[i], sol.ts[i]);
+        for (int comp = 0; comp < static_cast<int>(sol.solutions[i].size());
+             ++comp)
+        {
+            EXPECT_NEAR(sol_reference.solutions[i][comp],
+                        sol.solutions[i][comp], 1e-12);
+        }
+    }
+}
+
 /* TODO Other possible test cases:
  *
  * * check that the order of time discretization scales correctly
  *   with the timestep size
  */
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, FusedNewtonAssembly)
+#else
+TEST(NumLibODEInt, DISABLED_FusedNewtonAssembly)
+#endif
+{
+    using Tag = NumLib::NonlinearSolverTag;
+    const unsigned num_timesteps = 100;
+
+    ODE1 ode;
+    NumLib::BackwardEuler time_disc;
+    TestOutput<Tag::Newton> test;
+    test.fused_assembly = true;
+    auto const sol = test.run_test(ode, time_disc, num_timesteps);
+    ASSERT_LT(0u, ode.number_of_fused_assemblies);
+
+    auto const sol_reference =
+        run_test_case<NumLib::BackwardEuler, ODE1, Tag::Newton>(num_timesteps);
+
+    ASSERT_EQ(sol_reference.ts.size(), sol.ts.size());
+    for (std::size_t i = 0; i < sol.ts.size(); ++i)
+    {
+        ASSERT_EQ(sol_reference.ts[i], sol.ts[i]);
+        for (int comp = 0; comp < static_cast<int>(sol.solutions[i].size());
+             ++comp)
+        {
+            EXPECT_NEAR(sol_reference.solutions[i][comp],
+                        sol.solutions[i][comp], 1e-12);
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "NumLib/Assembler/OpenMPExecutor.h"
+
+namespace
+{
+struct OrderedSum
+{
+    void add(std::size_t const index, double const value,
+             std::vector<std::size_t>& visited)
+    {
+        // Some thread-local work outside of the ordered section.
+        double const local_value = value * value;
+
+        NumLib::OpenMPExecutor::executeOrdered([&]() {
+            visited.push_back(index);
+            sum += local_value;
+        });
+    }
+
+    double sum = 0;
+};
+}  // namespace
+
+TEST(NumLibOpenMPExecutor, OrderedSectionsFollowContainerOrder)
+{
+    std::size_t const size = 1000;
+    std::vector<double> values(size);
+    std::iota(values.begin(), values.end(), 0.1);
+
+    std::vector<double*> container;
+    container.reserve(size);
+    for (auto& v : values)
+        container.push_back(&v);
+
+    double reference_sum = 0;
+    for (auto const v : values)
+        reference_sum += v * v;
+
+    for (int number_of_threads : {1, 2, 3, 8})
+    {
+        NumLib::OpenMPExecutor::setNumberOfThreads(number_of_threads);
+
+        OrderedSum ordered_sum;
+        std::vector<std::size_t> visited;
+        NumLib::OpenMPExecutor::executeMemberDereferenced(
+            ordered_sum, &OrderedSum::add, container, visited);
+
+        ASSERT_EQ(size, visited.size());
+        for (std::size_t i = 0; i < size; ++i)
+            ASSERT_EQ(i, visited[i]);
+
+        // Same summation order, hence bitwise identical results.
+        ASSERT_EQ(reference_sum, ordered_sum.sum);
+    }
+
+    NumLib::OpenMPExecutor::setNumberOfThreads(0);
+}
+
+TEST(NumLibOpenMPExecutor, ExceptionsAreRethrownAfterTheLoop)
+{
+    for (int number_of_threads : {1, 4})
+    {
+        NumLib::OpenMPExecutor::setNumberOfThreads(number_of_threads);
+
+        // Thrown outside of the ordered sections.
+        EXPECT_THROW(NumLib::OpenMPExecutor::executeIndexed(
+                         100,
+                         [](std::size_t const i) {
+                             if (i == 42)
+                                 throw std::runtime_error("local");
+                         }),
+                     std::runtime_error);
+
+        // Thrown inside of the ordered sections.
+        std::vector<std::size_t> visited;
+        EXPECT_THROW(NumLib::OpenMPExecutor::executeIndexed(
+                         100,
+                         [&visited](std::size_t const i) {
+                             NumLib::OpenMPExecutor::executeOrdered([&]() {
+                                 if (i == 42)
+                                     throw std::runtime_error("ordered");
+                                 visited.push_back(i);
+                             });
+                         }),
+                     std::runtime_error);
+        // The ordered sections before the failing one have been executed.
+        ASSERT_LE(42u, visited.size());
+        for (std::size_t i = 0; i < 42; ++i)
+            ASSERT_EQ(i, visited[i]);
+    }
+
+    NumLib::OpenMPExecutor::setNumberOfThreads(0);
+}
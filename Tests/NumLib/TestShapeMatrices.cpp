@@ -13,7 +13,13 @@
 
 #include <Eigen/Eigen>
 
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Node.h"
 #include "NumLib/Fem/CoordinatesMapping/ShapeMatrices.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendreRegular.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad4.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+#include "ProcessLib/Utils/InitShapeMatrices.h"
 
 #include "Tests/TestTools.h"
 
@@ -126,3 +132,54 @@ TEST(NumLib, FemShapeMatricesWithEigen)
     EXPECT_TRUE(shape.invJ.isZero());
     EXPECT_EQ(0.0, shape.detJ);
 }
+
+TEST(NumLib, FemReferenceShapeMatrices)
+{
+    using ShapeFunction = ShapeQuad4;
+    using ShapeMatricesType = ShapeMatrixPolicyType<ShapeFunction, 2>;
+    using IntegrationMethod = IntegrationGaussLegendreRegular<2>;
+
+    // A distorted quad; its shape functions in natural coordinates are the
+    // ones of the reference element.
+    std::array<MeshLib::Node*, 4> nodes = {
+        {new MeshLib::Node(0.0, 0.0, 0.0), new MeshLib::Node(2.0, 0.5, 0.0),
+         new MeshLib::Node(1.5, 2.0, 0.0), new MeshLib::Node(-0.5, 1.0, 0.0)}};
+    MeshLib::Quad const quad(nodes);
+
+    IntegrationMethod const integration_method(3);
+    auto const shape_matrices =
+        ProcessLib::initShapeMatrices<ShapeFunction, ShapeMatricesType,
+                                      IntegrationMethod, 2>(
+            quad, false /*is_axially_symmetric*/, integration_method);
+    auto const& reference_shape_matrices =
+        ProcessLib::getReferenceShapeMatrices<ShapeFunction,
+                                              ShapeMatricesType>(
+            integration_method);
+
+    ASSERT_EQ(shape_matrices.size(), reference_shape_matrices.N.size());
+    ASSERT_EQ(shape_matrices.size(), reference_shape_matrices.dNdr.size());
+    for (std::size_t ip = 0; ip < shape_matrices.size(); ++ip)
+    {
+        EXPECT_TRUE(shape_matrices[ip].N.isApprox(
+            reference_shape_matrices.N[ip]));
+        EXPECT_TRUE(shape_matrices[ip].dNdr.isApprox(
+            reference_shape_matrices.dNdr[ip]));
+    }
+
+    // The cache is shared for the same integration order only.
+    auto const& shape_matrices_order_3 =
+        ProcessLib::getReferenceShapeMatrices<ShapeFunction,
+                                              ShapeMatricesType>(
+            IntegrationMethod{3});
+    EXPECT_EQ(&reference_shape_matrices, &shape_matrices_order_3);
+    auto const& shape_matrices_order_2 =
+        ProcessLib::getReferenceShapeMatrices<ShapeFunction,
+                                              ShapeMatricesType>(
+            IntegrationMethod{2});
+    EXPECT_EQ(4u, shape_matrices_order_2.N.size());
+
+    for (auto* node : nodes)
+    {
+        delete node;
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2018, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/Dense/DenseMatrix.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "NumLib/DOF/SimpleMatrixVectorProvider.h"
+
+#ifndef USE_PETSC
+TEST(NumLibSimpleMatrixVectorProvider, ReuseVectorsOfSameSize)
+{
+    NumLib::SimpleMatrixVectorProvider provider;
+    MathLib::MatrixSpecifications const spec_10(10, 10, nullptr, nullptr);
+    MathLib::MatrixSpecifications const spec_20(20, 20, nullptr, nullptr);
+
+    std::size_t id = 0;
+    auto* const x = &provider.getVector(spec_10, id);
+    provider.releaseVector(*x);
+
+    // A different user gets the released vector of the same size.
+    auto& y = provider.getVector(spec_10);
+    ASSERT_EQ(x, &y);
+    // The owner of the id gets a new vector and a new id.
+    std::size_t const old_id = id;
+    auto& z = provider.getVector(spec_10, id);
+    ASSERT_NE(&y, &z);
+    ASSERT_NE(old_id, id);
+
+    // Vectors of another size are not reused.
+    provider.releaseVector(y);
+    auto& w = provider.getVector(spec_20);
+    ASSERT_NE(&y, &w);
+    ASSERT_EQ(20, w.size());
+
+    // Copies belong to the size class of the copied vector.
+    provider.releaseVector(w);
+    auto& copy = provider.getVector(z);
+    ASSERT_EQ(&y, &copy);
+
+    // Vectors without specifications are only reused by id.
+    provider.releaseVector(copy);
+    auto& u = provider.getVector();
+    ASSERT_NE(&y, &u);
+
+    auto const& statistics = provider.getStatistics();
+    ASSERT_EQ(4u, statistics.number_of_allocations);
+    ASSERT_EQ(2u, statistics.number_of_reuses);
+    // z and w were in use at the same time.
+    ASSERT_EQ(30 * sizeof(double), statistics.peak_used_bytes);
+    ASSERT_EQ(10 * sizeof(double), statistics.used_bytes);
+    ASSERT_EQ(40 * sizeof(double), statistics.allocated_bytes);
+
+    provider.releaseVector(z);
+    provider.releaseVector(u);
+}
+
+TEST(NumLibSimpleMatrixVectorProvider, ReusedMatrixForgetsCachedOffsets)
+{
+    using Indices = MathLib::RowColumnIndices<GlobalIndexType>;
+    NumLib::SimpleMatrixVectorProvider provider;
+    GlobalSparsityPattern const sparsity_pattern{3, 3, 3};
+    MathLib::MatrixSpecifications const spec(3, 3, nullptr,
+                                             &sparsity_pattern);
+
+    std::vector<GlobalIndexType> const all = {0, 1, 2};
+    std::vector<GlobalIndexType> const first = {0};
+    std::vector<GlobalIndexType> const last = {2};
+    MathLib::DenseMatrix<double> const local_full(3, 3, 1.0);
+    MathLib::DenseMatrix<double> const local_single(1, 1, 5.0);
+
+    auto& A = provider.getMatrix(spec);
+    A.add(Indices(all, all), local_full);
+    MathLib::LinAlg::finalizeAssembly(A);
+    // Fills the cache of item 0 for the entry (0, 0).
+    A.add(0, Indices(first, first), local_single);
+    provider.releaseMatrix(A);
+
+    // Another user adds a different entry for the same item.
+    auto& B = provider.getMatrix(spec);
+    ASSERT_EQ(&A, &B);
+    B.setZero();
+    B.add(0, Indices(last, last), local_single);
+    ASSERT_EQ(0.0, B.get(0, 0));
+    ASSERT_EQ(5.0, B.get(2, 2));
+    provider.releaseMatrix(B);
+}
+#endif
@@ -256,3 +256,82 @@ TEST_F(ProcessLibParameter, GetNodalValuesOnElement_curveScaledNode)
     ASSERT_TRUE(testNodalValuesOfElement(meshes[0]->getElements(),
                                          expected_value, *parameter, t));
 }
+
+// For all elements and integration points the values are the parameter's
+// values at the element.
+TEST_F(ProcessLibParameter, GetIntegrationPointValuesOnElements_constant)
+{
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Constant</type>"
+        "<values>1 2</values>",
+        meshes);
+
+    auto const& elements = meshes[0]->getElements();
+    unsigned const n_integration_points = 3;
+    std::vector<double> values(elements.size() * n_integration_points * 2);
+    parameter->getIntegrationPointValuesOnElements(
+        elements.begin(), elements.end(), n_integration_points, 0,
+        values.data());
+
+    for (std::size_t i = 0; i < values.size(); i += 2)
+    {
+        ASSERT_EQ(1.0, values[i]);
+        ASSERT_EQ(2.0, values[i + 1]);
+    }
+}
+
+TEST_F(ProcessLibParameter,
+       GetIntegrationPointValuesOnElements_curveScaledElement)
+{
+    std::vector<double> element_ids({0, 1, 2, 3});
+    MeshLib::addPropertyToMesh(*meshes[0], "ElementIDs",
+                               MeshLib::MeshItemType::Cell, 1, element_ids);
+
+    std::vector<std::unique_ptr<ParameterBase>> parameters;
+    parameters.emplace_back(
+        constructParameterFromString("<name>ElementIDs</name>"
+                                     "<type>MeshElement</type>"
+                                     "<field_name>ElementIDs</field_name>",
+                                     meshes));
+
+    std::map<std::string,
+             std::unique_ptr<MathLib::PiecewiseLinearInterpolation>>
+        curves;
+    curves["linear_curve"] =
+        std::make_unique<MathLib::PiecewiseLinearInterpolation>(
+            std::vector<double>{0, 1}, std::vector<double>{0, 1}, true);
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>CurveScaled</type>"
+        "<curve>linear_curve</curve>"
+        "<parameter>ElementIDs</parameter>",
+        meshes, curves);
+
+    parameter->initialize(parameters);
+
+    double const t = 0.5;
+    auto const& elements = meshes[0]->getElements();
+    unsigned const n_integration_points = 2;
+    std::vector<double> values(elements.size() * n_integration_points);
+    parameter->getIntegrationPointValuesOnElements(
+        elements.begin() + 1, elements.end(), n_integration_points, t,
+        values.data());
+
+    // All integration points have the value of the element id times the time,
+    // which is the same as evaluating the parameter for each of them.
+    SpatialPosition x_position;
+    for (std::size_t e = 1; e < elements.size(); ++e)
+    {
+        x_position.setElementID(e);
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            x_position.setIntegrationPoint(ip);
+            double value;
+            parameter->getValue(t, x_position, &value);
+            ASSERT_EQ(e * t, value);
+            ASSERT_EQ(value, values[(e - 1) * n_integration_points + ip]);
+        }
+    }
+}
@@ -154,6 +154,11 @@ endif()
 
 find_package(OpenSSL)
 
+## Google Benchmark for the micro-benchmark suite
+if(OGS_BUILD_BENCHMARKS)
+    find_package(benchmark REQUIRED)
+endif()
+
 ## Check MPI package
 if(OGS_USE_MPI)
     find_package(MPI REQUIRED)